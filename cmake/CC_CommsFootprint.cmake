@@ -0,0 +1,116 @@
+# This file contains helper function to generate memory footprint
+# report of the message and field types as a build artifact.
+#
+# Available functions are:
+#
+# ******************************************************
+# - Generate memory footprint report.
+#     cc_comms_footprint_report(
+#         NAME <target_name>
+#         OUTPUT <report_file>
+#         HEADERS <header1> [<header2> ...]
+#         [MESSAGES <msg_type1> <msg_type2> ...]
+#         [FIELDS <field_type1> <field_type2> ...]
+#         [COMMS_TARGET <comms_lib_target>]
+#         [LINK_LIBS <lib1> <lib2> ...]
+#         [NO_ALL]
+#     )
+# - NAME - A must have argument to provide name of the target generating the report.
+# - OUTPUT - A must have argument to provide path to the output report file.
+# - HEADERS - Headers to include in order to get definitions of the reported types.
+# - MESSAGES - Fully qualified message types, expected to use comms::option::def::FieldsImpl option.
+# - FIELDS - Fully qualified field types.
+# - COMMS_TARGET - Override the default cmake target for the comms library, defaults to
+#   cc::comms.
+# - LINK_LIBS - Extra libraries (targets) required by the reported types.
+# - NO_ALL - Don't add the report generation target to the default build target.
+#
+# The report is generated by the helper executable (<target_name>_gen) which
+# is compiled and executed during the build. Every reported type is listed
+# with its fields tree, see comms::footprintAppendMessageReport() and
+# comms::footprintAppendFieldReport() for details on the report format.
+
+set (CC_COMMS_FOOTPRINT_DEFAULT_COMMS_LIB_TARGET "cc::comms")
+
+function (cc_comms_footprint_report)
+    set (_prefix CC_FOOTPRINT)
+    set (_options NO_ALL)
+    set (_oneValueArgs NAME OUTPUT COMMS_TARGET)
+    set (_mutiValueArgs HEADERS MESSAGES FIELDS LINK_LIBS)
+    cmake_parse_arguments(${_prefix} "${_options}" "${_oneValueArgs}" "${_mutiValueArgs}" ${ARGN})
+
+    if ("${CC_FOOTPRINT_NAME}" STREQUAL "")
+        message (FATAL_ERROR "The NAME parameter is not provided")
+    endif ()
+
+    if ("${CC_FOOTPRINT_OUTPUT}" STREQUAL "")
+        message (FATAL_ERROR "The OUTPUT parameter is not provided")
+    endif ()
+
+    if (CMAKE_CROSSCOMPILING)
+        message (WARNING "Memory footprint report ${CC_FOOTPRINT_NAME} is not generated when cross-compiling")
+        return ()
+    endif ()
+
+    if (NOT CC_FOOTPRINT_COMMS_TARGET)
+        set (CC_FOOTPRINT_COMMS_TARGET ${CC_COMMS_FOOTPRINT_DEFAULT_COMMS_LIB_TARGET})
+    endif ()
+
+    set (src "${CMAKE_CURRENT_BINARY_DIR}/${CC_FOOTPRINT_NAME}_gen.cpp")
+    set (src_text "// Generated file, do not edit\n\n")
+    foreach (h ${CC_FOOTPRINT_HEADERS})
+        string (APPEND src_text "#include \"${h}\"\n")
+    endforeach ()
+
+    string (APPEND src_text
+        "\n#include <fstream>\n#include <iostream>\n#include <string>\n\n#include \"comms/footprint.h\"\n\n"
+        "int main(int argc, const char* argv[])\n{\n"
+        "    if (argc < 2) {\n"
+        "        std::cerr << \"Output file is not provided\" << std::endl;\n"
+        "        return -1;\n"
+        "    }\n\n"
+        "    std::string report;\n")
+
+    foreach (t ${CC_FOOTPRINT_MESSAGES})
+        string (APPEND src_text "    comms::footprintAppendMessageReport<${t}>(report, \"${t}\");\n")
+        string (APPEND src_text "    report.push_back('\\n');\n")
+    endforeach ()
+
+    foreach (t ${CC_FOOTPRINT_FIELDS})
+        string (APPEND src_text "    comms::footprintAppendFieldReport<${t}>(report, \"${t}\");\n")
+        string (APPEND src_text "    report.push_back('\\n');\n")
+    endforeach ()
+
+    string (APPEND src_text
+        "\n    std::ofstream stream(argv[1]);\n"
+        "    if (!stream) {\n"
+        "        std::cerr << \"Failed to open \" << argv[1] << std::endl;\n"
+        "        return -1;\n"
+        "    }\n\n"
+        "    stream << report;\n"
+        "    return 0;\n}\n")
+
+    # Avoid unnecessary rebuilds when the generated source hasn't changed
+    file (WRITE "${src}.tmp" "${src_text}")
+    execute_process (
+        COMMAND ${CMAKE_COMMAND} -E copy_if_different "${src}.tmp" "${src}"
+    )
+
+    set (gen_target "${CC_FOOTPRINT_NAME}_gen")
+    add_executable (${gen_target} ${src})
+    target_link_libraries (${gen_target} PRIVATE ${CC_FOOTPRINT_COMMS_TARGET} ${CC_FOOTPRINT_LINK_LIBS})
+
+    add_custom_command (
+        OUTPUT ${CC_FOOTPRINT_OUTPUT}
+        COMMAND ${gen_target} ${CC_FOOTPRINT_OUTPUT}
+        DEPENDS ${gen_target}
+        COMMENT "Generating memory footprint report ${CC_FOOTPRINT_OUTPUT}"
+    )
+
+    set (all_opt ALL)
+    if (CC_FOOTPRINT_NO_ALL)
+        set (all_opt)
+    endif ()
+
+    add_custom_target (${CC_FOOTPRINT_NAME} ${all_opt} DEPENDS ${CC_FOOTPRINT_OUTPUT})
+endfunction ()
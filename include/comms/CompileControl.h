@@ -170,6 +170,17 @@
 #define COMMS_HAS_CPP20_SPAN true
 #endif // #if COMMS_IS_CPP20 && defined(__cpp_lib_span)
 
+// Relaxed C++20 constexpr rules (virtual functions, uninitialised
+// variables, non-trivial destructors) allow compile time serialisation
+#define COMMS_HAS_CPP20_CONSTEXPR false
+#define COMMS_CONSTEXPR20
+#if !defined(COMMS_NO_CPP20_CONSTEXPR) && COMMS_IS_CPP20 && defined(__cpp_constexpr) && (__cpp_constexpr >= 201907L)
+#undef COMMS_HAS_CPP20_CONSTEXPR
+#define COMMS_HAS_CPP20_CONSTEXPR true
+#undef COMMS_CONSTEXPR20
+#define COMMS_CONSTEXPR20 constexpr
+#endif // #if !defined(COMMS_NO_CPP20_CONSTEXPR) && COMMS_IS_CPP20 && ...
+
 #if COMMS_IS_MSVC
 
 #define COMMS_MSVC_WARNING_PRAGMA(s_) __pragma(s_)
@@ -0,0 +1,265 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::ConstFrame class and
+///     relevant helper functions.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+
+namespace comms
+{
+
+/// @brief Fully framed serialised message of the fixed content.
+/// @details Serialises the message through the provided protocol stack
+///     upon construction. Intended to be used for the messages of the constant
+///     content (heartbeats, capability announcements, fixed configuration replies),
+///     which don't need to be re-serialised every time they are sent.
+///     The storage size is evaluated at compile time using
+///     @ref comms::constFrameMaxLength(). Prior to C++20 the serialisation
+///     is performed at run time. With C++20 the constructor is @b constexpr,
+///     and the object can be a compile time constant when the whole write chain of
+///     the protocol stack and the message is usable in the constant expression
+///     (see @ref comms::ConstexprFrame). Usually the objects of this class are
+///     not created directly, use @ref comms::makeConstFrame() or @ref comms::constFrame()
+///     helper functions instead.
+/// @tparam TSize Size of the storage area.
+/// @headerfile comms/ConstFrame.h
+template <std::size_t TSize>
+class ConstFrame
+{
+public:
+    /// @brief Type of the storage
+    using Storage = std::array<std::uint8_t, TSize>;
+
+    /// @brief Type of the iterator to the serialised data
+    using const_iterator = typename Storage::const_iterator;
+
+    /// @brief Constructor
+    /// @details Writes provided message using provided protocol stack.
+    /// @param[in] stack Protocol stack (see @ref page_use_prot_transport).
+    /// @param[in] msg Message object to write.
+    template <typename TStack, typename TMsg>
+    COMMS_CONSTEXPR20 ConstFrame(const TStack& stack, const TMsg& msg)
+    {
+        auto iter = &storage_[0];
+        es_ = stack.write(msg, iter, storage_.size());
+        COMMS_ASSERT(es_ == comms::ErrorStatus::Success);
+        if (es_ != comms::ErrorStatus::Success) {
+            return;
+        }
+
+        size_ = static_cast<std::size_t>(std::distance(&storage_[0], iter));
+    }
+
+    /// @brief Status of the write operation performed upon construction.
+    COMMS_CONSTEXPR20 comms::ErrorStatus status() const
+    {
+        return es_;
+    }
+
+    /// @brief Access the storage area.
+    COMMS_CONSTEXPR20 const Storage& storage() const
+    {
+        return storage_;
+    }
+
+    /// @brief Pointer to the first byte of the serialised frame.
+    COMMS_CONSTEXPR20 const std::uint8_t* data() const
+    {
+        return storage_.data();
+    }
+
+    /// @brief Length of the serialised frame.
+    /// @details Reports @b 0 in case of write failure.
+    COMMS_CONSTEXPR20 std::size_t size() const
+    {
+        return size_;
+    }
+
+    /// @brief Iterator to the first byte of the serialised frame.
+    COMMS_CONSTEXPR20 const_iterator begin() const
+    {
+        return storage_.begin();
+    }
+
+    /// @brief Iterator to one past the last byte of the serialised frame.
+    COMMS_CONSTEXPR20 const_iterator end() const
+    {
+        return storage_.begin() + static_cast<std::ptrdiff_t>(size_);
+    }
+
+private:
+    Storage storage_ = Storage();
+    std::size_t size_ = 0U;
+    comms::ErrorStatus es_ = comms::ErrorStatus::NumOfErrorStatuses;
+};
+
+/// @brief Compile time evaluation of the storage size required to hold
+///     the fully framed message of the provided type.
+/// @tparam TStack Type of the protocol stack.
+/// @tparam TMsg Type of the message, expected to report strict upper limit of
+///     its serialisation length.
+/// @related ConstFrame
+template <typename TStack, typename TMsg>
+constexpr std::size_t constFrameMaxLength()
+{
+    return TStack::template maxFrameLength<std::tuple<TMsg> >();
+}
+
+namespace details
+{
+
+template <typename TStack, typename TMsg>
+struct ConstFrameStorageSize
+{
+    static const std::size_t MaxLength = constFrameMaxLength<TStack, TMsg>();
+    static const bool Known = (MaxLength != std::numeric_limits<std::size_t>::max());
+    static_assert(Known,
+        "The maximal serialisation length of the frame must be known at compile time");
+
+    // Avoid instantiation of the huge storage when the length is unknown
+    static const std::size_t Value = Known ? MaxLength : 1U;
+};
+
+#if COMMS_HAS_CPP20_CONSTEXPR
+
+template <typename TStack, typename TMsg>
+constexpr ConstFrame<ConstFrameStorageSize<TStack, TMsg>::Value> constFrameEval()
+{
+    return ConstFrame<ConstFrameStorageSize<TStack, TMsg>::Value>(TStack(), TMsg());
+}
+
+// Detects whether the frame can be serialised at compile time,
+// the non-constant expression in the template argument is a substitution failure.
+template <typename TStack, typename TMsg, typename = void>
+struct ConstFrameIsConstexpr : public std::false_type
+{
+};
+
+template <typename TStack, typename TMsg>
+struct ConstFrameIsConstexpr<
+    TStack,
+    TMsg,
+    std::void_t<std::integral_constant<std::size_t, constFrameEval<TStack, TMsg>().size()> >
+> : public std::true_type
+{
+};
+
+template <typename TStack, typename TMsg>
+struct ConstFrameStatic
+{
+    static constexpr auto Value = constFrameEval<TStack, TMsg>();
+};
+
+template <typename TStack, typename TMsg, std::size_t TLength>
+constexpr std::array<std::uint8_t, TLength> constFrameData()
+{
+    std::array<std::uint8_t, TLength> result = {};
+    for (std::size_t idx = 0U; idx < TLength; ++idx) {
+        result[idx] = ConstFrameStatic<TStack, TMsg>::Value.storage()[idx];
+    }
+    return result;
+}
+
+#endif // #if COMMS_HAS_CPP20_CONSTEXPR
+
+} // namespace details
+
+/// @brief Serialise provided message into @ref comms::ConstFrame object.
+/// @details The size of the storage is evaluated at compile time using
+///     @ref comms::constFrameMaxLength(), while the serialisation is performed
+///     at run time. The result can be kept in a static (or global) variable
+///     to be reused for every send:
+///     @code
+///     static const auto Frame = comms::makeConstFrame(ProtStack(), msg);
+///     ...
+///     sendData(Frame.data(), Frame.size());
+///     @endcode
+/// @param[in] stack Protocol stack (see @ref page_use_prot_transport).
+/// @param[in] msg Message object to write.
+/// @related ConstFrame
+template <typename TStack, typename TMsg>
+ConstFrame<details::ConstFrameStorageSize<TStack, TMsg>::Value> makeConstFrame(const TStack& stack, const TMsg& msg)
+{
+    return ConstFrame<details::ConstFrameStorageSize<TStack, TMsg>::Value>(stack, msg);
+}
+
+/// @brief Access the fully framed default constructed message of the provided type.
+/// @details With C++20, when the write chain of the protocol stack and the message
+///     is usable in the constant expression, the frame is serialised at compile
+///     time into the @b static @b constexpr object. Otherwise (and prior to C++20)
+///     the message is serialised only once, upon the first call to the function,
+///     into the function local static object. As such, every call checks its
+///     initialisation guard and the frame resides in RAM. All the subsequent calls
+///     return reference to the same object. Use @ref comms::makeConstFrame() to
+///     control where and when the frame is initialised.
+/// @tparam TStack Type of the protocol stack, expected to be default constructible.
+/// @tparam TMsg Type of the message, expected to be default constructible.
+/// @related ConstFrame
+template <typename TStack, typename TMsg>
+const ConstFrame<details::ConstFrameStorageSize<TStack, TMsg>::Value>& constFrame()
+{
+#if COMMS_HAS_CPP20_CONSTEXPR
+    if constexpr (details::ConstFrameIsConstexpr<TStack, TMsg>::value) {
+        return details::ConstFrameStatic<TStack, TMsg>::Value;
+    }
+    else {
+        static const auto Frame = makeConstFrame(TStack(), TMsg());
+        return Frame;
+    }
+#else // #if COMMS_HAS_CPP20_CONSTEXPR
+    static const auto Frame = makeConstFrame(TStack(), TMsg());
+    return Frame;
+#endif // #if COMMS_HAS_CPP20_CONSTEXPR
+}
+
+#if COMMS_HAS_CPP20_CONSTEXPR || defined(FOR_DOXYGEN_DOC_ONLY)
+/// @brief Compile time serialised frame of the default constructed message.
+/// @details Available only with C++20 (see @b COMMS_HAS_CPP20_CONSTEXPR).
+///     The whole write chain of the protocol stack and the message is required
+///     to be usable in the constant expression: the integral, enum, bitmask and bundle
+///     fields, the common transport layers, and the message types without
+///     non-trivial (or virtual) destructors. Otherwise the compilation fails,
+///     use @ref comms::constFrame() which falls back to run time serialisation.
+///     @code
+///     using Frame = comms::ConstexprFrame<ProtStack, HeartbeatMsg>;
+///     static_assert(Frame::Length == 8U);
+///     sendData(Frame::Data.data(), Frame::Data.size());
+///     @endcode
+/// @tparam TStack Type of the protocol stack, expected to be default constructible.
+/// @tparam TMsg Type of the message, expected to be default constructible.
+/// @headerfile comms/ConstFrame.h
+template <typename TStack, typename TMsg>
+struct ConstexprFrame
+{
+    static_assert(
+        details::ConstFrameStatic<TStack, TMsg>::Value.status() == comms::ErrorStatus::Success,
+        "Failed to write the frame");
+
+    /// @brief Length of the serialised frame.
+    static constexpr std::size_t Length = details::ConstFrameStatic<TStack, TMsg>::Value.size();
+
+    /// @brief Serialised frame, the array size is exactly @ref Length.
+    static constexpr std::array<std::uint8_t, Length> Data =
+        details::constFrameData<TStack, TMsg, Length>();
+};
+#endif // #if COMMS_HAS_CPP20_CONSTEXPR || defined(FOR_DOXYGEN_DOC_ONLY)
+
+} // namespace comms
@@ -28,6 +28,8 @@ enum class ErrorStatus {
     InvalidMsgData, ///<Used to indicate that a message has invalid data.
     MsgAllocFailure, ///<Used to indicate that message allocation has failed.
     NotSupported, ///< The operation is not supported.
+    FragmentReceived, ///< Used to indicate that a non-final fragment of a message
+                      /// was consumed, the message is not complete yet.
     NumOfErrorStatuses ///< Number of supported error statuses, must be last.
 };
 
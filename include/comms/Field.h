@@ -12,6 +12,7 @@
 
 #include <type_traits>
 
+#include "comms/CompileControl.h"
 #include "comms/util/access.h"
 #include "comms/details/FieldBase.h"
 #include "comms/details/macro_common.h"
@@ -94,6 +95,26 @@ public:
         return false;
     }         
 
+    /// @brief Default check of whether the serialised data of the field is
+    ///     the same as the in-memory representation of its value.
+    /// @details When @b true, the field's value can be (de)serialised with
+    ///     a plain @b memcpy().
+    /// @return Always @b false.
+    static constexpr bool hasHostLayout()
+    {
+        return false;
+    }
+
+    /// @brief Default check of whether the value returned by @b maxLength()
+    ///     is a strict upper limit of the serialisation length.
+    /// @details The fields which use storage types of unlimited size (such as
+    ///     @b std::vector or @b std::string) report @b false.
+    /// @return Always @b true.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return true;
+    }
+
     /// @brief Default check of whether the field has a consistent value
     ///     for writing.
     /// @return Always @b true.
@@ -132,7 +153,7 @@ protected:
     /// @post The iterator is advanced.
     /// @note Thread safety: Safe for distinct buffers, unsafe otherwise.
     template <typename T, typename TIter>
-    static void writeData(T value, TIter& iter)
+    static COMMS_CONSTEXPR20 void writeData(T value, TIter& iter)
     {
         writeData<sizeof(T), T>(value, iter);
     }
@@ -152,7 +173,7 @@ protected:
     /// @post The iterator is advanced.
     /// @note Thread safety: Safe for distinct buffers, unsafe otherwise.
     template <std::size_t TSize, typename T, typename TIter>
-    static void writeData(T value, TIter& iter)
+    static COMMS_CONSTEXPR20 void writeData(T value, TIter& iter)
     {
         static_assert(TSize <= sizeof(T),
                                     "Cannot put more bytes than type contains");
@@ -212,6 +212,16 @@ public:
     /// @return @b true if at least one of the fields is version dependent.
     static constexpr bool areFieldsVersionDependent();
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref doMaxLength() is a strict upper limit of the serialisation length.
+    /// @details The function doesn't exist if @ref comms::option::def::FieldsImpl option
+    ///     wasn't provided to comms::MessageBase. When @b true, the
+    ///     @ref doWrite() may skip the calculation of the actual serialisation
+    ///     length if the provided buffer size is not less than @ref doMaxLength().
+    /// @return @b false if at least one of the fields uses storage of unlimited
+    ///     size (such as @b std::vector or @b std::string).
+    static constexpr bool doFieldsHaveStrictMaxLength();
+
     /// @brief Default implementation of ID retrieval functionality.
     /// @details This function exists only if @ref comms::option::def::StaticNumIdImpl option
     ///     was provided to comms::MessageBase. @n
@@ -58,6 +58,8 @@ constexpr bool hasMsgDispatcherTag()
 ///         @ref comms::dispatchMsgStaticBinSearch()
 ///     @li @ref comms::option::ForceDispatchLinearSwitch - Force dispatch using
 ///         @ref comms::dispatchMsgLinearSwitch()
+///     @li @ref comms::option::ForceDispatchJumpTable - Force dispatch using
+///         @ref comms::dispatchMsgJumpTable()
 template <typename... TOptions>
 class MsgDispatcher
 {
@@ -157,6 +159,27 @@ class MsgDispatcher
         return comms::dispatchMsgLinearSwitch<TAllMessages>(msg, handler);
     }
 
+    template <typename TAllMessages, typename TMsgId, typename TMsg, typename THandler>
+    static auto dispatchInternal(TMsgId&& id, std::size_t idx, TMsg& msg, THandler& handler, comms::traits::dispatch::JumpTable) ->
+        decltype(comms::dispatchMsgJumpTable<TAllMessages>(std::forward<TMsgId>(id), idx, msg, handler))
+    {
+        return comms::dispatchMsgJumpTable<TAllMessages>(std::forward<TMsgId>(id), idx, msg, handler);
+    }
+
+    template <typename TAllMessages, typename TMsgId, typename TMsg, typename THandler>
+    static auto dispatchInternal(TMsgId&& id, TMsg& msg, THandler& handler, comms::traits::dispatch::JumpTable) ->
+        decltype(comms::dispatchMsgJumpTable<TAllMessages>(std::forward<TMsgId>(id), msg, handler))
+    {
+        return comms::dispatchMsgJumpTable<TAllMessages>(std::forward<TMsgId>(id), msg, handler);
+    }
+
+    template <typename TAllMessages, typename TMsg, typename THandler>
+    static auto dispatchInternal(TMsg& msg, THandler& handler, comms::traits::dispatch::JumpTable) ->
+        decltype(comms::dispatchMsgJumpTable<TAllMessages>(msg, handler))
+    {
+        return comms::dispatchMsgJumpTable<TAllMessages>(msg, handler);
+    }
+
     template <typename TAllMessages>
     static constexpr bool isDispatchPolymorphicInternal(NoForcingTag)
     {
@@ -196,6 +219,19 @@ class MsgDispatcher
         return std::is_same<TTag, comms::traits::dispatch::LinearSwitch>::value;
     }
 
+    template <typename TAllMessages>
+    static constexpr bool isDispatchJumpTableInternal(NoForcingTag)
+    {
+        return false;
+    }
+
+    template <typename TAllMessages, typename TTag>
+    static constexpr bool isDispatchJumpTableInternal(TTag)
+    {
+        static_assert(!std::is_same<TTag, NoForcingTag>::value, "Invalid tag dispatch");
+        return std::is_same<TTag, comms::traits::dispatch::JumpTable>::value;
+    }
+
 public:
     /// @brief Parsed Options
     using ParsedOptions = ParsedOptionsInternal;
@@ -205,7 +241,8 @@ public:
 
     /// @brief Dispatch message to its handler.
     /// @details Uses @ref comms::dispatchMsg(), @ref comms::dispatchMsgPolymorphic(),
-    ///     @ref comms::dispatchMsgStaticBinSearch(), or @ref comms::dispatchMsgLinearSwitch()
+    ///     @ref comms::dispatchMsgStaticBinSearch(), @ref comms::dispatchMsgLinearSwitch(),
+    ///     or @ref comms::dispatchMsgJumpTable()
     ///     based on class definition option(s).
     /// @tparam TAllMessages Bundle (std::tuple) of all supported message classes
     /// @param[in] id ID of the message.
@@ -285,6 +322,16 @@ public:
     {
         return isDispatchLinearSwitchInternal<TAllMessages>(Tag());
     }
+
+    /// @brief Compile time inquiry whether flat jump table dispatch is
+    ///     generated internally to map message ID to actual type.
+    /// @see @ref page_dispatch
+    /// @see @ref isDispatchLinearSwitch()
+    template <typename TAllMessages>
+    static constexpr bool isDispatchJumpTable()
+    {
+        return isDispatchJumpTableInternal<TAllMessages>(Tag());
+    }
 };
 
 namespace details
@@ -55,6 +55,10 @@ namespace comms
 ///         If @ref comms::option::app::InPlaceAllocation option is NOT used, than the
 ///         requested message objects are allocated using dynamic memory and
 ///         returned wrapped in std::unique_ptr without custom deleter.
+///     @li @ref comms::option::app::SharedMsgPtr - Option to specify that the
+///         allocated message objects are returned held by the intrusively reference counted
+///         @ref comms::util::alloc::SharedPtr instead of @b std::unique_ptr. Can be
+///         combined with @ref comms::option::app::InPlaceAllocation.
 ///     @li @ref comms::option::app::SupportGenericMessage - Option used to allow
 ///         allocation of @ref comms::GenericMessage. If such option is
 ///         provided, the createGenericMsg() member function will be able
@@ -63,8 +67,9 @@ namespace comms
 ///         parameter) must be equal to @b TMsgBase (first template parameter)
 ///         of @b this class.
 ///     @li @ref comms::option::app::ForceDispatchPolymorphic,
-///         @ref comms::option::app::ForceDispatchStaticBinSearch, or
-///         @ref comms::option::app::ForceDispatchLinearSwitch - Force a particular
+///         @ref comms::option::app::ForceDispatchStaticBinSearch,
+///         @ref comms::option::app::ForceDispatchLinearSwitch, or
+///         @ref comms::option::app::ForceDispatchJumpTable - Force a particular
 ///         dispatch way when creating message object given the numeric ID
 ///         (see @ref comms::MsgFactory::createMsg()). The dispatch methods
 ///         are properly described in @ref page_dispatch tutorial page.
@@ -74,8 +79,15 @@ namespace comms
 ///         To inquire what actual dispatch type is used, please use one
 ///         of the following constexpr member functions: 
 ///         @ref comms::MsgFactory::isDispatchPolymorphic(),
-///         @ref comms::MsgFactory::isDispatchStaticBinSearch(), and
-///         @ref comms::MsgFactory::isDispatchLinearSwitch()
+///         @ref comms::MsgFactory::isDispatchStaticBinSearch(),
+///         @ref comms::MsgFactory::isDispatchLinearSwitch(), and
+///         @ref comms::MsgFactory::isDispatchJumpTable()
+///     @li @ref comms::option::app::MsgFactoryHotIdCache - Consult small
+///         adaptive cache of recently created message IDs before
+///         performing the dispatch lookup. The cache is updated only by the
+///         non-const @ref comms::MsgFactory::createMsg() "createMsg()".
+///     @li @ref comms::option::app::MsgFactoryLikelyIds - Seed the message ID
+///         cache with the provided IDs on construction.
 /// @pre TMsgBase is a base class for all the messages in TAllMessages.
 /// @pre Message type is TAllMessages must be sorted based on their IDs.
 /// @pre If @ref comms::option::app::InPlaceAllocation option is provided, only one custom
@@ -140,6 +152,23 @@ public:
         return Base::createMsg(id, idx, reason);
     }
 
+    /// @brief Create message object given the ID of the message and update
+    ///     the message ID cache.
+    /// @details Same as the const @ref createMsg(), but when the cache
+    ///     is enabled (see @ref hasHotIdCache()) the usage statistics of the
+    ///     cached IDs are updated and the missed ID is inserted into the cache.
+    ///     The const overload only consults the cache without modifying it,
+    ///     i.e. it is safe to be invoked concurrently on the same factory object
+    ///     (given the allocator supports it).
+    /// @param id ID of the message.
+    /// @param idx Relative index (or offset) of the message with the same ID.
+    /// @param[out] reason Failure reason in case creation has failed. May be nullptr.
+    /// @return Smart pointer to the allocated message object.
+    MsgPtr createMsg(MsgIdParamType id, unsigned idx = 0U, CreateFailureReason* reason = nullptr)
+    {
+        return Base::createMsg(id, idx, reason);
+    }
+
     /// @brief Allocate and initialise @ref comms::GenericMessage object.
     /// @details If @ref comms::option::app::SupportGenericMessage option hasn't been
     ///     provided, this function will return empty @b MsgPtr pointer. Otherwise
@@ -208,6 +237,15 @@ public:
         return Base::isDispatchLinearSwitch();
     }
 
+    /// @brief Compile time inquiry whether flat jump table dispatch is 
+    ///     generated internally to map message ID to actual type.
+    /// @see @ref page_dispatch
+    /// @see @ref comms::MsgFactory::isDispatchLinearSwitch()
+    static constexpr bool isDispatchJumpTable()
+    {
+        return Base::isDispatchJumpTable();
+    }
+
     /// @brief Compile time inquiry whether factory supports in-place allocation
     /// @return @b true in case of in-place allocation, @b false in case of dynamic memory use.
     static constexpr bool hasInPlaceAllocation()
@@ -215,6 +253,13 @@ public:
         return ParsedOptions::HasInPlaceAllocation;
     }
 
+    /// @brief Compile time inquiry whether factory produces reference counted
+    ///     message objects, i.e. @ref comms::option::app::SharedMsgPtr option has been used.
+    static constexpr bool hasSharedMsgPtr()
+    {
+        return ParsedOptions::HasSharedMsgPtr;
+    }
+
     /// @brief Compile time inquiry whether factory supports @ref comms::GenericMessage allocation
     static constexpr bool hasGenericMessageSupport()
     {
@@ -226,6 +271,14 @@ public:
     {
         return ParsedOptions::HasForcedDispatch;
     }    
+
+    /// @brief Compile time inquiry whether factory uses the message ID cache
+    /// @details The cache is enabled using @ref comms::option::app::MsgFactoryHotIdCache
+    ///     and/or @ref comms::option::app::MsgFactoryLikelyIds options.
+    static constexpr bool hasHotIdCache()
+    {
+        return Base::hasHotIdCache();
+    }
 };
 
 
@@ -18,6 +18,8 @@
 #include "comms/dispatch.h"
 #include "comms/field_cast.h"
 #include "comms/iterator.h"
+#include "comms/json.h"
+#include "comms/footprint.h"
 #include "process.h"
 
 #include "comms/Message.h"
@@ -25,6 +27,7 @@
 #include "comms/GenericHandler.h"
 #include "comms/MessageBase.h"
 #include "comms/MsgFactory.h"
+#include "comms/ConstFrame.h"
 #include "comms/MsgDispatcher.h"
 #include "comms/GenericMessage.h"
 
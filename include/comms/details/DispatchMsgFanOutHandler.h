@@ -0,0 +1,77 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/details/tag.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename THandlers>
+class DispatchMsgFanOutHandler
+{
+    using HandlersType = typename std::decay<THandlers>::type;
+    static constexpr std::size_t HandlersCount = std::tuple_size<HandlersType>::value;
+
+public:
+    using RetType = void;
+
+    explicit DispatchMsgFanOutHandler(HandlersType& handlers) :
+        handlers_(handlers)
+    {
+    }
+
+    template <typename TMsg>
+    void handle(TMsg& msg)
+    {
+        handleInternal<0U>(msg, HandleTag<0U>());
+    }
+
+private:
+    template <typename... TParams>
+    using NextHandlerTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using EndTag = comms::details::tag::Tag2<>;
+
+    template <std::size_t TIdx>
+    using HandleTag =
+        typename comms::util::LazyShallowConditional<
+            TIdx < HandlersCount
+        >::template Type<
+            NextHandlerTag,
+            EndTag
+        >;
+
+    template <std::size_t TIdx, typename TMsg, typename... TParams>
+    void handleInternal(TMsg& msg, NextHandlerTag<TParams...>)
+    {
+        std::get<TIdx>(handlers_).handle(msg);
+        handleInternal<TIdx + 1U>(msg, HandleTag<TIdx + 1U>());
+    }
+
+    template <std::size_t TIdx, typename TMsg, typename... TParams>
+    void handleInternal(TMsg& msg, EndTag<TParams...>)
+    {
+        static_cast<void>(msg);
+    }
+
+    HandlersType& handlers_;
+};
+
+} // namespace details
+
+} // namespace comms
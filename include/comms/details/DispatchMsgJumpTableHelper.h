@@ -0,0 +1,408 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/Message.h"
+#include "comms/MessageBase.h"
+#include "comms/details/tag.h"
+#include "comms/details/message_check.h"
+#include "comms/details/DispatchMsgStaticBinSearchHelper.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <std::size_t...>
+struct DispatchMsgJumpTableIndices {};
+
+template <typename TFirst, typename TSecond>
+struct DispatchMsgJumpTableIndicesConcat;
+
+template <std::size_t... TFirst, std::size_t... TSecond>
+struct DispatchMsgJumpTableIndicesConcat<DispatchMsgJumpTableIndices<TFirst...>, DispatchMsgJumpTableIndices<TSecond...> >
+{
+    using Type = DispatchMsgJumpTableIndices<TFirst..., (sizeof...(TFirst) + TSecond)...>;
+};
+
+// Halving keeps the instantiation depth logarithmic to the size of the table
+template <std::size_t TCount>
+struct DispatchMsgJumpTableIndicesMaker
+{
+    using Type =
+        typename DispatchMsgJumpTableIndicesConcat<
+            typename DispatchMsgJumpTableIndicesMaker<TCount / 2U>::Type,
+            typename DispatchMsgJumpTableIndicesMaker<TCount - (TCount / 2U)>::Type
+        >::Type;
+};
+
+template <>
+struct DispatchMsgJumpTableIndicesMaker<0U>
+{
+    using Type = DispatchMsgJumpTableIndices<>;
+};
+
+template <>
+struct DispatchMsgJumpTableIndicesMaker<1U>
+{
+    using Type = DispatchMsgJumpTableIndices<0U>;
+};
+
+template <std::size_t TCount>
+using DispatchMsgJumpTableMakeIndices = typename DispatchMsgJumpTableIndicesMaker<TCount>::Type;
+
+template <typename TId, bool TIsEnum = std::is_enum<TId>::value>
+struct DispatchMsgJumpTableIdNum
+{
+    using Type = typename std::underlying_type<TId>::type;
+};
+
+template <typename TId>
+struct DispatchMsgJumpTableIdNum<TId, false>
+{
+    using Type = TId;
+};
+
+template <typename TAllMessages>
+class DispatchMsgJumpTableInfo;
+
+template <typename... TMsgs>
+class DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >
+{
+    using FirstMsgType = typename std::tuple_element<0, std::tuple<TMsgs...> >::type;
+    static_assert(comms::isMessageBase<FirstMsgType>(),
+        "The type in the tuple are expected to be proper messages");
+    static_assert(FirstMsgType::hasMsgIdType(), "The messages must define their ID type");
+    static_assert(allMessagesAreWeakSorted<std::tuple<TMsgs...> >(),
+        "The messages are expected to be sorted by their numeric IDs");
+
+public:
+    using IdNumType = typename DispatchMsgJumpTableIdNum<typename FirstMsgType::MsgIdType>::Type;
+
+    static constexpr std::size_t Count = sizeof...(TMsgs);
+    static constexpr IdNumType Ids[Count] = {static_cast<IdNumType>(TMsgs::doGetId())...};
+    static constexpr IdNumType MinId = Ids[0];
+    static constexpr IdNumType MaxId = Ids[Count - 1U];
+    static constexpr std::uintmax_t Range =
+        static_cast<std::uintmax_t>(MaxId) - static_cast<std::uintmax_t>(MinId);
+
+    // Direct indexing by ID offset is used only when the table doesn't get
+    // too sparse, the static binary search is used otherwise.
+    // The entries of the table use the smallest type that can hold the
+    // index, so the table doesn't exceed 8 bytes per message for most protocols.
+    static constexpr bool IsDense = (Range < (static_cast<std::uintmax_t>(Count) * 8U));
+
+    // Returns index of the first message with provided ID or Count if not found
+    static constexpr std::size_t firstIdx(IdNumType id)
+    {
+        return firstIdxFound(id, lowerBound(id, 0U, Count));
+    }
+
+    static std::size_t findIdx(IdNumType id, std::size_t offset)
+    {
+        static_assert(IsDense, "Expected to be used only with dense IDs");
+        auto first = findFirstIdx(id);
+        if ((Count - first) <= offset) {
+            return Count;
+        }
+
+        auto idx = first + offset;
+        if (Ids[idx] != id) {
+            return Count;
+        }
+
+        return idx;
+    }
+
+private:
+    static constexpr std::size_t lowerBound(IdNumType id, std::size_t from, std::size_t count)
+    {
+        return
+            (count == 0U) ? from :
+            (Ids[from + (count / 2U)] < id) ?
+                lowerBound(id, from + (count / 2U) + 1U, count - (count / 2U) - 1U) :
+                lowerBound(id, from, count / 2U);
+    }
+
+    static constexpr std::size_t firstIdxFound(IdNumType id, std::size_t idx)
+    {
+        return ((idx < Count) && (Ids[idx] == id)) ? idx : Count;
+    }
+
+    static constexpr IdNumType idFromOffset(std::size_t offset)
+    {
+        return static_cast<IdNumType>(static_cast<std::uintmax_t>(MinId) + offset);
+    }
+
+    using DenseTableEntryType = 
+        typename comms::util::Conditional<
+            (Count < 0xffU)
+        >::template Type<
+            std::uint8_t,
+            typename comms::util::Conditional<
+                (Count < 0xffffU)
+            >::template Type<
+                std::uint16_t,
+                std::size_t
+            >
+        >;
+
+    template <std::size_t... TIndices>
+    static const DenseTableEntryType* denseTable(DispatchMsgJumpTableIndices<TIndices...>)
+    {
+        static const DenseTableEntryType Table[] = {static_cast<DenseTableEntryType>(firstIdx(idFromOffset(TIndices)))...};
+        return &Table[0];
+    }
+
+    static std::size_t findFirstIdx(IdNumType id)
+    {
+        auto offset = static_cast<std::uintmax_t>(id) - static_cast<std::uintmax_t>(MinId);
+        if (Range < offset) {
+            return Count;
+        }
+
+        return denseTable(DispatchMsgJumpTableMakeIndices<static_cast<std::size_t>(Range) + 1U>())[static_cast<std::size_t>(offset)];
+    }
+};
+
+template <typename... TMsgs>
+constexpr typename DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >::IdNumType
+DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >::Ids[DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >::Count];
+
+template <typename...>
+class DispatchMsgJumpTableHelper
+{
+    template <typename... TParams>
+    using EmptyTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using TableTag = comms::details::tag::Tag2<>;
+
+    template <typename TAllMessages, typename...>
+    using TableOrEmptyTag =
+        typename comms::util::LazyShallowConditional<
+            std::tuple_size<TAllMessages>::value == 0U
+        >::template Type<
+            EmptyTag,
+            TableTag
+        >;
+
+    template <typename... TParams>
+    using DenseTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using SparseTag = comms::details::tag::Tag4<>;
+
+    // The indirect call via table is faster than the static binary search
+    // only when the index of the message type is retrieved with a single
+    // table lookup. For the sparse IDs the runtime binary search over the
+    // sorted IDs (a chain of dependent loads) is slower than the
+    // unrolled comparisons of the static binary search.
+    template <typename TAllMessages, typename...>
+    using DenseOrSparseTag =
+        typename comms::util::LazyShallowConditional<
+            DispatchMsgJumpTableInfo<TAllMessages>::IsDense
+        >::template Type<
+            DenseTag,
+            SparseTag
+        >;
+
+    template <typename TAllMessages, typename TMsg>
+    using AdjustedTag =
+        typename comms::util::LazyShallowConditional<
+            comms::isMessageBase<TMsg>()
+        >::template Type<
+            EmptyTag,
+            TableOrEmptyTag,
+            TAllMessages
+        >;
+
+public:
+    template <typename TAllMessages, typename TMsg, typename THandler>
+    static auto dispatch(TMsg& msg, THandler& handler) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(MsgType::hasGetId(),
+            "The used message object must provide polymorphic ID retrieval function");
+        static_assert(MsgType::hasMsgIdType(),
+            "Message interface class must define its id type");
+        return dispatchInternal<TAllMessages>(msg.getId(), 0U, msg, handler, AdjustedTag<TAllMessages, MsgType>());
+    }
+
+    template <typename TAllMessages, typename TId, typename TMsg, typename THandler>
+    static auto dispatch(TId&& id, TMsg& msg, THandler& handler) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(MsgType::hasMsgIdType(),
+            "Message interface class must define its id type");
+        using MsgIdParamType = typename MsgType::MsgIdParamType;
+        return dispatchInternal<TAllMessages>(static_cast<MsgIdParamType>(id), 0U, msg, handler, AdjustedTag<TAllMessages, MsgType>());
+    }
+
+    template <typename TAllMessages, typename TId, typename TMsg, typename THandler>
+    static auto dispatch(TId&& id, std::size_t offset, TMsg& msg, THandler& handler) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(MsgType::hasMsgIdType(),
+            "Message interface class must define its id type");
+        using MsgIdParamType = typename MsgType::MsgIdParamType;
+        return dispatchInternal<TAllMessages>(static_cast<MsgIdParamType>(id), offset, msg, handler, AdjustedTag<TAllMessages, MsgType>());
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler>
+    static bool dispatchType(TId&& id, THandler& handler)
+    {
+        return dispatchTypeInternal<TAllMessages>(std::forward<TId>(id), 0U, handler, TableOrEmptyTag<TAllMessages>());
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler>
+    static bool dispatchType(TId&& id, std::size_t offset, THandler& handler)
+    {
+        return dispatchTypeInternal<TAllMessages>(std::forward<TId>(id), offset, handler, TableOrEmptyTag<TAllMessages>());
+    }
+
+private:
+    template <typename TAllMessages, std::size_t TIdx, typename TMsg, typename THandler>
+    static MessageInterfaceDispatchRetType<THandler> dispatchElem(TMsg& msg, THandler& handler)
+    {
+        using RetType = MessageInterfaceDispatchRetType<THandler>;
+        using Elem = typename std::tuple_element<TIdx, TAllMessages>::type;
+        return static_cast<RetType>(handler.handle(static_cast<Elem&>(msg)));
+    }
+
+    template <typename TMsg, typename THandler>
+    static MessageInterfaceDispatchRetType<THandler> dispatchUnknown(TMsg& msg, THandler& handler)
+    {
+        using RetType = MessageInterfaceDispatchRetType<THandler>;
+        return static_cast<RetType>(handler.handle(msg));
+    }
+
+    template <typename TAllMessages, std::size_t TIdx, typename THandler>
+    static bool dispatchTypeElem(THandler& handler)
+    {
+        using Elem = typename std::tuple_element<TIdx, TAllMessages>::type;
+        handler.template handle<Elem>();
+        return true;
+    }
+
+    template <typename THandler>
+    static bool dispatchTypeUnknown(THandler& handler)
+    {
+        static_cast<void>(handler);
+        return false;
+    }
+
+    // The last entry is invoked for unknown IDs
+    template <typename TAllMessages, typename TMsg, typename THandler, std::size_t... TIndices>
+    static auto funcTable(DispatchMsgJumpTableIndices<TIndices...>) ->
+        MessageInterfaceDispatchRetType<THandler> (* const*)(TMsg&, THandler&)
+    {
+        using FuncType = MessageInterfaceDispatchRetType<THandler> (*)(TMsg&, THandler&);
+        static const FuncType Table[] = {
+            &dispatchElem<TAllMessages, TIndices, TMsg, THandler>...,
+            &dispatchUnknown<TMsg, THandler>
+        };
+        return &Table[0];
+    }
+
+    template <typename TAllMessages, typename THandler, std::size_t... TIndices>
+    static auto typeFuncTable(DispatchMsgJumpTableIndices<TIndices...>) -> bool (* const*)(THandler&)
+    {
+        using FuncType = bool (*)(THandler&);
+        static const FuncType Table[] = {
+            &dispatchTypeElem<TAllMessages, TIndices, THandler>...,
+            &dispatchTypeUnknown<THandler>
+        };
+        return &Table[0];
+    }
+
+    template <typename TAllMessages, typename TMsg, typename THandler, typename... TParams>
+    static auto dispatchInternal(typename TMsg::MsgIdParamType id, std::size_t offset, TMsg& msg, THandler& handler, EmptyTag<TParams...>) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        static_cast<void>(id);
+        static_cast<void>(offset);
+        return handler.handle(msg);
+    }
+
+    template <typename TAllMessages, typename TMsg, typename THandler, typename... TParams>
+    static auto dispatchInternal(typename TMsg::MsgIdParamType id, std::size_t offset, TMsg& msg, THandler& handler, TableTag<TParams...>) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        return dispatchInternal<TAllMessages>(id, offset, msg, handler, DenseOrSparseTag<TAllMessages>());
+    }
+
+    template <typename TAllMessages, typename TMsg, typename THandler, typename... TParams>
+    static auto dispatchInternal(typename TMsg::MsgIdParamType id, std::size_t offset, TMsg& msg, THandler& handler, SparseTag<TParams...>) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        return DispatchMsgStaticBinSearchHelper<>::template dispatch<TAllMessages>(id, offset, msg, handler);
+    }
+
+    template <typename TAllMessages, typename TMsg, typename THandler, typename... TParams>
+    static auto dispatchInternal(typename TMsg::MsgIdParamType id, std::size_t offset, TMsg& msg, THandler& handler, DenseTag<TParams...>) ->
+        MessageInterfaceDispatchRetType<
+            typename std::decay<decltype(handler)>::type>
+    {
+        using Info = DispatchMsgJumpTableInfo<TAllMessages>;
+        using HandlerType = typename std::decay<decltype(handler)>::type;
+        auto idx = Info::findIdx(static_cast<typename Info::IdNumType>(id), offset);
+        return funcTable<TAllMessages, TMsg, HandlerType>(DispatchMsgJumpTableMakeIndices<Info::Count>())[idx](msg, handler);
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler, typename... TParams>
+    static bool dispatchTypeInternal(TId&& id, std::size_t offset, THandler& handler, EmptyTag<TParams...>)
+    {
+        static_cast<void>(id);
+        static_cast<void>(offset);
+        static_cast<void>(handler);
+        return false;
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler, typename... TParams>
+    static bool dispatchTypeInternal(TId&& id, std::size_t offset, THandler& handler, TableTag<TParams...>)
+    {
+        return dispatchTypeInternal<TAllMessages>(std::forward<TId>(id), offset, handler, DenseOrSparseTag<TAllMessages>());
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler, typename... TParams>
+    static bool dispatchTypeInternal(TId&& id, std::size_t offset, THandler& handler, SparseTag<TParams...>)
+    {
+        return DispatchMsgStaticBinSearchHelper<>::template dispatchType<TAllMessages>(std::forward<TId>(id), offset, handler);
+    }
+
+    template <typename TAllMessages, typename TId, typename THandler, typename... TParams>
+    static bool dispatchTypeInternal(TId&& id, std::size_t offset, THandler& handler, DenseTag<TParams...>)
+    {
+        using Info = DispatchMsgJumpTableInfo<TAllMessages>;
+        using FirstMsgType = typename std::tuple_element<0, TAllMessages>::type;
+        using MsgIdParamType = typename FirstMsgType::MsgIdParamType;
+        auto idx = Info::findIdx(static_cast<typename Info::IdNumType>(static_cast<MsgIdParamType>(id)), offset);
+        return typeFuncTable<TAllMessages, THandler>(DispatchMsgJumpTableMakeIndices<Info::Count>())[idx](handler);
+    }
+};
+
+} // namespace details
+
+} // namespace comms
@@ -18,6 +18,7 @@
 #include "comms/MessageBase.h"
 #include "comms/details/message_check.h"
 #include "comms/details/DispatchMsgIdRetrieveHelper.h"
+#include "comms/details/DispatchMsgJumpTableHelper.h"
 #include "comms/details/tag.h"
 #include "comms/util/Tuple.h"
 #include "comms/util/type_traits.h"
@@ -42,7 +43,7 @@ public:
     }
 
 protected:
-    PolymorphicDirectDispatchMethod() = default;
+    constexpr PolymorphicDirectDispatchMethod() = default;
     ~PolymorphicDirectDispatchMethod() = default;
 
     virtual auto dispatchImpl(TMsgBase& msg, THandler& handler) const ->
@@ -54,10 +55,13 @@ class PolymorphicDirectDispatchMethodImpl : public
                 PolymorphicDirectDispatchMethod<TMsgBase, THandler>
 {
 public:
-    PolymorphicDirectDispatchMethodImpl() = default;
+    constexpr PolymorphicDirectDispatchMethodImpl() = default;
     PolymorphicDirectDispatchMethodImpl(const PolymorphicDirectDispatchMethodImpl&) = delete;
     PolymorphicDirectDispatchMethodImpl& operator=(const PolymorphicDirectDispatchMethodImpl&) = delete;
 
+    // Constant initialized, no dynamic initialization is involved
+    static const PolymorphicDirectDispatchMethodImpl Instance;
+
 protected:
     virtual auto dispatchImpl(TMsgBase& msg, THandler& handler) const ->
         MessageInterfaceDispatchRetType<THandler> 
@@ -71,6 +75,10 @@ protected:
     }
 };
 
+template <typename TMsgBase, typename THandler, typename TMessage>
+const PolymorphicDirectDispatchMethodImpl<TMsgBase, THandler, TMessage>
+PolymorphicDirectDispatchMethodImpl<TMsgBase, THandler, TMessage>::Instance{};
+
 template <typename TMsgBase, typename THandler>
 class PolymorphicBinSearchDispatchMethod
 {
@@ -94,7 +102,7 @@ public:
     }
 
 protected:
-    PolymorphicBinSearchDispatchMethod() = default;
+    constexpr PolymorphicBinSearchDispatchMethod() = default;
     ~PolymorphicBinSearchDispatchMethod() = default;
 
     virtual MsgIdParamType getIdImpl() const = 0;
@@ -112,10 +120,12 @@ public:
     using MsgIdParamType = typename Base::MsgIdParamType;
     using MsgIdType = typename Base::MsgIdType;
 
-    PolymorphicBinSearchDispatchMethodImpl() = default;
+    constexpr PolymorphicBinSearchDispatchMethodImpl() = default;
     PolymorphicBinSearchDispatchMethodImpl(const PolymorphicBinSearchDispatchMethodImpl&) = delete;
     PolymorphicBinSearchDispatchMethodImpl& operator=(const PolymorphicBinSearchDispatchMethodImpl&) = delete;
 
+    // Constant initialized, no dynamic initialization is involved
+    static const PolymorphicBinSearchDispatchMethodImpl Instance;
 
     static MsgIdParamType doGetId()
     {
@@ -144,6 +154,10 @@ protected:
     }
 };
 
+template <typename TMsgBase, typename THandler, typename TMessage>
+const PolymorphicBinSearchDispatchMethodImpl<TMsgBase, THandler, TMessage>
+PolymorphicBinSearchDispatchMethodImpl<TMsgBase, THandler, TMessage>::Instance{};
+
 template <typename TMsgBase, typename THandler, std::size_t TSize>
 using PolymorphicDirectDispatchMsgRegistry = 
     std::array<const PolymorphicDirectDispatchMethod<TMsgBase, THandler>*, TSize>;
@@ -152,94 +166,75 @@ template <typename TMsgBase, typename THandler, std::size_t TSize>
 using PolymorphicBinSearchDispatchMsgRegistry = 
     std::array<const PolymorphicBinSearchDispatchMethod<TMsgBase, THandler>*, TSize>;
 
+// The registries below are initialized with the addresses of the constant
+// initialized objects only, i.e. they are constant initialized themselves 
+// (reside in the read-only memory) and don't require any dynamic initialization
+// at startup.
 
-template <typename TMsgBase, typename THandler>
-class PolymorphicDirectDispatchRegistryFiller
+template <typename TMsgBase, typename THandler, typename TAllMessages, typename TIndices>
+class PolymorphicDirectDispatchRegistryTable;
+
+template <typename TMsgBase, typename THandler, typename... TMsgs, std::size_t... TIndices>
+class PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >
 {
-public:
+    using Info = DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >;
+    using IdNumType = typename Info::IdNumType;
     using DispatchMethod = PolymorphicDirectDispatchMethod<TMsgBase, THandler>;
-    PolymorphicDirectDispatchRegistryFiller(const DispatchMethod** registry)
-      : m_registry(registry)
-    {
-    }
 
-    template <typename TMessage>
-    void operator()()
+public:
+    using Registry = PolymorphicDirectDispatchMsgRegistry<TMsgBase, THandler, sizeof...(TIndices)>;
+    static const Registry Value;
+
+    static constexpr const DispatchMethod* entry(std::size_t idx)
     {
-        static_assert(comms::isMessageBase<TMessage>(), "Must be actual message");
-        static_assert(messageHasStaticNumId<TMessage>(), "Message must define static ID");
-        static const PolymorphicDirectDispatchMethodImpl<TMsgBase, THandler, TMessage> Method{};
-        m_registry[static_cast<std::size_t>(TMessage::doGetId())] = &Method;
+        return (idx < Info::Count) ? Methods[idx] : nullptr;
     }
+
 private:
-    const DispatchMethod** m_registry;
+    static constexpr const DispatchMethod* Methods[sizeof...(TMsgs)] = {
+        &PolymorphicDirectDispatchMethodImpl<TMsgBase, THandler, TMsgs>::Instance...
+    };
 };
 
-template <typename TMsgBase, typename THandler, std::size_t TSize>
-PolymorphicDirectDispatchRegistryFiller<TMsgBase, THandler>
-polymorphicDirectDispatchMakeRegistryFiller(
-    PolymorphicDirectDispatchMsgRegistry<TMsgBase, THandler, TSize>& registry)
-{
-    return PolymorphicDirectDispatchRegistryFiller<TMsgBase, THandler>(&registry[0]);
-}
+template <typename TMsgBase, typename THandler, typename... TMsgs, std::size_t... TIndices>
+constexpr const PolymorphicDirectDispatchMethod<TMsgBase, THandler>* 
+PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Methods[sizeof...(TMsgs)];
 
-template <typename TRegistry, typename TAllMessages>
-class PolymorphicDirectDispatchRegistryInitializer
-{
-public:
-    PolymorphicDirectDispatchRegistryInitializer() = delete;
-    PolymorphicDirectDispatchRegistryInitializer(const PolymorphicDirectDispatchRegistryInitializer&) = delete;
-    explicit PolymorphicDirectDispatchRegistryInitializer(TRegistry& registry)
-    {
-        std::fill(registry.begin(), registry.end(), nullptr);
-        comms::util::tupleForEachType<TAllMessages>(polymorphicDirectDispatchMakeRegistryFiller(registry));
-    }
-};
+template <typename TMsgBase, typename THandler, typename... TMsgs, std::size_t... TIndices>
+const typename PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Registry
+PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Value = {{
+    entry(Info::firstIdx(static_cast<IdNumType>(TIndices)))...
+}};
 
 template <typename TMsgBase, typename THandler>
-class PolymorphicBinSearchDispatchRegistryFiller
+class PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<>, DispatchMsgJumpTableIndices<> >
 {
 public:
-    using DispatchMethod = PolymorphicBinSearchDispatchMethod<TMsgBase, THandler>;
-    PolymorphicBinSearchDispatchRegistryFiller(const DispatchMethod** registry)
-      : m_registry(registry)
-    {
-    }
-
-    template <typename TMessage>
-    void operator()()
-    {
-        static_assert(comms::isMessageBase<TMessage>(), "Must be actual message");
-        static_assert(messageHasStaticNumId<TMessage>(), "Message must define static ID");
-        static const PolymorphicBinSearchDispatchMethodImpl<TMsgBase, THandler, TMessage> Method{};
-        m_registry[m_idx] = &Method;
-        ++m_idx;
-    }
-    
-private:
-    const DispatchMethod** m_registry;
-    std::size_t m_idx = 0U;
+    using Registry = PolymorphicDirectDispatchMsgRegistry<TMsgBase, THandler, 0U>;
+    static const Registry Value;
 };
 
-template <typename TMsgBase, typename THandler, std::size_t TSize>
-PolymorphicBinSearchDispatchRegistryFiller<TMsgBase, THandler>
-polymorphicBinSearchDispatchMakeRegistryFiller(
-    PolymorphicBinSearchDispatchMsgRegistry<TMsgBase, THandler, TSize>& registry)
-{
-    return PolymorphicBinSearchDispatchRegistryFiller<TMsgBase, THandler>(&registry[0]);
-}
+template <typename TMsgBase, typename THandler>
+const typename PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<>, DispatchMsgJumpTableIndices<> >::Registry
+PolymorphicDirectDispatchRegistryTable<TMsgBase, THandler, std::tuple<>, DispatchMsgJumpTableIndices<> >::Value = {{}};
+
+template <typename TMsgBase, typename THandler, typename TAllMessages>
+class PolymorphicBinSearchDispatchRegistryTable;
 
-template <typename TRegistry, typename TAllMessages>
-class PolymorphicBinSearchDispatchRegistryInitializer
+template <typename TMsgBase, typename THandler, typename... TMsgs>
+class PolymorphicBinSearchDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...> >
 {
 public:
-    explicit PolymorphicBinSearchDispatchRegistryInitializer(TRegistry& registry)
-    {
-        std::fill(registry.begin(), registry.end(), nullptr);
-        comms::util::tupleForEachType<TAllMessages>(polymorphicBinSearchDispatchMakeRegistryFiller(registry));
-    }
+    using Registry = PolymorphicBinSearchDispatchMsgRegistry<TMsgBase, THandler, sizeof...(TMsgs)>;
+    static const Registry Value;
 };
 
+template <typename TMsgBase, typename THandler, typename... TMsgs>
+const typename PolymorphicBinSearchDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...> >::Registry
+PolymorphicBinSearchDispatchRegistryTable<TMsgBase, THandler, std::tuple<TMsgs...> >::Value = {{
+    &PolymorphicBinSearchDispatchMethodImpl<TMsgBase, THandler, TMsgs>::Instance...
+}};
+
 template <typename TAllMessages, std::size_t TMaxSize>
 class PolymorphicDirectDispatchRegSizeDetect
 {
@@ -269,60 +264,45 @@ public:
         MessageInterfaceDispatchRetType<
             typename std::decay<decltype(handler)>::type>
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(s_initializer);
-
         using RetType = 
             MessageInterfaceDispatchRetType<
                 typename std::decay<decltype(handler)>::type>;
 
+        auto& registry = Table::Value;
         auto regIdx = static_cast<std::size_t>(id);
-        if ((s_registry.size() <= regIdx) ||
-            (s_registry[regIdx] == nullptr)) {
+        if ((registry.size() <= regIdx) ||
+            (registry[regIdx] == nullptr)) {
             return static_cast<RetType>(handler.handle(msg));
         }
 
-        return static_cast<RetType>(s_registry[regIdx]->dispatch(msg, handler));
+        return static_cast<RetType>(registry[regIdx]->dispatch(msg, handler));
     }
 
 private:
     static const std::size_t RegistrySize = 
         PolymorphicDirectDispatchRegSizeDetect<TAllMessages, std::tuple_size<TAllMessages>::value>::Value;
-    using Registry = PolymorphicDirectDispatchMsgRegistry<TMsgBase, THandler, RegistrySize>;
-    using Initializer = PolymorphicDirectDispatchRegistryInitializer<Registry, TAllMessages>;
-
-    static Registry s_registry;
-    static const Initializer s_initializer;
+    using Table = 
+        PolymorphicDirectDispatchRegistryTable<
+            TMsgBase, 
+            THandler, 
+            TAllMessages, 
+            DispatchMsgJumpTableMakeIndices<RegistrySize> 
+        >;
 };
 
-template <typename TAllMessages, typename TMsgBase, typename THandler>
-typename DispatchMsgDirectPolymorphicHelper<TAllMessages, TMsgBase, THandler>::Registry 
-DispatchMsgDirectPolymorphicHelper<TAllMessages, TMsgBase, THandler>::s_registry;
-
-template <typename TAllMessages, typename TMsgBase, typename THandler>
-const typename DispatchMsgDirectPolymorphicHelper<TAllMessages, TMsgBase, THandler>::Initializer 
-DispatchMsgDirectPolymorphicHelper<TAllMessages, TMsgBase, THandler>::s_initializer(s_registry);
-
 template <typename TAllMessages, typename TMsgBase, typename THandler>
 class DispatchMsgBinSearchPolymorphicHelperBase
 {
 protected:
-    static const std::size_t RegistrySize = std::tuple_size<TAllMessages>::value;
-    using Registry = PolymorphicBinSearchDispatchMsgRegistry<TMsgBase, THandler, RegistrySize>;
-    using Initializer = PolymorphicBinSearchDispatchRegistryInitializer<Registry, TAllMessages>;
+    using Table = PolymorphicBinSearchDispatchRegistryTable<TMsgBase, THandler, TAllMessages>;
+    using Registry = typename Table::Registry;
 
-    static Registry s_registry;
-    static Initializer s_initializer;
+    static const Registry& registry()
+    {
+        return Table::Value;
+    }
 };
 
-template <typename TAllMessages, typename TMsgBase, typename THandler>
-typename DispatchMsgBinSearchPolymorphicHelperBase<TAllMessages, TMsgBase, THandler>::Registry 
-DispatchMsgBinSearchPolymorphicHelperBase<TAllMessages, TMsgBase, THandler>::s_registry;
-
-template <typename TAllMessages, typename TMsgBase, typename THandler>
-typename DispatchMsgBinSearchPolymorphicHelperBase<TAllMessages, TMsgBase, THandler>::Initializer 
-DispatchMsgBinSearchPolymorphicHelperBase<TAllMessages, TMsgBase, THandler>::s_initializer(s_registry);
-
 template <typename TAllMessages, typename TMsgBase, typename THandler>
 class DispatchMsgBinSearchStrongPolymorphicHelper : public
     DispatchMsgBinSearchPolymorphicHelperBase<TAllMessages, TMsgBase, THandler>
@@ -336,23 +316,21 @@ public:
         MessageInterfaceDispatchRetType<
             typename std::decay<decltype(handler)>::type>
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(Base::s_initializer);
-
+        auto& registry = Base::registry();
         using RetType = 
             MessageInterfaceDispatchRetType<
                 typename std::decay<decltype(handler)>::type>;
 
         auto iter = 
             std::lower_bound(
-                Base::s_registry.begin(), Base::s_registry.end(), id, 
+                registry.begin(), registry.end(), id, 
                 [](typename Registry::value_type method, MsgIdParamType idParam) -> bool
                 {
                     COMMS_ASSERT(method != nullptr);
                     return method->getId() < idParam;
                 });
 
-        if ((iter == Base::s_registry.end()) || ((*iter)->getId() != id)) {
+        if ((iter == registry.end()) || ((*iter)->getId() != id)) {
             return static_cast<RetType>(handler.handle(msg));    
         }
 
@@ -372,9 +350,7 @@ public:
         MessageInterfaceDispatchRetType<
             typename std::decay<decltype(handler)>::type>
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(Base::s_initializer);
-
+        auto& registry = Base::registry();
         using RetType = 
             MessageInterfaceDispatchRetType<
                 typename std::decay<decltype(handler)>::type>;
@@ -383,21 +359,21 @@ public:
 
         auto lowerIter = 
             std::lower_bound(
-                Base::s_registry.begin(), Base::s_registry.end(), id, 
+                registry.begin(), registry.end(), id, 
                 [](typename Registry::value_type method, IdType idParam) -> bool
                 {
                     COMMS_ASSERT(method != nullptr);
                     return static_cast<IdType>(method->getId()) < idParam;
                 });
 
-        if ((lowerIter == Base::s_registry.end()) || 
+        if ((lowerIter == registry.end()) || 
             (static_cast<IdType>((*lowerIter)->getId()) != id)) {
             return static_cast<RetType>(handler.handle(msg));    
         }
 
         auto upperIter = 
             std::upper_bound(
-                lowerIter, Base::s_registry.end(), id,
+                lowerIter, registry.end(), id,
                 [](IdType idParam, typename Registry::value_type method)
                 {
                     return idParam < static_cast<IdType>(method->getId());
@@ -807,7 +783,7 @@ public:
     }
 
 protected:
-    PolymorphicTypeDirectDispatchMethod() = default;
+    constexpr PolymorphicTypeDirectDispatchMethod() = default;
     ~PolymorphicTypeDirectDispatchMethod() = default;
 
     virtual void dispatchImpl(THandler& handler) const = 0;
@@ -818,10 +794,13 @@ class PolymorphicTypeDirectDispatchMethodImpl : public
                 PolymorphicTypeDirectDispatchMethod<THandler>
 {
 public:
-    PolymorphicTypeDirectDispatchMethodImpl() = default;
+    constexpr PolymorphicTypeDirectDispatchMethodImpl() = default;
     PolymorphicTypeDirectDispatchMethodImpl(const PolymorphicTypeDirectDispatchMethodImpl&) = delete;
     PolymorphicTypeDirectDispatchMethodImpl& operator=(const PolymorphicTypeDirectDispatchMethodImpl&) = delete;
 
+    // Constant initialized, no dynamic initialization is involved
+    static const PolymorphicTypeDirectDispatchMethodImpl Instance;
+
 protected:
     virtual void dispatchImpl(THandler& handler) const 
 #ifndef COMMS_COMPILER_GCC47        
@@ -832,6 +811,10 @@ protected:
     }
 };
 
+template <typename THandler, typename TMessage>
+const PolymorphicTypeDirectDispatchMethodImpl<THandler, TMessage>
+PolymorphicTypeDirectDispatchMethodImpl<THandler, TMessage>::Instance{};
+
 template <typename TMsgIdType, typename THandler>
 class PolymorphicTypeBinSearchDispatchMethod
 {
@@ -850,7 +833,7 @@ public:
     }
 
 protected:
-    PolymorphicTypeBinSearchDispatchMethod() = default;
+    constexpr PolymorphicTypeBinSearchDispatchMethod() = default;
     ~PolymorphicTypeBinSearchDispatchMethod() = default;
 
     virtual TMsgIdType getIdImpl() const = 0;
@@ -863,10 +846,13 @@ class PolymorphicTypeBinSearchDispatchMethodImpl : public
 {
     using Base = PolymorphicTypeBinSearchDispatchMethod<TMsgIdType, THandler>;
 public:
-    PolymorphicTypeBinSearchDispatchMethodImpl() = default;
+    constexpr PolymorphicTypeBinSearchDispatchMethodImpl() = default;
     PolymorphicTypeBinSearchDispatchMethodImpl(const PolymorphicTypeBinSearchDispatchMethodImpl&) = delete;
     PolymorphicTypeBinSearchDispatchMethodImpl& operator=(const PolymorphicTypeBinSearchDispatchMethodImpl&) = delete;
 
+    // Constant initialized, no dynamic initialization is involved
+    static const PolymorphicTypeBinSearchDispatchMethodImpl Instance;
+
     static TMsgIdType doGetId()
     {
         return dispatchMsgGetMsgId<TMessage>();
@@ -890,6 +876,10 @@ protected:
     }
 };
 
+template <typename TMsgIdType, typename THandler, typename TMessage>
+const PolymorphicTypeBinSearchDispatchMethodImpl<TMsgIdType, THandler, TMessage>
+PolymorphicTypeBinSearchDispatchMethodImpl<TMsgIdType, THandler, TMessage>::Instance{};
+
 template <typename THandler, std::size_t TSize>
 using PolymorphicTypeDirectDispatchMsgRegistry = 
     std::array<const PolymorphicTypeDirectDispatchMethod<THandler>*, TSize>;
@@ -898,93 +888,58 @@ template <typename TMsgIdType, typename THandler, std::size_t TSize>
 using PolymorphicTypeBinSearchDispatchMsgRegistry = 
     std::array<const PolymorphicTypeBinSearchDispatchMethod<TMsgIdType, THandler>*, TSize>;
 
-template <typename THandler>
-class PolymorphicTypeDirectDispatchRegistryFiller
-{
-public:
-    using DispatchMethod = PolymorphicTypeDirectDispatchMethod<THandler>;
-    PolymorphicTypeDirectDispatchRegistryFiller(const DispatchMethod** registry)
-      : m_registry(registry)
-    {
-    }
-
-    template <typename TMessage>
-    void operator()()
-    {
-        static_assert(comms::isMessageBase<TMessage>(), "Must be actual message");
-        static_assert(messageHasStaticNumId<TMessage>(), "Message must define static ID");
-        static const PolymorphicTypeDirectDispatchMethodImpl<THandler, TMessage> Method{};
-        m_registry[static_cast<std::size_t>(TMessage::doGetId())] = &Method;
-    }
-private:
-    const DispatchMethod** m_registry;
-};
+template <typename THandler, typename TAllMessages, typename TIndices>
+class PolymorphicTypeDirectDispatchRegistryTable;
 
-template <typename THandler, std::size_t TSize>
-PolymorphicTypeDirectDispatchRegistryFiller<THandler>
-polymorphicTypeDirectDispatchMakeRegistryFiller(
-    PolymorphicTypeDirectDispatchMsgRegistry<THandler, TSize>& registry)
+template <typename THandler, typename... TMsgs, std::size_t... TIndices>
+class PolymorphicTypeDirectDispatchRegistryTable<THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >
 {
-    return PolymorphicTypeDirectDispatchRegistryFiller<THandler>(&registry[0]);
-}
+    using Info = DispatchMsgJumpTableInfo<std::tuple<TMsgs...> >;
+    using IdNumType = typename Info::IdNumType;
+    using DispatchMethod = PolymorphicTypeDirectDispatchMethod<THandler>;
 
-template <typename TRegistry, typename TAllMessages>
-class PolymorphicTypeDirectDispatchRegistryInitializer
-{
 public:
-    PolymorphicTypeDirectDispatchRegistryInitializer() = delete;
-    PolymorphicTypeDirectDispatchRegistryInitializer(const PolymorphicTypeDirectDispatchRegistryInitializer&) = delete;
-    explicit PolymorphicTypeDirectDispatchRegistryInitializer(TRegistry& registry)
-    {
-        std::fill(registry.begin(), registry.end(), nullptr);
-        comms::util::tupleForEachType<TAllMessages>(polymorphicTypeDirectDispatchMakeRegistryFiller(registry));
-    }
-};
+    using Registry = PolymorphicTypeDirectDispatchMsgRegistry<THandler, sizeof...(TIndices)>;
+    static const Registry Value;
 
-template <typename TMsgIdType, typename THandler>
-class PolymorphicTypeBinSearchDispatchRegistryFiller
-{
-public:
-    using DispatchMethod = PolymorphicTypeBinSearchDispatchMethod<TMsgIdType, THandler>;
-    PolymorphicTypeBinSearchDispatchRegistryFiller(const DispatchMethod** registry)
-      : m_registry(registry)
+    static constexpr const DispatchMethod* entry(std::size_t idx)
     {
+        return (idx < Info::Count) ? Methods[idx] : nullptr;
     }
 
-    template <typename TMessage>
-    void operator()()
-    {
-        // static_assert(comms::isMessageBase<TMessage>(), "Must be actual message");
-        // static_assert(messageHasStaticNumId<TMessage>(), "Message must define static ID");
-        static const PolymorphicTypeBinSearchDispatchMethodImpl<TMsgIdType, THandler, TMessage> Method{};
-        m_registry[m_idx] = &Method;
-        ++m_idx;
-    }
-    
 private:
-    const DispatchMethod** m_registry;
-    std::size_t m_idx = 0U;
+    static constexpr const DispatchMethod* Methods[sizeof...(TMsgs)] = {
+        &PolymorphicTypeDirectDispatchMethodImpl<THandler, TMsgs>::Instance...
+    };
 };
 
-template <typename TMsgIdType, typename THandler, std::size_t TSize>
-PolymorphicTypeBinSearchDispatchRegistryFiller<TMsgIdType, THandler>
-polymorphicTypeBinSearchDispatchMakeRegistryFiller(
-    PolymorphicTypeBinSearchDispatchMsgRegistry<TMsgIdType, THandler, TSize>& registry)
-{
-    return PolymorphicTypeBinSearchDispatchRegistryFiller<TMsgIdType, THandler>(&registry[0]);
-}
+template <typename THandler, typename... TMsgs, std::size_t... TIndices>
+constexpr const PolymorphicTypeDirectDispatchMethod<THandler>* 
+PolymorphicTypeDirectDispatchRegistryTable<THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Methods[sizeof...(TMsgs)];
+
+template <typename THandler, typename... TMsgs, std::size_t... TIndices>
+const typename PolymorphicTypeDirectDispatchRegistryTable<THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Registry
+PolymorphicTypeDirectDispatchRegistryTable<THandler, std::tuple<TMsgs...>, DispatchMsgJumpTableIndices<TIndices...> >::Value = {{
+    entry(Info::firstIdx(static_cast<IdNumType>(TIndices)))...
+}};
 
-template <typename TRegistry, typename TAllMessages>
-class PolymorphicTypeBinSearchDispatchRegistryInitializer
+template <typename TMsgIdType, typename THandler, typename TAllMessages>
+class PolymorphicTypeBinSearchDispatchRegistryTable;
+
+template <typename TMsgIdType, typename THandler, typename... TMsgs>
+class PolymorphicTypeBinSearchDispatchRegistryTable<TMsgIdType, THandler, std::tuple<TMsgs...> >
 {
 public:
-    explicit PolymorphicTypeBinSearchDispatchRegistryInitializer(TRegistry& registry)
-    {
-        std::fill(registry.begin(), registry.end(), nullptr);
-        comms::util::tupleForEachType<TAllMessages>(polymorphicTypeBinSearchDispatchMakeRegistryFiller(registry));
-    }
+    using Registry = PolymorphicTypeBinSearchDispatchMsgRegistry<TMsgIdType, THandler, sizeof...(TMsgs)>;
+    static const Registry Value;
 };
 
+template <typename TMsgIdType, typename THandler, typename... TMsgs>
+const typename PolymorphicTypeBinSearchDispatchRegistryTable<TMsgIdType, THandler, std::tuple<TMsgs...> >::Registry
+PolymorphicTypeBinSearchDispatchRegistryTable<TMsgIdType, THandler, std::tuple<TMsgs...> >::Value = {{
+    &PolymorphicTypeBinSearchDispatchMethodImpl<TMsgIdType, THandler, TMsgs>::Instance...
+}};
+
 template <typename TAllMessages, typename THandler>
 class DispatchMsgTypeDirectPolymorphicHelper    
 {
@@ -994,37 +949,28 @@ public:
     using MsgIdParamType = typename FirstMsgType::MsgIdParamType;
     static bool dispatch(MsgIdParamType id, THandler& handler)
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(s_initializer);
-
+        auto& registry = Table::Value;
         auto regIdx = static_cast<std::size_t>(id);
-        if ((s_registry.size() <= regIdx) ||
-            (s_registry[regIdx] == nullptr)) {
+        if ((registry.size() <= regIdx) ||
+            (registry[regIdx] == nullptr)) {
             return false;
         }
 
-        s_registry[regIdx]->dispatch(handler);
+        registry[regIdx]->dispatch(handler);
         return true;
     }
 
 private:
     static const std::size_t RegistrySize = 
         PolymorphicDirectDispatchRegSizeDetect<TAllMessages, std::tuple_size<TAllMessages>::value>::Value;
-    using Registry = PolymorphicTypeDirectDispatchMsgRegistry<THandler, RegistrySize>;
-    using Initializer = PolymorphicTypeDirectDispatchRegistryInitializer<Registry, TAllMessages>;
-
-    static Registry s_registry;
-    static const Initializer s_initializer;
+    using Table = 
+        PolymorphicTypeDirectDispatchRegistryTable<
+            THandler, 
+            TAllMessages, 
+            DispatchMsgJumpTableMakeIndices<RegistrySize> 
+        >;
 };
 
-template <typename TAllMessages, typename THandler>
-typename DispatchMsgTypeDirectPolymorphicHelper<TAllMessages, THandler>::Registry 
-DispatchMsgTypeDirectPolymorphicHelper<TAllMessages, THandler>::s_registry;
-
-template <typename TAllMessages, typename THandler>
-const typename DispatchMsgTypeDirectPolymorphicHelper<TAllMessages, THandler>::Initializer 
-DispatchMsgTypeDirectPolymorphicHelper<TAllMessages, THandler>::s_initializer(s_registry);
-
 template <typename TAllMessages, typename THandler>
 class DispatchMsgTypeBinSearchPolymorphicHelperBase
 {
@@ -1035,22 +981,15 @@ protected:
     static_assert(FirstMsgType::hasMsgIdType(), "Message interface class must define its id type");
     using MsgIdParamType = typename FirstMsgType::MsgIdParamType;
 
-    static const std::size_t RegistrySize = std::tuple_size<TAllMessages>::value;
-    using Registry = PolymorphicTypeBinSearchDispatchMsgRegistry<MsgIdParamType, THandler, RegistrySize>;
-    using Initializer = PolymorphicTypeBinSearchDispatchRegistryInitializer<Registry, TAllMessages>;
+    using Table = PolymorphicTypeBinSearchDispatchRegistryTable<MsgIdParamType, THandler, TAllMessages>;
+    using Registry = typename Table::Registry;
 
-    static Registry s_registry;
-    static Initializer s_initializer;
+    static const Registry& registry()
+    {
+        return Table::Value;
+    }
 };
 
-template <typename TAllMessages, typename THandler>
-typename DispatchMsgTypeBinSearchPolymorphicHelperBase<TAllMessages, THandler>::Registry 
-DispatchMsgTypeBinSearchPolymorphicHelperBase<TAllMessages, THandler>::s_registry;
-
-template <typename TAllMessages, typename THandler>
-typename DispatchMsgTypeBinSearchPolymorphicHelperBase<TAllMessages, THandler>::Initializer 
-DispatchMsgTypeBinSearchPolymorphicHelperBase<TAllMessages, THandler>::s_initializer(s_registry);
-
 template <typename TAllMessages, typename THandler>
 class DispatchMsgTypeBinSearchStrongPolymorphicHelper : public
     DispatchMsgTypeBinSearchPolymorphicHelperBase<TAllMessages, THandler>
@@ -1061,19 +1000,17 @@ public:
     using MsgIdParamType = typename Base::MsgIdParamType;
     static bool dispatch(MsgIdParamType id, THandler& handler)
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(Base::s_initializer);
-
+        auto& registry = Base::registry();
         auto iter = 
             std::lower_bound(
-                Base::s_registry.begin(), Base::s_registry.end(), id, 
+                registry.begin(), registry.end(), id, 
                 [](typename Registry::value_type method, MsgIdParamType idParam) -> bool
                 {
                     COMMS_ASSERT(method != nullptr);
                     return method->getId() < idParam;
                 });
 
-        if ((iter == Base::s_registry.end()) || ((*iter)->getId() != id)) {
+        if ((iter == registry.end()) || ((*iter)->getId() != id)) {
             return false;    
         }
 
@@ -1093,27 +1030,25 @@ public:
     using MsgIdParamType = typename Base::MsgIdParamType;
     static bool dispatch(MsgIdParamType id, std::size_t offset, THandler& handler)
     {
-        // Access initializer object to ensure it hasn't been erased by the optimizer
-        static_cast<void>(Base::s_initializer);
-
+        auto& registry = Base::registry();
         using IdType = typename std::decay<decltype(id)>::type;
         auto lowerIter = 
             std::lower_bound(
-                Base::s_registry.begin(), Base::s_registry.end(), id, 
+                registry.begin(), registry.end(), id, 
                 [](typename Registry::value_type method, IdType idParam) -> bool
                 {
                     COMMS_ASSERT(method != nullptr);
                     return static_cast<IdType>(method->getId()) < idParam;
                 });
 
-        if ((lowerIter == Base::s_registry.end()) || 
+        if ((lowerIter == registry.end()) || 
             (static_cast<IdType>((*lowerIter)->getId()) != id)) {
             return false;    
         }
 
         auto upperIter = 
             std::upper_bound(
-                lowerIter, Base::s_registry.end(), id,
+                lowerIter, registry.end(), id,
                 [](IdType idParam, typename Registry::value_type method)
                 {
                     return idParam < static_cast<IdType>(method->getId());
@@ -0,0 +1,422 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+#include "comms/CompileControl.h"
+#include "comms/details/tag.h"
+#include "comms/field/tag.h"
+#include "comms/util/Tuple.h"
+#include "comms/util/type_traits.h"
+
+#if COMMS_IS_CPP17 && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif // #if __has_include(<charconv>)
+#endif // #if COMMS_IS_CPP17 && defined(__has_include)
+
+#if defined(__cpp_lib_to_chars) && !defined(COMMS_NO_CPP17_TO_CHARS)
+#define COMMS_JSON_USE_TO_CHARS true
+#else
+#define COMMS_JSON_USE_TO_CHARS false
+#endif
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename...>
+class JsonHelper
+{
+public:
+    template <typename TBuf>
+    static void appendChar(TBuf& buf, char ch)
+    {
+        buf.push_back(ch);
+    }
+
+    template <typename TBuf>
+    static void appendLiteral(TBuf& buf, const char* str)
+    {
+        while (*str != '\0') {
+            appendChar(buf, *str);
+            ++str;
+        }
+    }
+
+    template <typename TBuf>
+    static void appendQuoted(TBuf& buf, const char* str)
+    {
+        appendChar(buf, '"');
+        while (*str != '\0') {
+            appendEscaped(buf, *str);
+            ++str;
+        }
+        appendChar(buf, '"');
+    }
+
+    template <typename TBuf, typename TIter>
+    static void appendQuoted(TBuf& buf, TIter from, TIter to)
+    {
+        appendChar(buf, '"');
+        for (; from != to; ++from) {
+            appendEscaped(buf, static_cast<char>(*from));
+        }
+        appendChar(buf, '"');
+    }
+
+    template <typename TBuf, typename T>
+    static void appendNumber(TBuf& buf, T value)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                std::is_floating_point<T>::value
+            >::template Type<
+                FloatTag,
+                IntTag
+            >;
+
+        appendNumberInternal(buf, value, Tag());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendField(TBuf& buf, const TField& field)
+    {
+        appendFieldInternal(buf, field, typename TField::CommsTag());
+    }
+
+    template <typename TBuf, typename TFields>
+    static void appendMembers(TBuf& buf, const TFields& fields)
+    {
+        appendChar(buf, '{');
+        comms::util::tupleForEachWithTemplateParamIdx(fields, MemberAppendHelper<TBuf>(buf));
+        appendChar(buf, '}');
+    }
+
+private:
+    template <typename... TParams>
+    using FloatTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using IntTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using NamedTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using UnnamedTag = comms::details::tag::Tag4<>;
+
+    template <typename TBuf>
+    class MemberAppendHelper
+    {
+    public:
+        explicit MemberAppendHelper(TBuf& buf) : buf_(buf) {}
+
+        template <std::size_t TIdx, typename TField>
+        void operator()(const TField& field)
+        {
+            if (TIdx != 0U) {
+                appendChar(buf_, ',');
+            }
+
+            using Tag =
+                typename comms::util::LazyShallowConditional<
+                    TField::hasName()
+                >::template Type<
+                    NamedTag,
+                    UnnamedTag
+                >;
+
+            appendMemberName<TIdx>(buf_, field, Tag());
+            appendChar(buf_, ':');
+            appendField(buf_, field);
+        }
+
+    private:
+        TBuf& buf_;
+    };
+
+    template <typename TBuf>
+    class CurrentMemberAppendHelper
+    {
+    public:
+        explicit CurrentMemberAppendHelper(TBuf& buf) : buf_(buf) {}
+
+        template <std::size_t TIdx, typename TField>
+        void operator()(const TField& field)
+        {
+            appendField(buf_, field);
+        }
+
+    private:
+        TBuf& buf_;
+    };
+
+    template <typename TBuf>
+    static void appendEscaped(TBuf& buf, char ch)
+    {
+        static const char HexChars[] = "0123456789abcdef";
+        switch (ch) {
+            case '"': appendLiteral(buf, "\\\""); return;
+            case '\\': appendLiteral(buf, "\\\\"); return;
+            case '\n': appendLiteral(buf, "\\n"); return;
+            case '\r': appendLiteral(buf, "\\r"); return;
+            case '\t': appendLiteral(buf, "\\t"); return;
+            default: break;
+        }
+
+        auto byte = static_cast<unsigned char>(ch);
+        if (byte < 0x20) {
+            appendLiteral(buf, "\\u00");
+            appendChar(buf, HexChars[byte >> 4U]);
+            appendChar(buf, HexChars[byte & 0xfU]);
+            return;
+        }
+
+        appendChar(buf, ch);
+    }
+
+    template <std::size_t TIdx, typename TBuf, typename TField>
+    static void appendMemberName(TBuf& buf, const TField& field, NamedTag<>)
+    {
+        appendQuoted(buf, field.name());
+    }
+
+    template <std::size_t TIdx, typename TBuf, typename TField>
+    static void appendMemberName(TBuf& buf, const TField& field, UnnamedTag<>)
+    {
+        static_cast<void>(field);
+        appendLiteral(buf, "\"field");
+        appendUnsigned(buf, static_cast<std::uintmax_t>(TIdx));
+        appendChar(buf, '"');
+    }
+
+    template <typename TBuf>
+    static void appendUnsigned(TBuf& buf, std::uintmax_t value)
+    {
+        char digits[std::numeric_limits<std::uintmax_t>::digits10 + 1];
+        std::size_t count = 0U;
+        do {
+            digits[count] = static_cast<char>('0' + (value % 10U));
+            value /= 10U;
+            ++count;
+        } while (value != 0U);
+
+        while (0U < count) {
+            --count;
+            appendChar(buf, digits[count]);
+        }
+    }
+
+    template <typename TBuf, typename T>
+    static void appendNumberInternal(TBuf& buf, T value, IntTag<>)
+    {
+        using ValueType = typename std::decay<T>::type;
+        if (std::is_signed<ValueType>::value && (value < static_cast<ValueType>(0))) {
+            appendChar(buf, '-');
+            // Negate in unsigned arithmetic to handle the minimal value
+            appendUnsigned(buf, static_cast<std::uintmax_t>(0U) - static_cast<std::uintmax_t>(value));
+            return;
+        }
+
+        appendUnsigned(buf, static_cast<std::uintmax_t>(value));
+    }
+
+    template <typename TBuf, typename T>
+    static void appendNumberInternal(TBuf& buf, T value, FloatTag<>)
+    {
+        if (!std::isfinite(value)) {
+            appendLiteral(buf, "null");
+            return;
+        }
+
+        char str[64] = {0};
+        if (!formatFloat(str, sizeof(str), value)) {
+            appendLiteral(buf, "null");
+            return;
+        }
+
+        appendLiteral(buf, str);
+    }
+
+#if COMMS_JSON_USE_TO_CHARS
+    // std::to_chars() is locale independent and produces the shortest
+    // representation that restores the same value when parsed back.
+    template <typename T>
+    static bool formatFloat(char* str, std::size_t size, T value)
+    {
+        auto result = std::to_chars(str, str + size - 1, value);
+        if (result.ec != std::errc()) {
+            return false;
+        }
+
+        *result.ptr = '\0';
+        return true;
+    }
+#else // #if COMMS_JSON_USE_TO_CHARS
+    template <typename T>
+    static bool formatFloat(char* str, std::size_t size, T value)
+    {
+        // Enough digits to restore the same value when parsed back
+        static const int Precision = std::numeric_limits<T>::max_digits10;
+        auto len = std::snprintf(str, size, "%.*g", Precision, static_cast<double>(value));
+        if ((len <= 0) || (size <= static_cast<std::size_t>(len))) {
+            return false;
+        }
+
+        normaliseDecimalPoint(str);
+        return true;
+    }
+#endif // #if COMMS_JSON_USE_TO_CHARS
+
+    // The snprintf() output uses the decimal point of the current C locale,
+    // which may be ',' or even a multibyte sequence. The "%g" conversion
+    // produces only sign, digits, exponent and the decimal point, so replace
+    // anything else with the '.' JSON requires.
+    static void normaliseDecimalPoint(char* str)
+    {
+        auto* out = str;
+        bool replaced = false;
+        for (auto* in = str; *in != '\0'; ++in) {
+            auto ch = *in;
+            bool valid =
+                (('0' <= ch) && (ch <= '9')) ||
+                (ch == '-') || (ch == '+') || (ch == 'e') || (ch == 'E');
+
+            if (valid) {
+                *out = ch;
+                ++out;
+                replaced = false;
+                continue;
+            }
+
+            if (!replaced) {
+                *out = '.';
+                ++out;
+                replaced = true;
+            }
+        }
+
+        *out = '\0';
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Int)
+    {
+        appendNumber(buf, field.value());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Enum)
+    {
+        using ValueType = typename TField::ValueType;
+        using UnderlyingType = typename std::underlying_type<ValueType>::type;
+        appendNumber(buf, static_cast<UnderlyingType>(field.value()));
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Bitmask)
+    {
+        appendNumber(buf, field.value());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Float)
+    {
+        appendNumber(buf, field.value());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::String)
+    {
+        auto& str = field.value();
+        appendQuoted(buf, str.begin(), str.end());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::RawArrayList)
+    {
+        appendChar(buf, '[');
+        bool first = true;
+        for (auto& elem : field.value()) {
+            if (!first) {
+                appendChar(buf, ',');
+            }
+
+            appendNumber(buf, elem);
+            first = false;
+        }
+        appendChar(buf, ']');
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::ArrayList)
+    {
+        appendChar(buf, '[');
+        bool first = true;
+        for (auto&& elem : field.value()) {
+            if (!first) {
+                appendChar(buf, ',');
+            }
+
+            // The storage may provide proxy objects instead of references to elements
+            const typename TField::ElementType& fieldElem = elem;
+            appendField(buf, fieldElem);
+            first = false;
+        }
+        appendChar(buf, ']');
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Bundle)
+    {
+        appendMembers(buf, field.value());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Bitfield)
+    {
+        appendMembers(buf, field.value());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Optional)
+    {
+        if (!field.doesExist()) {
+            appendLiteral(buf, "null");
+            return;
+        }
+
+        appendField(buf, field.field());
+    }
+
+    template <typename TBuf, typename TField>
+    static void appendFieldInternal(TBuf& buf, const TField& field, comms::field::tag::Variant)
+    {
+        if (!field.currentFieldValid()) {
+            appendLiteral(buf, "null");
+            return;
+        }
+
+        field.currentFieldExec(CurrentMemberAppendHelper<TBuf>(buf));
+    }
+};
+
+} // namespace details
+
+} // namespace comms
+
+#undef COMMS_JSON_USE_TO_CHARS
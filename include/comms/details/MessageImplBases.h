@@ -10,6 +10,7 @@
 #include <tuple>
 #include <cstddef>
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 #include "comms/util/Tuple.h"
 #include "comms/details/tag.h"
@@ -36,7 +37,7 @@ public:
         return fields_;
     }
 
-    const AllFields& fields() const
+    COMMS_CONSTEXPR20 const AllFields& fields() const
     {
         return fields_;
     }
@@ -49,6 +50,11 @@ public:
     static constexpr bool doFieldsHaveNonDefaultRefresh()
     {
         return comms::field::basic::CommonFuncs::AnyFieldHasNonDefaultRefreshBoolType<TAllFields...>::value;
+    }
+
+    static constexpr bool doFieldsHaveStrictMaxLength()
+    {
+        return comms::field::basic::CommonFuncs::AllFieldsHaveStrictMaxLengthBoolType<TAllFields...>::value;
     }    
 
     template <typename TIter>
@@ -66,7 +72,7 @@ public:
     }
 
     template <typename TIter>
-    comms::ErrorStatus doWrite(
+    COMMS_CONSTEXPR20 comms::ErrorStatus doWrite(
         TIter& iter,
         std::size_t size) const
     {
@@ -87,7 +93,7 @@ public:
         return util::tupleAccumulate(fields(), true, comms::field::details::FieldValidCheckHelper<>());
     }
 
-    std::size_t doLength() const
+    COMMS_CONSTEXPR20 std::size_t doLength() const
     {
         return util::tupleAccumulate(fields(), static_cast<std::size_t>(0U), comms::field::details::FieldLengthSumCalcHelper<>());
     }
@@ -301,7 +307,7 @@ protected:
     }    
 
     template <std::size_t TIdx, typename TIter>
-    void doWriteNoStatusFrom(TIter& iter) const
+    COMMS_CONSTEXPR20 void doWriteNoStatusFrom(TIter& iter) const
     {
         util::tupleForEachFrom<TIdx>(fields(), makeFieldNoStatusWriter(iter));
     }
@@ -337,15 +343,59 @@ private:
     template <typename... TParams>
     using UseStatusTag = comms::details::tag::Tag2<>;
 
+    template <typename... TParams>
+    using NoFixedPrefixTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FixedPrefixTag = comms::details::tag::Tag4<>;
+
+    static const std::size_t FixedPrefixCount = 
+        comms::field::basic::CommonFuncs::FieldsFixedLengthReadNoStatusPrefixCountIntType<TAllFields...>::value;
+
     template <typename TIter, typename... TParams>
     comms::ErrorStatus doReadInternal(
         TIter& iter,
         std::size_t size,
         UseStatusTag<TParams...>)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                FixedPrefixCount == 0U
+            >::template Type<
+                NoFixedPrefixTag,
+                FixedPrefixTag
+            >;
+
+        return doReadWithStatusInternal(iter, size, Tag());
+    }
+
+    template <typename TIter, typename... TParams>
+    comms::ErrorStatus doReadWithStatusInternal(
+        TIter& iter,
+        std::size_t size,
+        NoFixedPrefixTag<TParams...>)
     {
         return doReadFromAndUpdateLen<0>(iter, size);
     }
 
+    template <typename TIter, typename... TParams>
+    comms::ErrorStatus doReadWithStatusInternal(
+        TIter& iter,
+        std::size_t size,
+        FixedPrefixTag<TParams...>)
+    {
+        // The leading fields have fixed length and don't fail on read,
+        // check the available length only once.
+        static const std::size_t FixedPrefixLength = doMinLengthUntil<FixedPrefixCount>();
+        if (size < FixedPrefixLength) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        doReadNoStatusUntil<FixedPrefixCount>(iter);
+        size -= FixedPrefixLength;
+        return doReadFromAndUpdateLen<FixedPrefixCount>(iter, size);
+    }
+
     template <typename TIter, typename... TParams>
     comms::ErrorStatus doReadInternal(
         TIter& iter,
@@ -370,12 +420,13 @@ private:
     }
 
     template <typename TIter, typename... TParams>
-    comms::ErrorStatus doWriteInternal(
+    COMMS_CONSTEXPR20 comms::ErrorStatus doWriteInternal(
         TIter& iter,
         std::size_t size,
         NoStatusTag<TParams...>) const
     {
-        if (size < doLength()) {
+        if (((!doFieldsHaveStrictMaxLength()) || (size < doMaxLength())) &&
+            (size < doLength())) {
             return comms::ErrorStatus::BufferOverflow;
         }
 
@@ -408,7 +459,7 @@ private:
     }
 
     template <typename TIter>
-    static comms::field::details::FieldWriteNoStatusHelper<TIter> makeFieldNoStatusWriter(TIter& iter)
+    static COMMS_CONSTEXPR20 comms::field::details::FieldWriteNoStatusHelper<TIter> makeFieldNoStatusWriter(TIter& iter)
     {
         return comms::field::details::FieldWriteNoStatusHelper<TIter>(iter);
     }
@@ -440,6 +491,7 @@ public:
     using ContainerBase::doMaxLengthUntil;
     using ContainerBase::doMaxLengthFromUntil;
     using ContainerBase::areFieldsVersionDependent;
+    using ContainerBase::doFieldsHaveStrictMaxLength;
 
 protected:
     ~MessageImplFieldsBase() noexcept = default;
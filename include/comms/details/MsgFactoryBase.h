@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <memory>
 
+#include "comms/CompileControl.h"
 #include "comms/Assert.h"
 #include "comms/util/Tuple.h"
 #include "comms/util/alloc.h"
@@ -20,6 +21,7 @@
 #include "comms/dispatch.h"
 #include "comms/details/message_check.h"
 #include "comms/details/tag.h"
+#include "comms/details/MsgFactoryHotIdCache.h"
 
 namespace comms
 {
@@ -101,12 +103,103 @@ class MsgFactoryBase
             >;
     };    
 
+    template <typename...>
+    struct InPlaceSharedAllocDeepCondWrap
+    {
+        template <
+            typename TInterface,
+            typename TAllocMessages,
+            typename TOrigMessages,
+            typename TId,
+            typename...>        
+        using Type = 
+            typename comms::util::LazyDeepConditional<
+                InterfaceHasVirtualDestructor
+            >::template Type<
+                comms::util::alloc::details::InPlaceSingleSharedDeepCondWrap,
+                comms::util::alloc::details::InPlaceSingleSharedNoVirtualDestructorDeepCondWrap,
+                TInterface,
+                TAllocMessages,
+                TOrigMessages,
+                TId
+            >;
+    };
+
+    template <typename...>
+    struct DynMemorySharedAllocDeepCondWrap
+    {
+        template <
+            typename TInterface,
+            typename TAllocMessages,
+            typename TOrigMessages,
+            typename TId,
+            typename...>        
+        using Type = 
+            typename comms::util::LazyDeepConditional<
+                InterfaceHasVirtualDestructor
+            >::template Type<
+                comms::util::alloc::details::DynMemorySharedDeepCondWrap,
+                comms::util::alloc::details::DynMemorySharedNoVirtualDestructorDeepCondWrap,
+                TInterface,
+                TOrigMessages,
+                TId
+            >;
+    };
+
+    template <typename...>
+    struct UniqueAllocDeepCondWrap
+    {
+        template <
+            typename TInterface,
+            typename TAllocMessages,
+            typename TOrigMessages,
+            typename TId,
+            typename TDefaultType,
+            typename...>
+        using Type =
+            typename comms::util::LazyDeepConditional<
+                ParsedOptionsInternal::HasInPlaceAllocation
+            >::template Type<
+                InPlaceAllocDeepCondWrap,
+                DynMemoryAllocDeepCondWrap,
+                TInterface,
+                TAllocMessages,
+                TOrigMessages,
+                TId,
+                TDefaultType
+            >;
+    };
+
+    template <typename...>
+    struct SharedAllocDeepCondWrap
+    {
+        template <
+            typename TInterface,
+            typename TAllocMessages,
+            typename TOrigMessages,
+            typename TId,
+            typename TDefaultType,
+            typename...>
+        using Type =
+            typename comms::util::LazyDeepConditional<
+                ParsedOptionsInternal::HasInPlaceAllocation
+            >::template Type<
+                InPlaceSharedAllocDeepCondWrap,
+                DynMemorySharedAllocDeepCondWrap,
+                TInterface,
+                TAllocMessages,
+                TOrigMessages,
+                TId,
+                TDefaultType
+            >;
+    };
+
     using Alloc =
         typename comms::util::LazyDeepConditional<
-            ParsedOptionsInternal::HasInPlaceAllocation
+            ParsedOptionsInternal::HasSharedMsgPtr
         >::template Type<
-            InPlaceAllocDeepCondWrap,
-            DynMemoryAllocDeepCondWrap,
+            SharedAllocDeepCondWrap,
+            UniqueAllocDeepCondWrap,
             TMsgBase,
             AllMessagesInternal,
             TAllMessages,
@@ -125,27 +218,17 @@ public:
 
     MsgPtr createMsg(MsgIdParamType id, unsigned idx, CreateFailureReason* reason) const
     {
-        CreateFailureReason reasonTmp = CreateFailureReason::None;
         bool result = false;
-        MsgPtr msg = createMsgInternal(id, idx, result, DestructorTag<>());
-        do {
-            if (msg) {
-                COMMS_ASSERT(result);
-                break;
-            }
-
-            if (!result) {
-                reasonTmp = CreateFailureReason::InvalidId;
-                break;
-            }
-
-            reasonTmp = CreateFailureReason::AllocFailure;
-        } while (false);
-        
-        if (reason != nullptr) {
-            *reason = reasonTmp;
-        }        
+        MsgPtr msg = createMsgInternal(id, idx, result, HotIdCacheTag<>());
+        updateCreateFailureReason(msg, result, reason);
+        return msg;
+    }
 
+    MsgPtr createMsg(MsgIdParamType id, unsigned idx, CreateFailureReason* reason)
+    {
+        bool result = false;
+        MsgPtr msg = createMsgAdaptiveInternal(id, idx, result, HotIdCacheTag<>());
+        updateCreateFailureReason(msg, result, reason);
         return msg;
     }
 
@@ -193,8 +276,22 @@ public:
         return isDispatchLinearSwitchInternal(DispatchTag<>());
     }
 
+    static constexpr bool isDispatchJumpTable()
+    {
+        return isDispatchJumpTableInternal(DispatchTag<>());
+    }
+
+    static constexpr bool hasHotIdCache()
+    {
+        return ParsedOptions::HasHotIdCache;
+    }
+
 protected:
-    MsgFactoryBase() = default;
+    COMMS_CONSTEXPR20 MsgFactoryBase()
+    {
+        seedHotIdCache(LikelyIdsTag<>());
+    }
+
     MsgFactoryBase(const MsgFactoryBase&) = default;
     MsgFactoryBase(MsgFactoryBase&&) = default;
     MsgFactoryBase& operator=(const MsgFactoryBase&) = default;
@@ -270,6 +367,57 @@ private:
             NonVirtualDestructorTag
         >;
 
+    template <typename... TParams>
+    using HotIdCacheEnabledTag = comms::details::tag::Tag7<>;
+
+    template <typename... TParams>
+    using NoHotIdCacheTag = comms::details::tag::Tag8<>;
+
+    template <typename...>
+    using HotIdCacheTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptions::HasHotIdCache
+        >::template Type<
+            HotIdCacheEnabledTag,
+            NoHotIdCacheTag
+        >;
+
+    template <typename...>
+    using LikelyIdsTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptions::HasLikelyIds
+        >::template Type<
+            HotIdCacheEnabledTag,
+            NoHotIdCacheTag
+        >;
+
+    using CreateFunc = MsgPtr (*)(Alloc& alloc, MsgIdParamType id, unsigned idx);
+
+    template <typename...>
+    struct HotIdCacheDeepCondWrap
+    {
+        template <typename TId, typename TFunc, typename TSize, typename...>
+        using Type = MsgFactoryHotIdCache<TId, TFunc, TSize::value>;
+    };
+
+    template <typename...>
+    struct NoHotIdCacheDeepCondWrap
+    {
+        template <typename...>
+        using Type = comms::util::EmptyStruct<>;
+    };
+
+    using HotIdCache =
+        typename comms::util::LazyDeepConditional<
+            ParsedOptions::HasHotIdCache
+        >::template Type<
+            HotIdCacheDeepCondWrap,
+            NoHotIdCacheDeepCondWrap,
+            MsgIdType,
+            CreateFunc,
+            std::integral_constant<std::size_t, ParsedOptions::HotIdCacheSize>
+        >;
+
     class CreateHandler
     {
     public:
@@ -319,6 +467,93 @@ private:
         MsgPtr msg_;
     };
 
+    class CreateFuncResolveHandler
+    {
+    public:
+        explicit CreateFuncResolveHandler(CreateFunc& func) : func_(func) {}
+
+        template <typename T>
+        void handle()
+        {
+            func_ = &MsgFactoryBase::template createCachedMsg<T>;
+        }
+
+    private:
+        CreateFunc& func_;
+    };
+
+    template <typename T>
+    static MsgPtr createCachedMsg(Alloc& a, MsgIdParamType id, unsigned idx)
+    {
+        return createCachedMsgInternal<T>(a, id, idx, DestructorTag<>());
+    }
+
+    template <typename T, typename... TParams>
+    static MsgPtr createCachedMsgInternal(Alloc& a, MsgIdParamType id, unsigned idx, VirtualDestructorTag<TParams...>)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        return a.template alloc<T>();
+    }
+
+    template <typename T, typename... TParams>
+    static MsgPtr createCachedMsgInternal(Alloc& a, MsgIdParamType id, unsigned idx, NonVirtualDestructorTag<TParams...>)
+    {
+        return a.template alloc<T>(id, idx);
+    }
+
+    template <typename...>
+    struct LikelyIdsSeedHelper;
+
+    template <std::intmax_t... TIds>
+    struct LikelyIdsSeedHelper<comms::option::app::MsgFactoryLikelyIds<TIds...> >
+    {
+        static void seed(HotIdCache& cache)
+        {
+            static const MsgIdType Ids[] = {static_cast<MsgIdType>(TIds)...};
+            for (auto id : Ids) {
+                CreateFunc func = nullptr;
+                CreateFuncResolveHandler handler(func);
+                if (dispatchMsgTypeInternal(id, 0U, handler, DispatchTag<>())) {
+                    cache.insert(id, func);
+                }
+            }
+        }
+    };
+
+    static void updateCreateFailureReason(const MsgPtr& msg, bool result, CreateFailureReason* reason)
+    {
+        CreateFailureReason reasonTmp = CreateFailureReason::None;
+        do {
+            if (msg) {
+                COMMS_ASSERT(result);
+                break;
+            }
+
+            if (!result) {
+                reasonTmp = CreateFailureReason::InvalidId;
+                break;
+            }
+
+            reasonTmp = CreateFailureReason::AllocFailure;
+        } while (false);
+
+        if (reason != nullptr) {
+            *reason = reasonTmp;
+        }
+    }
+
+    template <typename... TParams>
+    COMMS_CONSTEXPR20 void seedHotIdCache(HotIdCacheEnabledTag<TParams...>)
+    {
+        LikelyIdsSeedHelper<typename ParsedOptions::LikelyIds>::seed(hotIdCache_);
+    }
+
+    template <typename... TParams>
+    COMMS_CONSTEXPR20 void seedHotIdCache(NoHotIdCacheTag<TParams...>)
+    {
+    }
+
     template <typename... TParams>
     MsgPtr createGenericMsgInternal(MsgIdParamType id, unsigned idx, AllocGenericTag<TParams...>, VirtualDestructorTag<TParams...>) const
     {
@@ -373,6 +608,12 @@ private:
         return comms::dispatchMsgTypeStaticBinSearch<AllMessages>(id, idx, handler);    
     }
 
+    template <typename THandler>
+    static bool dispatchMsgTypeInternal(MsgIdParamType id, unsigned idx, THandler& handler, comms::traits::dispatch::JumpTable)
+    {
+        return comms::dispatchMsgTypeJumpTable<AllMessages>(id, idx, handler);
+    }
+
     template <typename... TParams>
     static constexpr bool isDispatchPolymorphicInternal(ForcedTag<TParams...>)
     {
@@ -409,6 +650,68 @@ private:
         return false;
     }
 
+    template <typename... TParams>
+    static constexpr bool isDispatchJumpTableInternal(ForcedTag<TParams...>)
+    {
+        return std::is_same<comms::traits::dispatch::JumpTable, typename ParsedOptions::ForcedDispatch>::value;
+    }
+
+    template <typename... TParams>
+    static constexpr bool isDispatchJumpTableInternal(StandardTag<TParams...>)
+    {
+        return false;
+    }
+
+    template <typename... TParams>
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, NoHotIdCacheTag<TParams...>) const
+    {
+        return createMsgInternal(id, idx, success, DestructorTag<>());
+    }
+
+    template <typename... TParams>
+    MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, HotIdCacheEnabledTag<TParams...>) const
+    {
+        CreateFunc func = nullptr;
+        if (idx == 0U) {
+            func = hotIdCache_.find(id);
+        }
+
+        if (func == nullptr) {
+            return createMsgInternal(id, idx, success, DestructorTag<>());
+        }
+
+        success = true;
+        return func(alloc_, id, idx);
+    }
+
+    template <typename... TParams>
+    MsgPtr createMsgAdaptiveInternal(MsgIdParamType id, unsigned idx, bool& success, NoHotIdCacheTag<TParams...>) const
+    {
+        return createMsgInternal(id, idx, success, DestructorTag<>());
+    }
+
+    template <typename... TParams>
+    MsgPtr createMsgAdaptiveInternal(MsgIdParamType id, unsigned idx, bool& success, HotIdCacheEnabledTag<TParams...>)
+    {
+        if (idx != 0U) {
+            return createMsgInternal(id, idx, success, DestructorTag<>());
+        }
+
+        CreateFunc func = hotIdCache_.findAndPromote(id);
+        if (func == nullptr) {
+            CreateFuncResolveHandler handler(func);
+            success = dispatchMsgTypeInternal(id, idx, handler, DispatchTag<>());
+            if (!success) {
+                return MsgPtr();
+            }
+
+            hotIdCache_.insert(id, func);
+        }
+
+        success = true;
+        return func(alloc_, id, idx);
+    }
+
     template <typename... TParams>
     MsgPtr createMsgInternal(MsgIdParamType id, unsigned idx, bool& success, VirtualDestructorTag<TParams...>) const
     {
@@ -426,6 +729,7 @@ private:
     }
 
     mutable Alloc alloc_;
+    HotIdCache hotIdCache_;
 };
 
 
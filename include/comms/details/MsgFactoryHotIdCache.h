@@ -0,0 +1,106 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename TId, typename TFunc, std::size_t TSize>
+class MsgFactoryHotIdCache
+{
+    static_assert(0U < TSize, "The cache size must be greater than 0");
+
+public:
+    // Lookup only, the cache is not modified
+    TFunc find(TId id) const
+    {
+        for (auto idx = 0U; idx < count_; ++idx) {
+            if (entries_[idx].id_ == id) {
+                return entries_[idx].func_;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Lookup and update the usage statistics, the entries are kept
+    // sorted by the number of hits, the most frequent ones are checked first.
+    TFunc findAndPromote(TId id)
+    {
+        for (auto idx = 0U; idx < count_; ++idx) {
+            auto& entry = entries_[idx];
+            if (entry.id_ != id) {
+                continue;
+            }
+
+            auto func = entry.func_;
+            ++entry.hits_;
+            if (MaxHits <= entry.hits_) {
+                ageAll();
+            }
+
+            if ((idx != 0U) && (entries_[idx - 1U].hits_ < entry.hits_)) {
+                std::swap(entries_[idx], entries_[idx - 1U]);
+            }
+
+            return func;
+        }
+
+        return nullptr;
+    }
+
+    // Insert the entry after the miss, the least frequently used entry
+    // is aged on every miss and replaced only when it's not used any more.
+    void insert(TId id, TFunc func)
+    {
+        if (count_ < TSize) {
+            entries_[count_] = Entry{id, func, 1U};
+            ++count_;
+            return;
+        }
+
+        auto& last = entries_[TSize - 1U];
+        if (1U < last.hits_) {
+            --last.hits_;
+            return;
+        }
+
+        last = Entry{id, func, 1U};
+    }
+
+private:
+    using HitsType = unsigned;
+    static const HitsType MaxHits = 0xffff;
+
+    struct Entry
+    {
+        TId id_;
+        TFunc func_;
+        HitsType hits_;
+    };
+
+    void ageAll()
+    {
+        for (auto idx = 0U; idx < count_; ++idx) {
+            entries_[idx].hits_ = (entries_[idx].hits_ / 2U) + 1U;
+        }
+    }
+
+    Entry entries_[TSize];
+    std::size_t count_ = 0U;
+};
+
+} // namespace details
+
+} // namespace comms
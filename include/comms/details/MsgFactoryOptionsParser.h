@@ -25,10 +25,15 @@ class MsgFactoryOptionsParser<>
 {
 public:
     static constexpr bool HasInPlaceAllocation = false;
+    static constexpr bool HasSharedMsgPtr = false;
     static constexpr bool HasSupportGenericMessage = false;
     static constexpr bool HasForcedDispatch = false;
+    static constexpr bool HasHotIdCache = false;
+    static constexpr bool HasLikelyIds = false;
+    static constexpr std::size_t HotIdCacheSize = 0U;
 
     using GenericMessage = void;
+    using LikelyIds = comms::option::app::MsgFactoryLikelyIds<>;
 
     template <typename TAll>
     using AllMessages = TAll;
@@ -42,6 +47,14 @@ public:
     static constexpr bool HasInPlaceAllocation = true;
 };
 
+template <typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::app::SharedMsgPtr, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasSharedMsgPtr = true;
+};
+
 template <typename TMsg, typename... TOptions>
 class MsgFactoryOptionsParser<comms::option::app::SupportGenericMessage<TMsg>, TOptions...> :
         public MsgFactoryOptionsParser<TOptions...>
@@ -71,6 +84,29 @@ public:
     using ForcedDispatch = T;
 };
 
+template <std::size_t TSize, typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::app::MsgFactoryHotIdCache<TSize>, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+    using BaseImpl = MsgFactoryOptionsParser<TOptions...>;
+public:
+    static constexpr bool HasHotIdCache = true;
+    static constexpr std::size_t HotIdCacheSize =
+        TSize < BaseImpl::HotIdCacheSize ? BaseImpl::HotIdCacheSize : TSize;
+};
+
+template <std::intmax_t... TIds, typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::app::MsgFactoryLikelyIds<TIds...>, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+    using BaseImpl = MsgFactoryOptionsParser<TOptions...>;
+public:
+    static constexpr bool HasHotIdCache = true;
+    static constexpr bool HasLikelyIds = true;
+    static constexpr std::size_t HotIdCacheSize =
+        sizeof...(TIds) < BaseImpl::HotIdCacheSize ? BaseImpl::HotIdCacheSize : sizeof...(TIds);
+    using LikelyIds = comms::option::app::MsgFactoryLikelyIds<TIds...>;
+};
 
 template <typename... TOptions>
 class MsgFactoryOptionsParser<
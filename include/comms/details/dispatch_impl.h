@@ -10,4 +10,5 @@
 #include "comms/details/DispatchMsgPolymorphicHelper.h"
 #include "comms/details/DispatchMsgStaticBinSearchHelper.h"
 #include "comms/details/DispatchMsgLinearSwitchHelper.h"
+#include "comms/details/DispatchMsgJumpTableHelper.h"
 
@@ -10,6 +10,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include "comms/util/Tuple.h"
 #include "macro_common.h"
 #include "gen_enum.h"
 #include "base_detection.h"
@@ -29,18 +30,18 @@
 #else // #ifdef COMMS_MUST_DEFINE_BASE
 #define COMMS_FIELD_VALUE_ACCESS_FUNC FUNC_AUTO_REF_RETURN(value, decltype(comms::field::toFieldBase(*this).value()))
 #define COMMS_FIELD_VALUE_ACCESS_CONST_FUNC FUNC_AUTO_REF_RETURN_CONST(value, decltype(comms::field::toFieldBase(*this).value()))
-#define COMMS_ACCESS_MEMBER_FIELD_FUNC(T_, t_, n_) FUNC_AUTO_REF_RETURN(COMMS_CONCATENATE(field_, n_), decltype(std::get<COMMS_CONCATENATE(FieldIdx_, n_)>(t_)))
-#define COMMS_ACCESS_MEMBER_FIELD_CONST_FUNC(T_, t_, n_) FUNC_AUTO_REF_RETURN_CONST(COMMS_CONCATENATE(field_, n_), decltype(std::get<COMMS_CONCATENATE(FieldIdx_, n_)>(t_)))
+#define COMMS_ACCESS_MEMBER_FIELD_FUNC(T_, t_, n_) FUNC_AUTO_REF_RETURN(COMMS_CONCATENATE(field_, n_), decltype(comms::util::tupleGet<COMMS_CONCATENATE(FieldIdx_, n_)>(t_)))
+#define COMMS_ACCESS_MEMBER_FIELD_CONST_FUNC(T_, t_, n_) FUNC_AUTO_REF_RETURN_CONST(COMMS_CONCATENATE(field_, n_), decltype(comms::util::tupleGet<COMMS_CONCATENATE(FieldIdx_, n_)>(t_)))
 #define COMMS_MSG_FIELDS_ACCESS_FUNC FUNC_AUTO_REF_RETURN(fields, decltype(comms::toMessageBase(*this).fields()))
 #define COMMS_MSG_FIELDS_ACCESS_CONST_FUNC FUNC_AUTO_REF_RETURN_CONST(fields, decltype(comms::toMessageBase(*this).fields()))
 #endif // #ifdef COMMS_MUST_DEFINE_BASE
 
 #define COMMS_FIELD_ACC_FUNC(T_, t_, n_) \
     COMMS_ACCESS_MEMBER_FIELD_FUNC(T_, t_, n_) {\
-        return std::get<COMMS_CONCATENATE(FieldIdx_, n_)>(t_); \
+        return comms::util::tupleGet<COMMS_CONCATENATE(FieldIdx_, n_)>(t_); \
     } \
     COMMS_ACCESS_MEMBER_FIELD_CONST_FUNC(T_, t_, n_) {\
-        return std::get<COMMS_CONCATENATE(FieldIdx_, n_)>(t_); \
+        return comms::util::tupleGet<COMMS_CONCATENATE(FieldIdx_, n_)>(t_); \
     }
 
 #define COMMS_FIELD_ACC_FUNC_1(T_, t_, n_) COMMS_FIELD_ACC_FUNC(T_, t_, n_)
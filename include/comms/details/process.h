@@ -98,6 +98,34 @@ auto processMsgCastToMsgObj(T& msg) ->
     return ProcessMsgCastToMsgObjHelper<ProcessMsgCastParamIsMessage<T>::value, ProcessMsgCastParamIsMsgPtr<T>::value>::cast(msg);
 }
 
+template <bool TIsMessage, bool TIsMsgPtr>
+struct ProcessMsgResetHelper;
+
+template <>
+struct ProcessMsgResetHelper<true, false>
+{
+    template <typename T>
+    static void reset(T&)
+    {
+    }
+};
+
+template <>
+struct ProcessMsgResetHelper<false, true>
+{
+    template <typename T>
+    static void reset(T& msg)
+    {
+        msg.reset();
+    }
+};
+
+template <typename T>
+void processMsgReset(T& msg)
+{
+    ProcessMsgResetHelper<ProcessMsgCastParamIsMessage<T>::value, ProcessMsgCastParamIsMsgPtr<T>::value>::reset(msg);
+}
+
 } // namespace details
 
 } // namespace  comms
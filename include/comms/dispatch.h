@@ -12,6 +12,7 @@
 #include "comms/CompileControl.h"
 #include "comms/Message.h"
 #include "comms/details/dispatch_impl.h"
+#include "comms/details/DispatchMsgFanOutHandler.h"
 #include "comms/util/type_traits.h"
 #include "comms/details/tag.h"
 
@@ -450,6 +451,156 @@ bool dispatchMsgTypeLinearSwitch(TId&& id, std::size_t index, THandler& handler)
             dispatchType<TAllMessages>(std::forward<TId>(id), index, handler);
 }
 
+/// @brief Dispatch message object into appropriate @b handle() function in the
+///     provided handler using flat jump table behavior.
+/// @details Unlike @ref dispatchMsgLinearSwitch(), which generates a chain of
+///     nested @b switch statements, this function maps the numeric ID into
+///     the index of the message type using a single table lookup followed
+///     by a single indirect call via the table of function pointers.
+///     When the IDs are too sparse for the lookup table (the range of IDs
+///     exceeds 8 times the number of messages) the
+///     @ref dispatchMsgStaticBinSearch() behavior is used instead.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handler Handler object, it's required public interface
+///     is explained in @ref page_dispatch_message_object section of the 
+///     @ref page_dispatch tutorial page.
+/// @return What the called @b handle() member function of handler object returns.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename TMsg,
+    typename THandler>
+auto dispatchMsgJumpTable(TId&& id, TMsg& msg, THandler& handler) ->
+    details::MessageInterfaceDispatchRetType<
+        typename std::decay<decltype(handler)>::type>
+{
+    static_assert(details::allMessagesHaveStaticNumId<TAllMessages>(), 
+        "All messages in the provided tuple must statically define their numeric ID");
+
+    return 
+        details::DispatchMsgJumpTableHelper<>::template dispatch<TAllMessages>(
+            std::forward<TId>(id),
+            msg,
+            handler);
+}
+
+/// @brief Dispatch message object into appropriate @b handle() function in the
+///     provided handler using flat jump table behavior.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] index Index (or offset) of the message type among those having the same ID.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handler Handler object, it's required public interface
+///     is explained in @ref page_dispatch_message_object section of the 
+///     @ref page_dispatch tutorial page.
+/// @return What the called @b handle() member function of handler object returns.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename TMsg,
+    typename THandler>
+auto dispatchMsgJumpTable(TId&& id, std::size_t index, TMsg& msg, THandler& handler) ->
+    details::MessageInterfaceDispatchRetType<
+        typename std::decay<decltype(handler)>::type>
+{
+    static_assert(details::allMessagesHaveStaticNumId<TAllMessages>(), 
+        "All messages in the provided tuple must statically define their numeric ID");
+
+    return 
+        details::DispatchMsgJumpTableHelper<>::template dispatch<TAllMessages>(
+            std::forward<TId>(id),
+            index,
+            msg,
+            handler);
+}
+
+/// @brief Dispatch message object into appropriate @b handle() function in the
+///     provided handler using flat jump table behavior.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handler Handler object, it's required public interface
+///     is explained in @ref page_dispatch_message_object section of the 
+///     @ref page_dispatch tutorial page.
+/// @return What the called @b handle() member function of handler object returns.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TMsg,
+    typename THandler>
+auto dispatchMsgJumpTable(TMsg& msg, THandler& handler) ->
+    details::MessageInterfaceDispatchRetType<
+        typename std::decay<decltype(handler)>::type>
+{
+    static_assert(details::allMessagesHaveStaticNumId<TAllMessages>(), 
+        "All messages in the provided tuple must statically define their numeric ID");
+    using MsgType = typename std::decay<decltype(msg)>::type;
+    static_assert(MsgType::hasGetId(), 
+        "The used message object must provide polymorphic ID retrieval function");
+
+    return 
+        details::DispatchMsgJumpTableHelper<>::template dispatch<TAllMessages>(
+            msg,
+            handler);
+}
+
+/// @brief Dispatch message id into appropriate @b handle() function in the
+///     provided handler using flat jump table behavior.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] handler Handler object, it's required public interface
+///     is explained in @ref page_dispatch_message_type section of the 
+///     @ref page_dispatch tutorial page.
+/// @return @b true in case the appropriate @b handle() member function of the
+///     handler object has been called, @b false otherwise.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename THandler>
+bool dispatchMsgTypeJumpTable(TId&& id, THandler& handler) 
+{
+    static_assert(details::allMessagesHaveStaticNumId<TAllMessages>(), 
+        "All messages in the provided tuple must statically define their numeric ID");
+
+    return 
+        details::DispatchMsgJumpTableHelper<>::template
+            dispatchType<TAllMessages>(std::forward<TId>(id), handler);
+}
+
+/// @brief Dispatch message id into appropriate @b handle() function in the
+///     provided handler using flat jump table behavior.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] index Index (or offset) of the message type among those having the same ID.
+/// @param[in] handler Handler object, it's required public interface
+///     is explained in @ref page_dispatch_message_type section of the 
+///     @ref page_dispatch tutorial page.
+/// @return @b true in case the appropriate @b handle() member function of the
+///     handler object has been called, @b false otherwise.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename THandler>
+bool dispatchMsgTypeJumpTable(TId&& id, std::size_t index, THandler& handler)
+{
+    static_assert(details::allMessagesHaveStaticNumId<TAllMessages>(), 
+        "All messages in the provided tuple must statically define their numeric ID");
+
+    return 
+        details::DispatchMsgJumpTableHelper<>::template
+            dispatchType<TAllMessages>(std::forward<TId>(id), index, handler);
+}
+
 /// @brief Compile time check whether the message object can use its own
 ///     polymorphic @b dispatch() (see @ref page_use_prot_interface_handle)
 ///     when @ref dispatchMsg() is invoked.
@@ -725,6 +876,77 @@ auto dispatchMsg(TMsg& msg, THandler& handler) ->
     return details::DispatchMsgHelper<TAllMessages>::dispatchMsg(msg, handler); 
 }
 
+/// @brief Dispatch message object into appropriate @b handle() function of
+///     every one of the provided handlers.
+/// @details Similar to @ref dispatchMsg(), but the message type is resolved
+///     only once, after which the @b handle() member function of every
+///     handler is invoked (in order) for the resolved type. All the handlers
+///     are known at compile time, which allows the compiler to inline all the calls.
+///     @code
+///     comms::dispatchMsgFanOut<AllMessages>(id, msg, std::tie(router, metrics, recorder));
+///     @endcode
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handlers Handler objects bundled in @b std::tuple of references
+///     (see @b std::tie() or @b std::forward_as_tuple()). Every handler is
+///     expected to have the public interface explained in @ref page_dispatch_message_object
+///     section of the @ref page_dispatch tutorial page. The values returned
+///     by the @b handle() member functions are ignored.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename TMsg,
+    typename THandlers>
+void dispatchMsgFanOut(TId&& id, TMsg& msg, THandlers&& handlers)
+{
+    details::DispatchMsgFanOutHandler<THandlers> handler(handlers);
+    details::DispatchMsgHelper<TAllMessages>::dispatchMsg(std::forward<TId>(id), msg, handler);
+}
+
+/// @brief Dispatch message object into appropriate @b handle() function of
+///     every one of the provided handlers.
+/// @details Similar to other @ref dispatchMsgFanOut(), but also receives
+///     index (or offset) of the message type among those having the same ID.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] id ID of the message known at runtime.
+/// @param[in] index Index (or offset) of the message type among those having the same ID.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handlers Handler objects bundled in @b std::tuple of references.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TId,
+    typename TMsg,
+    typename THandlers>
+void dispatchMsgFanOut(TId&& id, std::size_t index, TMsg& msg, THandlers&& handlers)
+{
+    details::DispatchMsgFanOutHandler<THandlers> handler(handlers);
+    details::DispatchMsgHelper<TAllMessages>::dispatchMsg(std::forward<TId>(id), index, msg, handler);
+}
+
+/// @brief Dispatch message object into appropriate @b handle() function of
+///     every one of the provided handlers.
+/// @details Similar to other @ref dispatchMsgFanOut(), but the message ID is
+///     retrieved from the message object itself.
+/// @tparam TAllMessages @b std::tuple of supported message classes, sorted in
+///     ascending order by their numeric IDs.
+/// @param[in] msg Message object held by reference to its interface class.
+/// @param[in] handlers Handler objects bundled in @b std::tuple of references.
+/// @note Defined in comms/dispatch.h
+template <
+    typename TAllMessages,
+    typename TMsg,
+    typename THandlers>
+void dispatchMsgFanOut(TMsg& msg, THandlers&& handlers)
+{
+    details::DispatchMsgFanOutHandler<THandlers> handler(handlers);
+    details::DispatchMsgHelper<TAllMessages>::dispatchMsg(msg, handler);
+}
+
 /// @brief Dispatch message id into appropriate @b handle() function in the
 ///     provided handler using either "polymorphic" or "static binary search" behavior.
 /// @details The function performs compile time evaluation of the provided @b TAllMessages
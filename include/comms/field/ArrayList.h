@@ -23,7 +23,9 @@
 #include "comms/util/StaticVector.h"
 #include "comms/util/ArrayView.h"
 #include "comms/util/type_traits.h"
+#include "comms/util/ColumnarVector.h"
 #include "basic/ArrayList.h"
+#include "basic/ColumnarArrayList.h"
 #include "details/AdaptBasicField.h"
 #include "details/OptionsParser.h"
 
@@ -119,12 +121,56 @@ template <typename TElement, typename TOpt>
 using ArrayListStorageTypeT =
     typename ArrayListCustomArrayListStorageType<TOpt::HasCustomStorageType>::template Type<TElement, TOpt>;
 
+template <typename...>
+class ArrayListFieldCheckBundle
+{
+public:
+    template <typename T>
+    using Type = std::is_same<typename T::CommsTag, comms::field::tag::Bundle>;
+};
+
+template <typename TElement>
+using ArrayListIsBundleElementBoolType =
+    typename comms::util::LazyDeepConditional<
+        std::is_integral<TElement>::value
+    >::template Type<
+        comms::util::FalseType,
+        ArrayListFieldCheckBundle,
+        TElement
+    >;
+
+template <bool THasColumnarStorage>
+struct ArrayListBasicType;
+
+template <>
+struct ArrayListBasicType<true>
+{
+    template <typename TFieldBase, typename TElement, typename TOpt>
+    using Type =
+        comms::field::basic::ColumnarArrayList<
+            TFieldBase,
+            comms::util::ColumnarVector<TElement>
+        >;
+};
+
+template <>
+struct ArrayListBasicType<false>
+{
+    template <typename TFieldBase, typename TElement, typename TOpt>
+    using Type =
+        comms::field::basic::ArrayList<
+            TFieldBase,
+            ArrayListStorageTypeT<TElement, TOpt>
+        >;
+};
+
 template <typename TFieldBase, typename TElement, typename... TOptions>
 using ArrayListBase =
     AdaptBasicFieldT<
-        comms::field::basic::ArrayList<
+        typename ArrayListBasicType<OptionsParser<TOptions...>::HasColumnarStorage>::template Type<
             TFieldBase,
-            ArrayListStorageTypeT<TElement, OptionsParser<TOptions...> >
+            TElement,
+            OptionsParser<TOptions...>
         >,
         TOptions...
     >;
@@ -187,6 +233,8 @@ using ArrayListBase =
 ///     @li @ref comms::option::app::FixedSizeStorage
 ///     @li @ref comms::option::app::OrigDataView (valid only if TElement is integral type
 ///         of 1 byte size.
+///     @li @ref comms::option::app::ColumnarStorage (valid only if TElement is
+///         @ref comms::field::Bundle of fixed serialisation length).
 
 /// @extends comms::Field
 /// @headerfile comms/field/ArrayList.h
@@ -215,6 +263,8 @@ public:
     ///     ValueType is std::vector<TElement>, otherwise it becomes
     ///     comms::util::StaticVector<TElement, TSize>, where TSize is a size
     ///     provided to @ref comms::option::app::FixedSizeStorage option.
+    ///     If @ref comms::option::app::ColumnarStorage option is used, the
+    ///     ValueType is comms::util::ColumnarVector<TElement>.
     using ValueType = typename BaseImpl::ValueType;
 
     /// @brief Type of the element.
@@ -515,6 +565,13 @@ public:
         return BaseImpl::maxLength();
     }
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref maxLength() is a strict upper limit of the serialisation length.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return BaseImpl::hasStrictMaxLength();
+    }
+
     /// @brief Force number of elements that must be read in the next read()
     ///     invocation.
     /// @details Exists only if @ref comms::option::def::SequenceSizeForcingEnabled option has been
@@ -651,6 +708,20 @@ private:
             "comms::option::def::MissingOnReadFail option is not applicable to ArrayList field");     
     static_assert(!ParsedOptions::HasMissingOnInvalid,
             "comms::option::def::MissingOnInvalid option is not applicable to ArrayList field");                       
+    static_assert((!ParsedOptions::HasColumnarStorage) || details::ArrayListIsBundleElementBoolType<TElement>::value,
+        "Usage of comms::option::app::ColumnarStorage option is allowed only for the list of bundles.");
+    static_assert((!ParsedOptions::HasColumnarStorage) ||
+            ((!ParsedOptions::HasCustomStorageType) &&
+             (!ParsedOptions::HasFixedSizeStorage) &&
+             (!ParsedOptions::HasSequenceFixedSizeUseFixedSizeStorage) &&
+             (!ParsedOptions::HasOrigDataView)),
+        "comms::option::app::ColumnarStorage option is incompatible with other storage type options.");
+    static_assert((!ParsedOptions::HasColumnarStorage) ||
+            ((!ParsedOptions::HasSequenceElemSerLengthFieldPrefix) &&
+             (!ParsedOptions::HasSequenceElemFixedSerLengthFieldPrefix) &&
+             (!ParsedOptions::HasSequenceElemLengthForcing) &&
+             (!ParsedOptions::HasSequenceTerminationFieldSuffix)),
+        "comms::option::app::ColumnarStorage option is incompatible with per element serialisation options.");
 };
 
 /// @brief Equivalence comparison operator.
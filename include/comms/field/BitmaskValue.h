@@ -11,6 +11,7 @@
 #pragma once
 
 #include <limits>
+#include "comms/CompileControl.h"
 #include "comms/Field.h"
 
 #include "comms/util/SizeToType.h"
@@ -293,7 +294,7 @@ public:
     /// @return Status of write operation.
     /// @post Iterator is advanced.
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         return intValue_.write(iter, size);
     }
@@ -311,7 +312,7 @@ public:
     /// @param[in, out] iter Iterator to write the data.
     /// @post Iterator is advanced.
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         intValue_.writeNoStatus(iter);
     }
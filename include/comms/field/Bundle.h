@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
 #include "comms/field/basic/Bundle.h"
@@ -43,8 +44,10 @@ namespace field
 ///     @li @ref comms::option::def::HasCustomRefresh
 ///     @li @ref comms::option::def::HasName
 ///     @li @ref comms::option::def::HasVersionDependentMembers
+///     @li @ref comms::option::def::PresenceBitmaskMemberField
 ///     @li @ref comms::option::def::RemLengthMemberField
 ///     @li @ref comms::option::def::VersionStorage
+///     @li @ref comms::option::app::HostLayoutStorage
 /// @extends comms::Field
 /// @headerfile comms/field/Bundle.h
 /// @see @ref COMMS_FIELD_MEMBERS_NAMES()
@@ -57,7 +60,8 @@ class Bundle : public
         basic::Bundle<
             TFieldBase, 
             details::OptionsParser<TOptions...>::ForcedMembersVersionDependency,
-            TMembers>, 
+            TMembers,
+            details::OptionsParser<TOptions...>::HasHostLayoutStorage>, 
         TOptions...
     >
 {
@@ -66,7 +70,8 @@ class Bundle : public
             basic::Bundle<
                 TFieldBase, 
                 details::OptionsParser<TOptions...>::ForcedMembersVersionDependency,
-                TMembers>, 
+                TMembers,
+                details::OptionsParser<TOptions...>::HasHostLayoutStorage>, 
             TOptions...
         >;    
     static_assert(comms::util::IsTuple<TMembers>::Value,
@@ -94,7 +99,9 @@ public:
 
     /// @brief Value type.
     /// @details Same as TMemebers template argument, i.e. it is std::tuple
-    ///     of all the wrapped fields.
+    ///     of all the wrapped fields. When @ref comms::option::app::HostLayoutStorage
+    ///     option is used and applicable, it is @ref comms::util::PackedTuple
+    ///     of the same fields.
     using ValueType = typename BaseImpl::ValueType;
 
     /// @brief Type of actual extending field specified via 
@@ -191,7 +198,7 @@ public:
     /// @details Summarises all the results returned by the call to length() for
     ///     every field in the bundle.
     /// @return Number of bytes it will take to serialise the field value.
-    std::size_t length() const
+    COMMS_CONSTEXPR20 std::size_t length() const
     {
         return BaseImpl::length();
     }
@@ -280,6 +287,13 @@ public:
         return BaseImpl::maxLength();
     }
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref maxLength() is a strict upper limit of the serialisation length.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return BaseImpl::hasStrictMaxLength();
+    }
+
     /// @brief Get maximal length that is required to serialise specified bundled fields.
     /// @tparam TFromIdx Index of the field (included) from which the counting must start.
     /// @return Minimal number of bytes required to serialise the specified member fields.
@@ -508,7 +522,7 @@ public:
     /// @return Status of write operation.
     /// @post Iterator is advanced.
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         return BaseImpl::write(iter, size);
     }
@@ -577,7 +591,7 @@ public:
     /// @param[in, out] iter Iterator to write the data.
     /// @post Iterator is advanced.
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         BaseImpl::writeNoStatus(iter);
     }
@@ -629,6 +643,26 @@ public:
         BaseImpl::template writeFromUntilNoStatus<TFromIdx, TUntilIdx>(iter);
     }
 
+    /// @brief Compile time check of whether the serialised data of the field
+    ///     is the same as the in-memory representation of its value.
+    /// @details Reports @b true only when the @ref comms::option::app::HostLayoutStorage
+    ///     option is used and applicable (see @ref ValueType), while no option
+    ///     that modifies the (de)serialisation of the members is used.
+    static constexpr bool hasHostLayout()
+    {
+        return 
+            BaseImpl::hasHostLayout() &&
+            (!ParsedOptions::HasEmptySerialization) &&
+            (!ParsedOptions::HasFailOnInvalid) &&
+            (!ParsedOptions::HasIgnoreInvalid) &&
+            (!ParsedOptions::HasCustomRead) &&
+            (!ParsedOptions::HasCustomWrite) &&
+            (!ParsedOptions::HasRemLengthMemberField) &&
+            (!ParsedOptions::HasPresenceBitmaskMemberField) &&
+            (!ParsedOptions::HasMissingOnReadFail) &&
+            (!ParsedOptions::HasMissingOnInvalid);
+    }
+
     /// @brief Check validity of all the bundled fields.
     bool valid() const
     {
@@ -12,6 +12,7 @@
 
 #include <type_traits>
 
+#include "comms/CompileControl.h"
 #include "comms/options.h"
 #include "details/OptionsParser.h"
 #include "basic/EnumValue.h"
@@ -183,7 +184,7 @@ public:
     /// @brief Set value
     /// @details Implemented as re-assigning to @b value(), but can be overriden in the derived class.
     template <typename U>
-    void setValue(U&& val)
+    COMMS_CONSTEXPR20 void setValue(U&& val)
     {
         BaseImpl::setValue(std::forward<U>(val));
     }          
@@ -250,7 +251,7 @@ public:
     /// @return Status of write operation.
     /// @post Iterator is advanced.
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         return BaseImpl::write(iter, size);
     }
@@ -268,7 +269,7 @@ public:
     /// @param[in, out] iter Iterator to write the data.
     /// @post Iterator is advanced.
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         BaseImpl::writeNoStatus(iter);
     }
@@ -248,13 +248,13 @@ public:
     }
 
     /// @brief Get access to integral value storage.
-    const ValueType& value() const
+    COMMS_CONSTEXPR20 const ValueType& value() const
     {
         return BaseImpl::value();
     }
 
     /// @brief Get access to integral value storage.
-    ValueType& value()
+    COMMS_CONSTEXPR20 ValueType& value()
     {
         return BaseImpl::value();
     }
@@ -269,7 +269,7 @@ public:
     /// @brief Set value
     /// @details Implemented as re-assigning to @b value(), but can be overriden in the derived class.
     template <typename U>
-    void setValue(U&& val)
+    COMMS_CONSTEXPR20 void setValue(U&& val)
     {
         BaseImpl::setValue(std::forward<U>(val));
     }        
@@ -378,7 +378,7 @@ public:
     /// @return Status of write operation.
     /// @post Iterator is advanced.
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         return BaseImpl::write(iter, size);
     }
@@ -396,11 +396,33 @@ public:
     /// @param[in, out] iter Iterator to write the data.
     /// @post Iterator is advanced.
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         BaseImpl::writeNoStatus(iter);
     }
 
+    /// @brief Compile time check of whether the serialised data of the field
+    ///     is the same as the in-memory representation of its value.
+    /// @details Reports @b true when the endian is the same as the one of the
+    ///     host and no option that modifies the serialisation (such as
+    ///     @ref comms::option::def::FixedLength or @ref comms::option::def::NumValueSerOffset)
+    ///     is used.
+    static constexpr bool hasHostLayout()
+    {
+        return 
+            BaseImpl::hasHostLayout() &&
+            (!ParsedOptions::HasSerOffset) &&
+            (!ParsedOptions::HasFixedLengthLimit) &&
+            (!ParsedOptions::HasFixedBitLengthLimit) &&
+            (!ParsedOptions::HasVarLengthLimits) &&
+            (!ParsedOptions::HasAvailableLengthLimit) &&
+            (!ParsedOptions::HasEmptySerialization) &&
+            (!ParsedOptions::HasFailOnInvalid) &&
+            (!ParsedOptions::HasIgnoreInvalid) &&
+            (!ParsedOptions::HasCustomRead) &&
+            (!ParsedOptions::HasCustomWrite);
+    }
+
     /// @brief Compile time check if this class is version dependent
     static constexpr bool isVersionDependent()
     {
@@ -272,6 +272,13 @@ public:
         return BaseImpl::maxLength();
     }
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref maxLength() is a strict upper limit of the serialisation length.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return BaseImpl::hasStrictMaxLength();
+    }
+
     /// @brief Check validity of the field value.
     /// @return If field is marked to be missing (mode is OptionalMode::Missing),
     ///     "true" is returned, otherwise valid() member function of the wrapped
@@ -20,6 +20,7 @@
 
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
+#include "comms/util/InternedString.h"
 #include "comms/util/StaticString.h"
 #include "comms/util/StringView.h"
 #include "comms/util/detect.h"
@@ -57,6 +58,27 @@ struct StringOrigDataViewStorageType<false>
     using Type = std::string;
 };
 
+template <bool THasInternedStringStorage>
+struct StringInternedStorageType;
+
+template <>
+struct StringInternedStorageType<true>
+{
+    template <typename TOpt>
+    using Type =
+        comms::util::InternedString<
+            comms::util::InternTable<TOpt::InternedStringStorageCapacity, typename TOpt::InternedStringStorageTag>,
+            TOpt::HasSequenceFixedSize
+        >;
+};
+
+template <>
+struct StringInternedStorageType<false>
+{
+    template <typename TOpt>
+    using Type = typename StringOrigDataViewStorageType<TOpt::HasOrigDataView>::Type;
+};
+
 template <bool THasSequenceFixedSizeUseFixedSizeStorage>
 struct StringFixedSizeUseFixedSizeStorageType;
 
@@ -71,7 +93,7 @@ template <>
 struct StringFixedSizeUseFixedSizeStorageType<false>
 {
     template <typename TOpt>
-    using Type = typename StringOrigDataViewStorageType<TOpt::HasOrigDataView>::Type;
+    using Type = typename StringInternedStorageType<TOpt::HasInternedStringStorage>::template Type<TOpt>;
 };
 
 template <bool THasFixedSizeStorage>
@@ -154,6 +176,7 @@ using StringBase =
 ///     @li @ref comms::option::app::CustomStorageType
 ///     @li @ref comms::option::app::FixedSizeStorage
 ///     @li @ref comms::option::app::OrigDataView
+///     @li @ref comms::option::app::InternedStringStorage
 /// @extends comms::Field
 /// @headerfile comms/field/String.h
 template <typename TFieldBase, typename... TOptions>
@@ -181,6 +204,8 @@ public:
     ///     ValueType is std::string, otherwise it becomes
     ///     comms::util::StaticString<TSize>, where TSize is a size
     ///     provided to @ref comms::option::app::FixedSizeStorage option.
+    ///     If @ref comms::option::app::InternedStringStorage option is used, the
+    ///     ValueType is comms::util::InternedString.
     using ValueType = typename BaseImpl::ValueType;
 
     /// @brief Type of actual extending field specified via 
@@ -478,6 +503,13 @@ public:
         return BaseImpl::maxLength();
     }
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref maxLength() is a strict upper limit of the serialisation length.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return BaseImpl::hasStrictMaxLength();
+    }
+
     /// @brief Force number of characters that must be read in the next read()
     ///     invocation.
     /// @details Exists only if @ref comms::option::def::SequenceSizeForcingEnabled option has been
@@ -636,6 +668,12 @@ private:
             "comms::option::def::MissingOnReadFail option is not applicable to String field");           
     static_assert(!ParsedOptions::HasMissingOnInvalid,
             "comms::option::def::MissingOnInvalid option is not applicable to String field");  
+    static_assert((!ParsedOptions::HasInternedStringStorage) ||
+            ((!ParsedOptions::HasCustomStorageType) &&
+             (!ParsedOptions::HasFixedSizeStorage) &&
+             (!ParsedOptions::HasSequenceFixedSizeUseFixedSizeStorage) &&
+             (!ParsedOptions::HasOrigDataView)),
+        "comms::option::app::InternedStringStorage option is incompatible with other storage type options.");
 };
 
 /// @brief Equality comparison operator.
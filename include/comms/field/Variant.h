@@ -64,6 +64,8 @@ namespace field
 ///         default @ref comms::field::Variant::reset() "reset()" on destruction, assume
 ///         it is called by the extending class destructor.
 ///     @li @ref comms::option::def::VersionStorage - Add version storage.
+///     @li @ref comms::option::app::VariantSpillLargeMembers - Allocate members
+///         exceeding the provided size threshold on the heap.
 /// @extends comms::Field
 /// @headerfile comms/field/Variant.h
 /// @see COMMS_VARIANT_MEMBERS_NAMES()
@@ -75,6 +77,7 @@ class Variant : public
         basic::Variant<
             TFieldBase, 
             details::OptionsParser<TOptions...>::ForcedMembersVersionDependency,
+            details::OptionsParser<TOptions...>::VariantSpillThreshold,
             TMembers
         >, 
         TOptions...>
@@ -84,6 +87,7 @@ class Variant : public
         basic::Variant<
             TFieldBase, 
             details::OptionsParser<TOptions...>::ForcedMembersVersionDependency,
+            details::OptionsParser<TOptions...>::VariantSpillThreshold,
             TMembers
         >, 
         TOptions...>;
@@ -237,6 +241,13 @@ public:
         return BaseImpl::maxLength();
     }
 
+    /// @brief Compile time check of whether the value returned by
+    ///     @ref maxLength() is a strict upper limit of the serialisation length.
+    static constexpr bool hasStrictMaxLength()
+    {
+        return BaseImpl::hasStrictMaxLength();
+    }
+
     /// @brief Read field value from input data sequence
     /// @details Invokes read() member function over every possible field
     ///     in order of definition until comms::ErrorStatus::Success is returned.
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 
 namespace comms
@@ -26,17 +27,17 @@ class DefaultValueInitialiser : public TBase
 public:
     using ValueType = typename BaseImpl::ValueType;
 
-    DefaultValueInitialiser()
+    COMMS_CONSTEXPR20 DefaultValueInitialiser()
     {
         Initialiser()(*this);
     }
 
-    explicit DefaultValueInitialiser(const ValueType& val)
+    explicit COMMS_CONSTEXPR20 DefaultValueInitialiser(const ValueType& val)
       : BaseImpl(val)
     {
     }
 
-    explicit DefaultValueInitialiser(ValueType&& val)
+    explicit COMMS_CONSTEXPR20 DefaultValueInitialiser(ValueType&& val)
       : BaseImpl(std::move(val))
     {
     }
@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <limits>
 
+#include "comms/CompileControl.h"
 #include "comms/Assert.h"
 #include "comms/util/SizeToType.h"
 #include "comms/util/type_traits.h"
@@ -125,7 +126,7 @@ public:
     }
 
     template <typename TIter>
-    comms::ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 comms::ErrorStatus write(TIter& iter, std::size_t size) const
     {
         if (size < length()) {
             return ErrorStatus::BufferOverflow;
@@ -136,7 +137,7 @@ public:
     }
 
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         BaseImpl::template writeData<Length>(toSerialised(BaseImpl::getValue()), iter);
     }
@@ -182,7 +183,7 @@ private:
     }
 
     template <typename... TParams>
-    static SerialisedType adjustToSerialised(BaseSerialisedType val, SignExtendTag<TParams...>)
+    static COMMS_CONSTEXPR20 SerialisedType adjustToSerialised(BaseSerialisedType val, SignExtendTag<TParams...>)
     {
         auto valueTmp =
             static_cast<UnsignedSerialisedType>(val) & UnsignedValueMask;
@@ -0,0 +1,372 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/field/OptionalMode.h"
+#include "comms/field/tag.h"
+#include "comms/util/Tuple.h"
+#include "comms/util/type_traits.h"
+#include "comms/details/tag.h"
+
+namespace comms
+{
+
+namespace field
+{
+
+namespace adapter
+{
+
+template <std::size_t TMaskFieldIdx, typename TBase>
+class PresenceBitmaskMemberField : public TBase
+{
+    using BaseImpl = TBase;
+public:
+    using ValueType = typename BaseImpl::ValueType;
+
+    static_assert(TMaskFieldIdx < std::tuple_size<ValueType>::value, "Bad index");
+    using MaskFieldType = typename std::tuple_element<TMaskFieldIdx, ValueType>::type;
+    using MaskValueType = typename MaskFieldType::ValueType;
+    using VersionType = typename BaseImpl::VersionType;
+
+    static const std::size_t FirstOptionalIdx = TMaskFieldIdx + 1U;
+    static const std::size_t OptionalsCount = std::tuple_size<ValueType>::value - FirstOptionalIdx;
+
+    static_assert(std::is_integral<MaskValueType>::value, "The presence bitmask member must hold integral value");
+    static_assert(OptionalsCount <= static_cast<std::size_t>(std::numeric_limits<MaskValueType>::digits),
+        "Presence bitmask member doesn't have enough bits for all the following members");
+
+    PresenceBitmaskMemberField()
+    {
+        // The "tentative" mode is meaningless when presence is defined by the bitmask
+        comms::util::template tupleForEachFrom<FirstOptionalIdx>(BaseImpl::value(), TentativeResetHelper());
+        refreshMaskInternal();
+    }
+
+    bool refresh()
+    {
+        bool updated = BaseImpl::refresh();
+        return refreshMaskInternal() || updated;
+    }
+
+    template <typename TIter>
+    ErrorStatus read(TIter& iter, std::size_t len)
+    {
+        return readFromUntilAndUpdateLen<0, std::tuple_size<ValueType>::value>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, typename TIter>
+    ErrorStatus readFrom(TIter& iter, std::size_t len)
+    {
+        return readFromUntilAndUpdateLen<TFromIdx, std::tuple_size<ValueType>::value>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, typename TIter>
+    ErrorStatus readFromAndUpdateLen(TIter& iter, std::size_t& len)
+    {
+        return readFromUntilAndUpdateLen<TFromIdx, std::tuple_size<ValueType>::value>(iter, len);
+    }
+
+    template <std::size_t TUntilIdx, typename TIter>
+    ErrorStatus readUntil(TIter& iter, std::size_t len)
+    {
+        return readFromUntilAndUpdateLen<0U, TUntilIdx>(iter, len);
+    }
+
+    template <std::size_t TUntilIdx, typename TIter>
+    ErrorStatus readUntilAndUpdateLen(TIter& iter, std::size_t& len)
+    {
+        return readFromUntilAndUpdateLen<0, TUntilIdx>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+    ErrorStatus readFromUntil(TIter& iter, std::size_t len)
+    {
+        return readFromUntilAndUpdateLen<TFromIdx, TUntilIdx>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+    ErrorStatus readFromUntilAndUpdateLen(TIter& iter, std::size_t& len)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                (TUntilIdx <= TMaskFieldIdx)
+            >::template Type<
+                BaseRedirectTag,
+                LocalTag
+            >;
+        return readFromUntilInternal<TFromIdx, TUntilIdx>(iter, len, Tag());
+    }
+
+    template <typename TIter>
+    void readNoStatus(TIter& iter)
+    {
+        BaseImpl::template readUntilNoStatus<FirstOptionalIdx>(iter);
+        auto mask = static_cast<MaskValueType>(comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value()).getValue());
+        comms::util::template tupleForEachFrom<FirstOptionalIdx>(
+            BaseImpl::value(), PresenceReadNoStatusHelper<TIter>(iter, mask));
+    }
+
+    template <std::size_t TFromIdx, typename TIter>
+    void readFromNoStatus(TIter& iter) = delete;
+
+    template <std::size_t TUntilIdx, typename TIter>
+    void readUntilNoStatus(TIter& iter) = delete;
+
+    template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter>
+    void readFromUntilNoStatus(TIter& iter) = delete;
+
+    static constexpr bool hasNonDefaultRefresh()
+    {
+        return true;
+    }
+
+    bool setVersion(VersionType version)
+    {
+        bool updated = BaseImpl::setVersion(version);
+        return refreshMaskInternal() || updated;
+    }
+
+    template <typename TIter>
+    ErrorStatus write(TIter& iter, std::size_t len) const
+    {
+        auto es = BaseImpl::template writeUntil<TMaskFieldIdx>(iter, len);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        std::size_t consumed = BaseImpl::template lengthUntil<TMaskFieldIdx>();
+        COMMS_ASSERT(consumed <= len);
+
+        MaskFieldType maskField(comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value()));
+        maskField.setValue(calcMask());
+        es = maskField.write(iter, len - consumed);
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        consumed += maskField.length();
+        COMMS_ASSERT(consumed <= len);
+        return BaseImpl::template writeFrom<FirstOptionalIdx>(iter, len - consumed);
+    }
+
+    template <typename TIter>
+    void writeNoStatus(TIter& iter) const
+    {
+        BaseImpl::template writeUntilNoStatus<TMaskFieldIdx>(iter);
+        MaskFieldType maskField(comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value()));
+        maskField.setValue(calcMask());
+        maskField.writeNoStatus(iter);
+        BaseImpl::template writeFromNoStatus<FirstOptionalIdx>(iter);
+    }
+
+    bool valid() const
+    {
+        return
+            BaseImpl::valid() &&
+            (static_cast<MaskValueType>(comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value()).getValue()) == calcMask());
+    }
+
+private:
+    template <typename... TParams>
+    using BaseRedirectTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using LocalTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using PerformOpTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using SkipOpTag = comms::details::tag::Tag4<>;
+
+    static constexpr MaskValueType bitOf(std::size_t idx)
+    {
+        return static_cast<MaskValueType>(static_cast<MaskValueType>(1U) << (idx - FirstOptionalIdx));
+    }
+
+    static comms::field::OptionalMode modeOf(MaskValueType mask, std::size_t idx)
+    {
+        return
+            ((mask & bitOf(idx)) != 0U) ?
+                comms::field::OptionalMode::Exists :
+                comms::field::OptionalMode::Missing;
+    }
+
+    template <typename TIter>
+    class PresenceReadHelper
+    {
+    public:
+        PresenceReadHelper(ErrorStatus& es, TIter& iter, std::size_t& len, MaskValueType mask, std::size_t idx) :
+            es_(es),
+            iter_(iter),
+            len_(len),
+            mask_(mask),
+            idx_(idx)
+        {
+        }
+
+        template <typename TField>
+        void operator()(TField& field)
+        {
+            auto idx = idx_;
+            ++idx_;
+            if (es_ != comms::ErrorStatus::Success) {
+                return;
+            }
+
+            field.setMode(modeOf(mask_, idx));
+            auto fromIter = iter_;
+            es_ = field.read(iter_, len_);
+            if (es_ == comms::ErrorStatus::Success) {
+                len_ -= static_cast<std::size_t>(std::distance(fromIter, iter_));
+            }
+        }
+
+    private:
+        ErrorStatus& es_;
+        TIter& iter_;
+        std::size_t& len_;
+        MaskValueType mask_ = 0U;
+        std::size_t idx_ = 0U;
+    };
+
+    template <typename TIter>
+    class PresenceReadNoStatusHelper
+    {
+    public:
+        PresenceReadNoStatusHelper(TIter& iter, MaskValueType mask) :
+            iter_(iter),
+            mask_(mask)
+        {
+        }
+
+        template <typename TField>
+        void operator()(TField& field)
+        {
+            field.setMode(modeOf(mask_, idx_));
+            ++idx_;
+            field.readNoStatus(iter_);
+        }
+
+    private:
+        TIter& iter_;
+        MaskValueType mask_ = 0U;
+        std::size_t idx_ = FirstOptionalIdx;
+    };
+
+    class TentativeResetHelper
+    {
+    public:
+        template <typename TField>
+        void operator()(TField& field)
+        {
+            if (field.getMode() == comms::field::OptionalMode::Tentative) {
+                field.setMode(comms::field::OptionalMode::Missing);
+            }
+        }
+    };
+
+    class MaskCalcHelper
+    {
+    public:
+        template <typename TField>
+        MaskValueType operator()(MaskValueType mask, const TField& field)
+        {
+            static_assert(std::is_same<typename TField::CommsTag, comms::field::tag::Optional>::value,
+                "All the members following the presence bitmask are expected to be comms::field::Optional");
+            auto idx = idx_;
+            ++idx_;
+            if (!field.doesExist()) {
+                return mask;
+            }
+
+            return static_cast<MaskValueType>(mask | bitOf(idx));
+        }
+
+    private:
+        std::size_t idx_ = FirstOptionalIdx;
+    };
+
+    MaskValueType calcMask() const
+    {
+        return
+            comms::util::template tupleAccumulateFromUntil<FirstOptionalIdx, std::tuple_size<ValueType>::value>(
+                BaseImpl::value(), static_cast<MaskValueType>(0U), MaskCalcHelper());
+    }
+
+    template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter, typename... TParams>
+    ErrorStatus readFromUntilInternal(TIter& iter, std::size_t& len, BaseRedirectTag<TParams...>)
+    {
+        return BaseImpl::template readFromUntilAndUpdateLen<TFromIdx, TUntilIdx>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, typename TIter, typename... TParams>
+    ErrorStatus readLeadingFieldsInternal(TIter& iter, std::size_t& len, PerformOpTag<TParams...>)
+    {
+        return BaseImpl::template readFromUntilAndUpdateLen<TFromIdx, FirstOptionalIdx>(iter, len);
+    }
+
+    template <std::size_t TFromIdx, typename TIter, typename... TParams>
+    ErrorStatus readLeadingFieldsInternal(TIter& iter, std::size_t& len, SkipOpTag<TParams...>)
+    {
+        static_cast<void>(iter);
+        static_cast<void>(len);
+        return ErrorStatus::Success;
+    }
+
+    template <std::size_t TFromIdx, std::size_t TUntilIdx, typename TIter, typename... TParams>
+    ErrorStatus readFromUntilInternal(TIter& iter, std::size_t& len, LocalTag<TParams...>)
+    {
+        static_assert(TMaskFieldIdx < TUntilIdx, "Invalid function invocation");
+        using LeadingFieldsTag =
+            typename comms::util::LazyShallowConditional<
+                (TFromIdx <= TMaskFieldIdx)
+            >::template Type<
+                PerformOpTag,
+                SkipOpTag
+            >;
+
+        auto es = readLeadingFieldsInternal<TFromIdx>(iter, len, LeadingFieldsTag());
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        static const std::size_t NextIdx = (TFromIdx <= TMaskFieldIdx) ? FirstOptionalIdx : TFromIdx;
+        auto mask = static_cast<MaskValueType>(comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value()).getValue());
+        comms::util::template tupleForEachFromUntil<NextIdx, TUntilIdx>(
+            BaseImpl::value(), PresenceReadHelper<TIter>(es, iter, len, mask, NextIdx));
+        return es;
+    }
+
+    bool refreshMaskInternal()
+    {
+        auto& maskField = comms::util::tupleGet<TMaskFieldIdx>(BaseImpl::value());
+        auto expMask = calcMask();
+        if (static_cast<MaskValueType>(maskField.getValue()) == expMask) {
+            return false;
+        }
+
+        maskField.setValue(expMask);
+        return true;
+    }
+};
+
+}  // namespace adapter
+
+}  // namespace field
+
+}  // namespace comms
@@ -14,6 +14,7 @@
 
 #include "comms/ErrorStatus.h"
 #include "comms/field/tag.h"
+#include "comms/util/Tuple.h"
 #include "comms/util/type_traits.h"
 #include "comms/details/tag.h"
 
@@ -281,7 +282,7 @@ private:
     ErrorStatus readRemLengthFieldInternal(TIter& iter, std::size_t& len, std::size_t& remLen, PerformOpTag<TParams...>)
     {
         auto& mems = BaseImpl::value();
-        auto& lenField = std::get<TLenFieldIdx>(mems);
+        auto& lenField = comms::util::tupleGet<TLenFieldIdx>(mems);
 
         auto beforeLenReadIter = iter;
         auto es = lenField.read(iter, len);
@@ -303,7 +304,7 @@ private:
         static_cast<void>(iter);
         static_cast<void>(len);
         auto& mems = BaseImpl::value();
-        auto& lenField = std::get<TLenFieldIdx>(mems);
+        auto& lenField = comms::util::tupleGet<TLenFieldIdx>(mems);
         remLen = lenField.value();
         return ErrorStatus::Success;
     }    
@@ -391,7 +392,7 @@ private:
     bool refreshLengthInternal()
     {
         auto& mems = BaseImpl::value();
-        auto& lenField = std::get<TLenFieldIdx>(mems);
+        auto& lenField = comms::util::tupleGet<TLenFieldIdx>(mems);
         std::size_t expLen = BaseImpl::template lengthFrom<TLenFieldIdx + 1>();
         std::size_t actLen = static_cast<std::size_t>(lenField.getValue());
         if (expLen == actLen) {
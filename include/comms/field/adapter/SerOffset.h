@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 #include "comms/util/access.h"
 
@@ -68,7 +69,7 @@ public:
     }
 
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         if (size < BaseImpl::length()) {
             return ErrorStatus::BufferOverflow;
@@ -79,7 +80,7 @@ public:
     }
 
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         comms::util::writeData(toSerialised(BaseImpl::getValue()), iter, Endian());
     }
@@ -95,7 +96,7 @@ public:
     }
 
 private:
-    static SerialisedType adjustToSerialised(SerialisedType val)
+    static COMMS_CONSTEXPR20 SerialisedType adjustToSerialised(SerialisedType val)
     {
         return static_cast<SerialisedType>(Offset + val);
     }
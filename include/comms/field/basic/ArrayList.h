@@ -9,8 +9,10 @@
 
 #include <type_traits>
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <numeric>
+#include <vector>
 
 #include "comms/CompileControl.h"
 #include "comms/Assert.h"
@@ -44,20 +46,84 @@ template <typename TStorage>
 struct ArrayListMaxLengthRetrieveHelper
 {
     static const std::size_t Value = CommonFuncs::maxSupportedLength();
+    static const bool Strict = false;
 };
 
 template <typename T, std::size_t TSize>
 struct ArrayListMaxLengthRetrieveHelper<comms::util::StaticVector<T, TSize> >
 {
     static const std::size_t Value = TSize;
+    static const bool Strict = true;
 };
 
 template <std::size_t TSize>
 struct ArrayListMaxLengthRetrieveHelper<comms::util::StaticString<TSize> >
 {
     static const std::size_t Value = TSize - 1;
+    static const bool Strict = true;
 };
 
+template <typename TStorage>
+struct ArrayListContiguousStorageCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename T, typename TAlloc>
+struct ArrayListContiguousStorageCheckHelper<std::vector<T, TAlloc> >
+{
+    static const bool Value = true;
+};
+
+template <typename T, std::size_t TSize>
+struct ArrayListContiguousStorageCheckHelper<comms::util::StaticVector<T, TSize> >
+{
+    static const bool Value = true;
+};
+
+template <typename...>
+class ArrayListIntegralCheckHostLayout
+{
+public:
+    template <typename T, typename TEndian>
+    using Type = 
+        std::integral_constant<
+            bool, 
+            comms::util::isHostEndian<TEndian>() &&
+            (!std::is_same<T, bool>::value)
+        >;
+};
+
+template <typename...>
+class ArrayListFieldCheckHostLayout
+{
+public:
+    template <typename T, typename TEndian>
+    using Type = 
+        std::integral_constant<
+            bool, 
+            T::hasHostLayout() && 
+            (!T::isVersionDependent()) &&
+            (T::minLength() == T::maxLength()) &&
+            (sizeof(T) == T::minLength()) &&
+            comms::util::IsTriviallyCopyableBoolType<T>::value
+        >;
+};
+
+// The in-memory representation of the element is the same as its serialised
+// data without any padding, i.e. the whole sequence can be (de)serialised
+// with a single memcpy().
+template <typename TElem, typename TEndian>
+using ArrayListElemHasHostLayoutBoolType = 
+    typename comms::util::LazyDeepConditional<
+        std::is_integral<TElem>::value
+    >::template Type<
+        ArrayListIntegralCheckHostLayout,
+        ArrayListFieldCheckHostLayout,
+        TElem,
+        TEndian
+    >;
+
 template <typename TElem>
 using ArrayListFieldHasVarLengthBoolType = 
     typename comms::util::LazyDeepConditional<
@@ -78,6 +144,16 @@ using HasArrayListElemNonDefaultRefreshBoolType =
         TElem
     >;
 
+template <typename TElem>
+using IsArrayListElemFixedLengthReadNoStatusBoolType = 
+    typename comms::util::LazyDeepConditional<
+        std::is_integral<TElem>::value
+    >::template Type<
+        comms::util::FalseType,
+        comms::util::FieldCheckFixedLengthReadNoStatus,
+        TElem
+    >;
+
 template <typename TElem>
 using IsArrayListElemVersionDependentBoolType = 
     typename comms::util::LazyDeepConditional<
@@ -193,6 +269,13 @@ public:
             maxLengthInternal(ElemTag<>());
     }
 
+    static constexpr bool hasStrictMaxLength()
+    {
+        return
+            details::ArrayListMaxLengthRetrieveHelper<TStorage>::Strict &&
+            hasStrictMaxLengthInternal(ElemTag<>());
+    }
+
     constexpr bool valid() const
     {
         return validInternal(ElemTag<>());
@@ -328,7 +411,7 @@ public:
     template <typename TIter>
     ErrorStatus write(TIter& iter, std::size_t len) const
     {
-        return CommonFuncs::writeSequence(*this, iter, len);
+        return writeInternal(iter, len, WriteElementsIterTag<TIter>());
     }
 
     static constexpr bool hasWriteNoStatus()
@@ -339,19 +422,19 @@ public:
     template <typename TIter>
     void writeNoStatus(TIter& iter) const
     {
-        CommonFuncs::writeSequenceNoStatus(*this, iter);
+        writeNoStatusInternal(iter, WriteElementsIterTag<TIter>());
     }
 
     template <typename TIter>
     ErrorStatus writeN(std::size_t count, TIter& iter, std::size_t& len) const
     {
-        return CommonFuncs::writeSequenceN(*this, count, iter, len);
+        return writeInternalN(count, iter, len, WriteElementsIterTag<TIter>());
     }
 
     template <typename TIter>
     void writeNoStatusN(std::size_t count, TIter& iter) const
     {
-        CommonFuncs::writeSequenceNoStatusN(*this, count, iter);
+        writeNoStatusInternalN(count, iter, WriteElementsIterTag<TIter>());
     }
 
     static constexpr bool isVersionDependent()
@@ -391,6 +474,57 @@ private:
     template <typename... TParams>
     using NoVersionDependencyTag = comms::details::tag::Tag7<>;
 
+    template <typename... TParams>
+    using FixedLengthElemTag = comms::details::tag::Tag8<>;
+
+    template <typename... TParams>
+    using AnyLengthElemTag = comms::details::tag::Tag9<>;
+
+    template <typename... TParams>
+    using HostLayoutElemTag = comms::details::tag::Tag10<>;
+
+    template <typename... TParams>
+    using ElementwiseTag = comms::details::tag::Tag11<>;
+
+    template <typename... TParams>
+    using ReadElementsTag = 
+        typename comms::util::Conditional<
+            details::IsArrayListElemFixedLengthReadNoStatusBoolType<ElementType>::value
+        >::template Type<
+            FixedLengthElemTag<TParams...>,
+            AnyLengthElemTag<TParams...>
+        >;
+
+    // The elements are stored contiguously, serialised exactly as they are
+    // stored in memory, and the raw bytes are accessed via pointer.
+    template <typename TIter>
+    using HostLayoutIterBoolType = 
+        std::integral_constant<
+            bool,
+            details::ArrayListElemHasHostLayoutBoolType<ElementType, Endian>::value &&
+            details::ArrayListContiguousStorageCheckHelper<ValueType>::Value &&
+            std::is_pointer<TIter>::value &&
+            (sizeof(typename std::remove_pointer<TIter>::type) == 1U)
+        >;
+
+    template <typename TIter>
+    using ReadElementsIterTag = 
+        typename comms::util::LazyShallowConditional<
+            HostLayoutIterBoolType<TIter>::value
+        >::template Type<
+            HostLayoutElemTag,
+            ReadElementsTag
+        >;
+
+    template <typename TIter>
+    using WriteElementsIterTag = 
+        typename comms::util::LazyShallowConditional<
+            HostLayoutIterBoolType<TIter>::value
+        >::template Type<
+            HostLayoutElemTag,
+            ElementwiseTag
+        >;
+
     template <typename... TParams>
     using ElemTag = 
         typename comms::util::Conditional<
@@ -458,6 +592,18 @@ private:
         return sizeof(ElementType);
     }
 
+    template <typename... TParams>
+    static constexpr bool hasStrictMaxLengthInternal(FieldElemTag<TParams...>)
+    {
+        return ElementType::hasStrictMaxLength();
+    }
+
+    template <typename... TParams>
+    static constexpr bool hasStrictMaxLengthInternal(IntegralElemTag<TParams...>)
+    {
+        return true;
+    }
+
     template <typename TIter>
     static ErrorStatus readFieldElement(ElementType& elem, TIter& iter, std::size_t& len)
     {
@@ -650,6 +796,37 @@ private:
 
     template <typename TIter, typename... TParams>
     ErrorStatus readInternal(TIter& iter, std::size_t len, FieldElemTag<TParams...>)
+    {
+        return readElementsInternal(iter, len, ReadElementsIterTag<TIter>());
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternal(TIter& iter, std::size_t len, HostLayoutElemTag<TParams...>)
+    {
+        if ((len % sizeof(ElementType)) != 0U) {
+            return readElementsInternal(iter, len, AnyLengthElemTag<>());
+        }
+
+        readNoStatusElementsInternalN(len / sizeof(ElementType), iter, HostLayoutElemTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternal(TIter& iter, std::size_t len, FixedLengthElemTag<TParams...>)
+    {
+        // All the elements have the same length and don't fail on read,
+        // no need to check the remaining length for every element.
+        static const std::size_t ElemLength = ElementType::minLength();
+        if ((len % ElemLength) != 0U) {
+            return readElementsInternal(iter, len, AnyLengthElemTag<>());
+        }
+
+        readNoStatusInternalN(len / ElemLength, iter, FieldElemTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternal(TIter& iter, std::size_t len, AnyLengthElemTag<TParams...>)
     {
         static_assert(comms::util::detect::hasClearFunc<ValueType>(),
             "The used storage type for ArrayList must have clear() member function");
@@ -675,6 +852,35 @@ private:
 
     template <typename TIter, typename... TParams>
     ErrorStatus readInternalN(std::size_t count, TIter& iter, std::size_t len, FieldElemTag<TParams...>)
+    {
+        return readElementsInternalN(count, iter, len, ReadElementsIterTag<TIter>());
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternalN(std::size_t count, TIter& iter, std::size_t len, HostLayoutElemTag<TParams...>)
+    {
+        if ((len / sizeof(ElementType)) < count) {
+            return readElementsInternalN(count, iter, len, AnyLengthElemTag<>());
+        }
+
+        readNoStatusElementsInternalN(count, iter, HostLayoutElemTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternalN(std::size_t count, TIter& iter, std::size_t len, FixedLengthElemTag<TParams...>)
+    {
+        static const std::size_t ElemLength = ElementType::minLength();
+        if ((len / ElemLength) < count) {
+            return readElementsInternalN(count, iter, len, AnyLengthElemTag<>());
+        }
+
+        readNoStatusInternalN(count, iter, FieldElemTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsInternalN(std::size_t count, TIter& iter, std::size_t len, AnyLengthElemTag<TParams...>)
     {
         clear();
         while (0 < count) {
@@ -701,6 +907,33 @@ private:
 
     template <typename TIter, typename... TParams>
     void readNoStatusInternalN(std::size_t count, TIter& iter, FieldElemTag<TParams...>)
+    {
+        readNoStatusElementsInternalN(count, iter, ReadElementsIterTag<TIter>());
+    }
+
+    template <typename TIter, typename... TParams>
+    void readNoStatusElementsInternalN(std::size_t count, TIter& iter, HostLayoutElemTag<TParams...>)
+    {
+        // Single copy of the whole sequence, the elements beyond the capacity
+        // of the storage are skipped.
+        auto storeCount = std::min(count, static_cast<std::size_t>(value_.max_size()));
+        clear();
+        value_.resize(storeCount);
+        if (0U < storeCount) {
+            std::memcpy(value_.data(), iter, storeCount * sizeof(ElementType));
+        }
+
+        iter += count * sizeof(ElementType);
+    }
+
+    template <typename TIter, typename... TParams>
+    void readNoStatusElementsInternalN(std::size_t count, TIter& iter, FixedLengthElemTag<TParams...>)
+    {
+        readNoStatusElementsInternalN(count, iter, AnyLengthElemTag<>());
+    }
+
+    template <typename TIter, typename... TParams>
+    void readNoStatusElementsInternalN(std::size_t count, TIter& iter, AnyLengthElemTag<TParams...>)
     {
         clear();
         while (0 < count) {
@@ -777,6 +1010,72 @@ private:
         return true;
     }
 
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, HostLayoutElemTag<TParams...>) const
+    {
+        if ((len < (value_.size() * sizeof(ElementType))) || (!canWrite())) {
+            return writeInternal(iter, len, ElementwiseTag<>());
+        }
+
+        writeNoStatusInternalN(value_.size(), iter, HostLayoutElemTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, ElementwiseTag<TParams...>) const
+    {
+        return CommonFuncs::writeSequence(*this, iter, len);
+    }
+
+    template <typename TIter, typename... TParams>
+    void writeNoStatusInternal(TIter& iter, HostLayoutElemTag<TParams...>) const
+    {
+        writeNoStatusInternalN(value_.size(), iter, HostLayoutElemTag<>());
+    }
+
+    template <typename TIter, typename... TParams>
+    void writeNoStatusInternal(TIter& iter, ElementwiseTag<TParams...>) const
+    {
+        CommonFuncs::writeSequenceNoStatus(*this, iter);
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, HostLayoutElemTag<TParams...>) const
+    {
+        auto writeCount = std::min(count, static_cast<std::size_t>(value_.size()));
+        if ((len < (writeCount * sizeof(ElementType))) || (!canWrite())) {
+            return writeInternalN(count, iter, len, ElementwiseTag<>());
+        }
+
+        writeNoStatusInternalN(writeCount, iter, HostLayoutElemTag<>());
+        len -= writeCount * sizeof(ElementType);
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, ElementwiseTag<TParams...>) const
+    {
+        return CommonFuncs::writeSequenceN(*this, count, iter, len);
+    }
+
+    template <typename TIter, typename... TParams>
+    void writeNoStatusInternalN(std::size_t count, TIter& iter, HostLayoutElemTag<TParams...>) const
+    {
+        // Single copy of the whole sequence
+        auto writeCount = std::min(count, static_cast<std::size_t>(value_.size()));
+        if (0U < writeCount) {
+            std::memcpy(iter, value_.data(), writeCount * sizeof(ElementType));
+        }
+
+        iter += writeCount * sizeof(ElementType);
+    }
+
+    template <typename TIter, typename... TParams>
+    void writeNoStatusInternalN(std::size_t count, TIter& iter, ElementwiseTag<TParams...>) const
+    {
+        CommonFuncs::writeSequenceNoStatusN(*this, count, iter);
+    }
+
     template <typename TIter>
     comms::ErrorStatus createAndReadNextElementInternal(TIter& iter, std::size_t& len)
     {
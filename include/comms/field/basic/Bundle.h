@@ -9,10 +9,15 @@
 
 #include <type_traits>
 #include <algorithm>
+#include <cstring>
 
+#include "comms/CompileControl.h"
 #include "comms/Assert.h"
 #include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/util/PackedTuple.h"
 #include "comms/util/Tuple.h"
+#include "comms/util/type_traits.h"
 #include "comms/field/details/FieldOpHelpers.h"
 #include "comms/field/details/MembersVersionDependency.h"
 #include "comms/field/tag.h"
@@ -51,18 +56,46 @@ struct BundleVersionDependencyDetectHelper<comms::field::details::MembersVersion
     static constexpr bool Value = true;
 };
 
+// All the members are serialised exactly as their values are stored in
+// memory and can be stored one after another without any padding.
+template <bool THostLayoutStorage, typename... TMembers>
+using BundleHasPackedStorageBoolType = 
+    std::integral_constant<
+        bool,
+        THostLayoutStorage &&
+        CommonFuncs::AllFieldsHaveHostLayoutBoolType<TMembers...>::value &&
+        comms::util::isPackable<TMembers...>()
+    >;
+
+template <bool THostLayoutStorage, typename... TMembers>
+using BundleStorageType = 
+    typename comms::util::Conditional<
+        BundleHasPackedStorageBoolType<THostLayoutStorage, TMembers...>::value
+    >::template Type<
+        comms::util::PackedTuple<TMembers...>,
+        std::tuple<TMembers...>
+    >;
+
 } // namespace details
     
 
-template <typename TFieldBase, comms::field::details::MembersVersionDependency TVersionDependency, typename TMembers>
+template <
+    typename TFieldBase, 
+    comms::field::details::MembersVersionDependency TVersionDependency, 
+    typename TMembers, 
+    bool THostLayoutStorage = false>
 class Bundle;    
 
-template <typename TFieldBase, comms::field::details::MembersVersionDependency TVersionDependency, typename... TMembers>
-class Bundle<TFieldBase, TVersionDependency, std::tuple<TMembers...> > : public TFieldBase
+template <
+    typename TFieldBase, 
+    comms::field::details::MembersVersionDependency TVersionDependency, 
+    bool THostLayoutStorage,
+    typename... TMembers>
+class Bundle<TFieldBase, TVersionDependency, std::tuple<TMembers...>, THostLayoutStorage> : public TFieldBase
 {
 public:
-    using ValueType = std::tuple<TMembers...>;
-    using Members = ValueType;
+    using ValueType = details::BundleStorageType<THostLayoutStorage, TMembers...>;
+    using Members = std::tuple<TMembers...>;
     using VersionType = typename TFieldBase::VersionType;
     using CommsTag = comms::field::tag::Bundle;
 
@@ -84,7 +117,7 @@ public:
     Bundle& operator=(const Bundle&) = default;
     Bundle& operator=(Bundle&&) = default;
 
-    const ValueType& value() const
+    COMMS_CONSTEXPR20 const ValueType& value() const
     {
         return members_;
     }
@@ -179,6 +212,11 @@ public:
                 std::size_t(0), comms::field::details::FieldMaxLengthSumCalcHelper<>());        
     }
 
+    static constexpr bool hasStrictMaxLength()
+    {
+        return CommonFuncs::AllFieldsHaveStrictMaxLengthBoolType<TMembers...>::value;
+    }
+
     template <std::size_t TFromIdx>
     static constexpr std::size_t maxLengthFrom()
     {
@@ -216,9 +254,15 @@ public:
     template <typename TIter>
     ErrorStatus read(TIter& iter, std::size_t len)
     {
-        auto es = ErrorStatus::Success;
-        comms::util::tupleForEach(value(), makeReadHelper(es, iter, len));
-        return es;
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                HostLayoutIterBoolType<TIter>::value
+            >::template Type<
+                HostLayoutTag,
+                ReadTag
+            >;
+
+        return readInternal(iter, len, Tag());
     }
 
     template <std::size_t TFromIdx, typename TIter>
@@ -271,7 +315,7 @@ public:
     template <typename TIter>
     void readNoStatus(TIter& iter)
     {
-        comms::util::tupleForEach(value(), makeReadNoStatusHelper(iter));
+        readNoStatusInternal(iter, HostLayoutIterTag<TIter>());
     }
 
     template <std::size_t TFromIdx, typename TIter>
@@ -300,11 +344,9 @@ public:
     }
 
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t len) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t len) const
     {
-        auto es = ErrorStatus::Success;
-        comms::util::tupleForEach(value(), makeWriteHelper(es, iter, len));
-        return es;
+        return writeInternal(iter, len, HostLayoutIterTag<TIter>());
     }
 
     template <std::size_t TFromIdx, typename TIter>
@@ -337,9 +379,9 @@ public:
     }
 
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
-        comms::util::tupleForEach(value(), makeWriteNoStatusHelper(iter));
+        writeNoStatusInternal(iter, HostLayoutIterTag<TIter>());
     }
 
     template <std::size_t TFromIdx, typename TIter>
@@ -375,7 +417,134 @@ public:
         return CommonFuncs::setVersionForMembers(value(), version);
     }
 
+    static constexpr bool hasHostLayout()
+    {
+        return details::BundleHasPackedStorageBoolType<THostLayoutStorage, TMembers...>::value;
+    }
+
 private:
+    template <typename... TParams>
+    using NoFixedPrefixTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using FixedPrefixTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using HostLayoutTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using MemberwiseTag = comms::details::tag::Tag4<>;
+
+    static const std::size_t FixedPrefixCount = 
+        CommonFuncs::FieldsFixedLengthReadNoStatusPrefixCountIntType<TMembers...>::value;
+
+    template <typename... TParams>
+    using ReadTag = 
+        typename comms::util::LazyShallowConditional<
+            FixedPrefixCount == 0U
+        >::template Type<
+            NoFixedPrefixTag,
+            FixedPrefixTag
+        >;
+
+    // The members are kept in the packed storage and the raw bytes are
+    // accessed via pointer, copy the whole storage at once.
+    template <typename TIter>
+    using HostLayoutIterBoolType = 
+        std::integral_constant<
+            bool,
+            hasHostLayout() &&
+            std::is_pointer<TIter>::value &&
+            (sizeof(typename std::remove_pointer<TIter>::type) == 1U)
+        >;
+
+    template <typename TIter>
+    using HostLayoutIterTag = 
+        typename comms::util::LazyShallowConditional<
+            HostLayoutIterBoolType<TIter>::value
+        >::template Type<
+            HostLayoutTag,
+            MemberwiseTag
+        >;
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, NoFixedPrefixTag<TParams...>)
+    {
+        auto es = ErrorStatus::Success;
+        comms::util::tupleForEach(value(), makeReadHelper(es, iter, len));
+        return es;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, FixedPrefixTag<TParams...>)
+    {
+        // The leading members have fixed length and don't fail on read,
+        // check the available length only once.
+        static const std::size_t FixedPrefixLength = minLengthUntil<FixedPrefixCount>();
+        if (len < FixedPrefixLength) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        readUntilNoStatus<FixedPrefixCount>(iter);
+        return readFrom<FixedPrefixCount>(iter, len - FixedPrefixLength);
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, HostLayoutTag<TParams...>)
+    {
+        if (len < maxLength()) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        readNoStatusInternal(iter, HostLayoutTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    void readNoStatusInternal(TIter& iter, HostLayoutTag<TParams...>)
+    {
+        std::memcpy(members_.data(), iter, maxLength());
+        iter += maxLength();
+    }
+
+    template <typename TIter, typename... TParams>
+    void readNoStatusInternal(TIter& iter, MemberwiseTag<TParams...>)
+    {
+        comms::util::tupleForEach(value(), makeReadNoStatusHelper(iter));
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, HostLayoutTag<TParams...>) const
+    {
+        if (len < maxLength()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        writeNoStatusInternal(iter, HostLayoutTag<>());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    COMMS_CONSTEXPR20 ErrorStatus writeInternal(TIter& iter, std::size_t len, MemberwiseTag<TParams...>) const
+    {
+        auto es = ErrorStatus::Success;
+        comms::util::tupleForEach(value(), makeWriteHelper(es, iter, len));
+        return es;
+    }
+
+    template <typename TIter, typename... TParams>
+    void writeNoStatusInternal(TIter& iter, HostLayoutTag<TParams...>) const
+    {
+        std::memcpy(iter, members_.data(), maxLength());
+        iter += maxLength();
+    }
+
+    template <typename TIter, typename... TParams>
+    COMMS_CONSTEXPR20 void writeNoStatusInternal(TIter& iter, MemberwiseTag<TParams...>) const
+    {
+        comms::util::tupleForEach(value(), makeWriteNoStatusHelper(iter));
+    }
+
     template <typename TIter>
     static comms::field::details::FieldReadHelper<TIter> makeReadHelper(comms::ErrorStatus& es, TIter& iter, std::size_t& len)
     {
@@ -395,12 +564,12 @@ private:
     }
 
     template <typename TIter>
-    static comms::field::details::FieldWriteNoStatusHelper<TIter> makeWriteNoStatusHelper(TIter& iter)
+    static COMMS_CONSTEXPR20 comms::field::details::FieldWriteNoStatusHelper<TIter> makeWriteNoStatusHelper(TIter& iter)
     {
         return comms::field::details::FieldWriteNoStatusHelper<TIter>(iter);
     }
 
-    static_assert(comms::util::IsTuple<ValueType>::Value, "ValueType must be tuple");
+    static_assert(comms::util::IsTuple<Members>::Value, "Members must be tuple");
     ValueType members_;
 };
 
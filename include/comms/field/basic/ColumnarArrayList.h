@@ -0,0 +1,390 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/field/tag.h"
+#include "comms/util/type_traits.h"
+#include "CommonFuncs.h"
+
+namespace comms
+{
+
+namespace field
+{
+
+namespace basic
+{
+
+template <typename TFieldBase, typename TStorage>
+class ColumnarArrayList : public TFieldBase
+{
+    using BaseImpl = TFieldBase;
+
+public:
+    using Endian = typename BaseImpl::Endian;
+    using VersionType = typename BaseImpl::VersionType;
+    using ElementType = typename TStorage::value_type;
+    using ValueType = TStorage;
+    using CommsTag = comms::field::tag::ArrayList;
+
+    ColumnarArrayList() = default;
+
+    explicit ColumnarArrayList(const ValueType& val)
+      : value_(val)
+    {
+    }
+
+    explicit ColumnarArrayList(ValueType&& val)
+      : value_(std::move(val))
+    {
+    }
+
+    ColumnarArrayList(const ColumnarArrayList&) = default;
+    ColumnarArrayList(ColumnarArrayList&&) = default;
+    ColumnarArrayList& operator=(const ColumnarArrayList&) = default;
+    ColumnarArrayList& operator=(ColumnarArrayList&&) = default;
+    ~ColumnarArrayList() noexcept = default;
+
+    const ValueType& value() const
+    {
+        return value_;
+    }
+
+    ValueType& value()
+    {
+        return value_;
+    }
+
+    const ValueType& getValue() const
+    {
+        return value();
+    }
+
+    template <typename T>
+    void setValue(T&& val)
+    {
+        value() = std::forward<T>(val);
+    }
+
+    void clear()
+    {
+        value_.clear();
+    }
+
+    std::size_t length() const
+    {
+        return value_.size() * ElemLength;
+    }
+
+    static constexpr std::size_t minLength()
+    {
+        return 0U;
+    }
+
+    static constexpr std::size_t maxLength()
+    {
+        return CommonFuncs::maxSupportedLength() * ElemLength;
+    }
+
+    static constexpr bool hasStrictMaxLength()
+    {
+        return false;
+    }
+
+    bool valid() const
+    {
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < value_.size(); ++idx) {
+            value_.get(idx, elem);
+            if (!elem.valid()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool refresh()
+    {
+        return refreshInternal(RefreshTag<>());
+    }
+
+    static constexpr std::size_t minElementLength()
+    {
+        return ElemLength;
+    }
+
+    static constexpr std::size_t maxElementLength()
+    {
+        return ElemLength;
+    }
+
+    static constexpr std::size_t elementLength(const ElementType& elem)
+    {
+        return elem.length();
+    }
+
+    template <typename TIter>
+    static ErrorStatus readElement(ElementType& elem, TIter& iter, std::size_t& len)
+    {
+        auto es = elem.read(iter, len);
+        if (es == ErrorStatus::Success) {
+            COMMS_ASSERT(ElemLength <= len);
+            len -= ElemLength;
+        }
+        return es;
+    }
+
+    template <typename TIter>
+    static void readElementNoStatus(ElementType& elem, TIter& iter)
+    {
+        elem.readNoStatus(iter);
+    }
+
+    template <typename TIter>
+    ErrorStatus read(TIter& iter, std::size_t len)
+    {
+        value_.clear();
+        if ((len % ElemLength) != 0U) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        return readN(len / ElemLength, iter, len);
+    }
+
+    static constexpr bool hasReadNoStatus()
+    {
+        return false;
+    }
+
+    template <typename TIter>
+    void readNoStatus(TIter& iter) = delete;
+
+    template <typename TIter>
+    ErrorStatus readN(std::size_t count, TIter& iter, std::size_t& len)
+    {
+        value_.clear();
+        if ((len / ElemLength) < count) {
+            return ErrorStatus::NotEnoughData;
+        }
+
+        auto es = readElementsN(count, iter, ReadTag<>());
+        if (es == ErrorStatus::Success) {
+            len -= count * ElemLength;
+        }
+        return es;
+    }
+
+    template <typename TIter>
+    void readNoStatusN(std::size_t count, TIter& iter)
+    {
+        value_.clear();
+        static_cast<void>(readElementsN(count, iter, NoStatusTag<>()));
+    }
+
+    static bool canWriteElement(const ElementType& elem)
+    {
+        return elem.canWrite();
+    }
+
+    template <typename TIter>
+    static ErrorStatus writeElement(const ElementType& elem, TIter& iter, std::size_t& len)
+    {
+        auto es = elem.write(iter, len);
+        if (es == ErrorStatus::Success) {
+            len -= ElemLength;
+        }
+        return es;
+    }
+
+    template <typename TIter>
+    static void writeElementNoStatus(const ElementType& elem, TIter& iter)
+    {
+        elem.writeNoStatus(iter);
+    }
+
+    bool canWrite() const
+    {
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < value_.size(); ++idx) {
+            value_.get(idx, elem);
+            if (!elem.canWrite()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename TIter>
+    ErrorStatus write(TIter& iter, std::size_t len) const
+    {
+        return writeN(value_.size(), iter, len);
+    }
+
+    static constexpr bool hasWriteNoStatus()
+    {
+        return ElementType::hasWriteNoStatus();
+    }
+
+    template <typename TIter>
+    void writeNoStatus(TIter& iter) const
+    {
+        writeNoStatusN(value_.size(), iter);
+    }
+
+    template <typename TIter>
+    ErrorStatus writeN(std::size_t count, TIter& iter, std::size_t& len) const
+    {
+        COMMS_ASSERT(count <= value_.size());
+        if ((len / ElemLength) < count) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            value_.get(idx, elem);
+            auto es = elem.write(iter, ElemLength);
+            if (es != ErrorStatus::Success) {
+                return es;
+            }
+        }
+
+        len -= count * ElemLength;
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    void writeNoStatusN(std::size_t count, TIter& iter) const
+    {
+        COMMS_ASSERT(count <= value_.size());
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            value_.get(idx, elem);
+            elem.writeNoStatus(iter);
+        }
+    }
+
+    static constexpr bool isVersionDependent()
+    {
+        return false;
+    }
+
+    static constexpr bool hasNonDefaultRefresh()
+    {
+        return ElementType::hasNonDefaultRefresh();
+    }
+
+    static constexpr bool setVersion(VersionType)
+    {
+        return false;
+    }
+
+private:
+    template <typename... TParams>
+    using StatusTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using NoStatusTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using DefaultRefreshTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using NonDefaultRefreshTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using ReadTag =
+        typename comms::util::LazyShallowConditional<
+            comms::util::FieldCheckFixedLengthReadNoStatus<>::template Type<ElementType>::value
+        >::template Type<
+            NoStatusTag,
+            StatusTag
+        >;
+
+    template <typename... TParams>
+    using RefreshTag =
+        typename comms::util::LazyShallowConditional<
+            ElementType::hasNonDefaultRefresh()
+        >::template Type<
+            NonDefaultRefreshTag,
+            DefaultRefreshTag
+        >;
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsN(std::size_t count, TIter& iter, StatusTag<TParams...>)
+    {
+        value_.reserve(count);
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto es = elem.read(iter, ElemLength);
+            if (es != ErrorStatus::Success) {
+                return es;
+            }
+
+            value_.push_back(elem);
+        }
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter, typename... TParams>
+    ErrorStatus readElementsN(std::size_t count, TIter& iter, NoStatusTag<TParams...>)
+    {
+        value_.reserve(count);
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            elem.readNoStatus(iter);
+            value_.push_back(elem);
+        }
+        return ErrorStatus::Success;
+    }
+
+    template <typename... TParams>
+    static constexpr bool refreshInternal(DefaultRefreshTag<TParams...>)
+    {
+        return false;
+    }
+
+    template <typename... TParams>
+    bool refreshInternal(NonDefaultRefreshTag<TParams...>)
+    {
+        bool updated = false;
+        ElementType elem;
+        for (std::size_t idx = 0U; idx < value_.size(); ++idx) {
+            value_.get(idx, elem);
+            if (elem.refresh()) {
+                value_.set(idx, elem);
+                updated = true;
+            }
+        }
+        return updated;
+    }
+
+    static const std::size_t ElemLength = ElementType::minLength();
+
+    static_assert(ElementType::minLength() == ElementType::maxLength(),
+        "The elements of the columnar ArrayList must have fixed serialisation length");
+    static_assert(0U < ElemLength,
+        "The elements of the columnar ArrayList must have non-zero serialisation length");
+    static_assert(!ElementType::isVersionDependent(),
+        "The elements of the columnar ArrayList must not be version dependent");
+
+    ValueType value_;
+};
+
+}  // namespace basic
+
+}  // namespace field
+
+}  // namespace comms
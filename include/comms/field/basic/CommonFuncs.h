@@ -261,6 +261,33 @@ struct CommonFuncs
             std::false_type
         >;                
 
+    template <typename... TFields>
+    using AllFieldsHaveStrictMaxLengthBoolType = 
+        typename comms::util::Conditional<
+            comms::util::tupleTypeAccumulate<std::tuple<TFields...> >(
+                true, comms::field::details::FieldStrictMaxLengthDetectHelper<>())
+        >::template Type<
+            std::true_type,
+            std::false_type
+        >;
+
+    template <typename... TFields>
+    using AllFieldsHaveHostLayoutBoolType = 
+        typename comms::util::Conditional<
+            comms::util::tupleTypeAccumulate<std::tuple<TFields...> >(
+                true, comms::field::details::FieldHostLayoutDetectHelper<>())
+        >::template Type<
+            std::true_type,
+            std::false_type
+        >;
+
+    template <typename... TFields>
+    using FieldsFixedLengthReadNoStatusPrefixCountIntType = 
+        std::integral_constant<
+            std::size_t,
+            comms::field::details::FieldFixedLengthReadNoStatusPrefixCountHelper<TFields...>::Value
+        >;
+
 private:
 
     template <typename TVersionType>
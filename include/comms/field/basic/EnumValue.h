@@ -9,6 +9,7 @@
 
 #include <type_traits>
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 #include "comms/field/tag.h"
 
@@ -63,23 +64,23 @@ public:
     EnumValue& operator=(const EnumValue&) = default;
     EnumValue& operator=(EnumValue&&) = default;
 
-    const ValueType& value() const
+    COMMS_CONSTEXPR20 const ValueType& value() const
     {
         return value_;
     }
 
-    ValueType& value()
+    COMMS_CONSTEXPR20 ValueType& value()
     {
         return value_;
     }
 
-    const ValueType& getValue() const
+    COMMS_CONSTEXPR20 const ValueType& getValue() const
     {
         return value();
     }
 
     template <typename U>
-    void setValue(U&& val)
+    COMMS_CONSTEXPR20 void setValue(U&& val)
     {
         value() = static_cast<ValueType>(std::forward<U>(val));
     }    
@@ -129,13 +130,13 @@ public:
     }
 
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         return IntValueField(static_cast<IntValueType>(value_)).write(iter, size);
     }
 
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         IntValueField(static_cast<IntValueType>(value_)).writeNoStatus(iter);
     }
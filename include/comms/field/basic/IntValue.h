@@ -9,8 +9,10 @@
 
 #include <type_traits>
 
+#include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
 #include "comms/field/tag.h"
+#include "comms/util/access.h"
 
 namespace comms
 {
@@ -37,7 +39,7 @@ public:
 
     IntValue() = default;
 
-    explicit IntValue(ValueType val)
+    explicit COMMS_CONSTEXPR20 IntValue(ValueType val)
       : value_(val)
     {
     }
@@ -49,23 +51,23 @@ public:
     IntValue& operator=(const IntValue&) = default;
     IntValue& operator=(IntValue&&) = default;
 
-    const ValueType& value() const
+    COMMS_CONSTEXPR20 const ValueType& value() const
     {
         return value_;
     }
 
-    ValueType& value()
+    COMMS_CONSTEXPR20 ValueType& value()
     {
         return value_;
     }
 
-    const ValueType& getValue() const
+    COMMS_CONSTEXPR20 const ValueType& getValue() const
     {
         return value();
     }
 
     template <typename U>
-    void setValue(U&& val)
+    COMMS_CONSTEXPR20 void setValue(U&& val)
     {
         value() = static_cast<ValueType>(std::forward<U>(val));
     }    
@@ -85,6 +87,13 @@ public:
         return length();
     }
 
+    static constexpr bool hasHostLayout()
+    {
+        return 
+            comms::util::isHostEndian<typename BaseImpl::Endian>() && 
+            (length() == sizeof(ValueType));
+    }
+
     static constexpr SerialisedType toSerialised(ValueType val)
     {
         return static_cast<SerialisedType>(val);
@@ -115,7 +124,7 @@ public:
     }
 
     template <typename TIter>
-    ErrorStatus write(TIter& iter, std::size_t size) const
+    COMMS_CONSTEXPR20 ErrorStatus write(TIter& iter, std::size_t size) const
     {
         if (size < length()) {
             return ErrorStatus::BufferOverflow;
@@ -126,7 +135,7 @@ public:
     }
 
     template <typename TIter>
-    void writeNoStatus(TIter& iter) const
+    COMMS_CONSTEXPR20 void writeNoStatus(TIter& iter) const
     {
         BaseImpl::writeData(toSerialised(value_), iter);
     }
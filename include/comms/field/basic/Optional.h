@@ -128,6 +128,11 @@ public:
         return Field::maxLength();
     }
 
+    static constexpr bool hasStrictMaxLength()
+    {
+        return Field::hasStrictMaxLength();
+    }
+
     bool valid() const
     {
         if (mode_ == Mode::Missing) {
@@ -45,12 +45,14 @@ template <typename TStorage>
 struct StringMaxLengthRetrieveHelper
 {
     static const std::size_t Value = CommonFuncs::maxSupportedLength();
+    static const bool Strict = false;
 };
 
 template <std::size_t TSize>
 struct StringMaxLengthRetrieveHelper<comms::util::StaticString<TSize> >
 {
     static const std::size_t Value = TSize - 1;
+    static const bool Strict = true;
 };
 
 }  // namespace details
@@ -138,6 +140,11 @@ public:
             sizeof(ElementType);
     }
 
+    static constexpr bool hasStrictMaxLength()
+    {
+        return details::StringMaxLengthRetrieveHelper<TStorage>::Strict;
+    }
+
     static constexpr bool valid()
     {
         return true;
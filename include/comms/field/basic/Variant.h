@@ -37,7 +37,125 @@ namespace basic
 namespace details
 {
 
-template<typename...>
+template <std::size_t TSpillThreshold>
+class VariantStorageAccess
+{
+public:
+    template <typename TField>
+    static constexpr bool isSpilled()
+    {
+        return (0U < TSpillThreshold) && (TSpillThreshold < sizeof(TField));
+    }
+
+    template <typename TField>
+    using SlotType = comms::util::ConditionalT<isSpilled<TField>(), TField*, TField>;
+
+private:
+    template <typename... TParams>
+    using SpilledTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using InlineTag = comms::details::tag::Tag2<>;
+
+    template <typename TField>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            isSpilled<TField>()
+        >::template Type<
+            SpilledTag,
+            InlineTag
+        >;
+
+public:
+
+    template <typename TField, typename... TArgs>
+    static TField* construct(void* storage, TArgs&&... args)
+    {
+        return constructInternal<TField>(storage, StorageTag<TField>(), std::forward<TArgs>(args)...);
+    }
+
+    // Returns true when the ownership of the member has been transferred
+    template <typename TField>
+    static bool moveConstruct(void* storage, void* other)
+    {
+        return moveConstructInternal<TField>(storage, other, StorageTag<TField>());
+    }
+
+    template <typename TField>
+    static void destroy(void* storage)
+    {
+        destroyInternal<TField>(storage, StorageTag<TField>());
+    }
+
+    template <typename TField>
+    static TField* get(void* storage)
+    {
+        return getInternal<TField>(storage, StorageTag<TField>());
+    }
+
+    template <typename TField>
+    static const TField* get(const void* storage)
+    {
+        return getInternal<TField>(const_cast<void*>(storage), StorageTag<TField>());
+    }
+
+private:
+    template <typename TField, typename... TParams, typename... TArgs>
+    static TField* constructInternal(void* storage, SpilledTag<TParams...>, TArgs&&... args)
+    {
+        auto* field = new TField(std::forward<TArgs>(args)...);
+        new (storage) TField*(field);
+        return field;
+    }
+
+    template <typename TField, typename... TParams, typename... TArgs>
+    static TField* constructInternal(void* storage, InlineTag<TParams...>, TArgs&&... args)
+    {
+        return new (storage) TField(std::forward<TArgs>(args)...);
+    }
+
+    template <typename TField, typename... TParams>
+    static bool moveConstructInternal(void* storage, void* other, SpilledTag<TParams...>)
+    {
+        auto*& otherField = *reinterpret_cast<TField**>(other);
+        new (storage) TField*(otherField);
+        otherField = nullptr;
+        return true;
+    }
+
+    template <typename TField, typename... TParams>
+    static bool moveConstructInternal(void* storage, void* other, InlineTag<TParams...>)
+    {
+        new (storage) TField(std::move(*reinterpret_cast<TField*>(other)));
+        return false;
+    }
+
+    template <typename TField, typename... TParams>
+    static void destroyInternal(void* storage, SpilledTag<TParams...>)
+    {
+        delete *reinterpret_cast<TField**>(storage);
+    }
+
+    template <typename TField, typename... TParams>
+    static void destroyInternal(void* storage, InlineTag<TParams...>)
+    {
+        reinterpret_cast<TField*>(storage)->~TField();
+    }
+
+    template <typename TField, typename... TParams>
+    static TField* getInternal(void* storage, SpilledTag<TParams...>)
+    {
+        return *reinterpret_cast<TField**>(storage);
+    }
+
+    template <typename TField, typename... TParams>
+    static TField* getInternal(void* storage, InlineTag<TParams...>)
+    {
+        return reinterpret_cast<TField*>(storage);
+    }
+};
+
+template <typename TAccess>
 class VariantFieldConstructHelper
 {
 public:
@@ -46,13 +164,13 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()() const
     {
-        new (storage_) TField;
+        TAccess::template construct<TField>(storage_);
     }
 private:
     void* storage_ = nullptr;
 };
 
-template<typename...>
+template <typename TAccess>
 class VariantLengthCalcHelper
 {
 public:
@@ -65,7 +183,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        len_ = reinterpret_cast<const TField*>(storage_)->length();
+        len_ = TAccess::template get<TField>(storage_)->length();
     }
 
 private:
@@ -73,7 +191,7 @@ private:
     const void* storage_;
 };
 
-template<typename...>
+template <typename TAccess>
 class VariantFieldCopyConstructHelper
 {
 public:
@@ -82,7 +200,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()() const
     {
-        new (storage_) TField(*(reinterpret_cast<const TField*>(other_)));
+        TAccess::template construct<TField>(storage_, *(TAccess::template get<TField>(other_)));
     }
 
 private:
@@ -90,24 +208,30 @@ private:
     const void* other_ = nullptr;
 };
 
-template<typename...>
+template <typename TAccess>
 class VariantFieldMoveConstructHelper
 {
 public:
-    VariantFieldMoveConstructHelper(void* storage, void* other) : storage_(storage), other_(other) {}
+    VariantFieldMoveConstructHelper(bool& released, void* storage, void* other)
+      : released_(released),
+        storage_(storage),
+        other_(other)
+    {
+    }
 
     template <std::size_t TIdx, typename TField>
     void operator()() const
     {
-        new (storage_) TField(std::move(*(reinterpret_cast<const TField*>(other_))));
+        released_ = TAccess::template moveConstruct<TField>(storage_, other_);
     }
 
 private:
+    bool& released_;
     void* storage_ = nullptr;
     void* other_ = nullptr;
 };
 
-template<typename...>
+template <typename TAccess>
 class VariantFieldDestructHelper
 {
 public:
@@ -116,13 +240,13 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()() const
     {
-        reinterpret_cast<TField*>(storage_)->~TField();
+        TAccess::template destroy<TField>(storage_);
     }
 private:
     void* storage_ = nullptr;
 };
 
-template <typename...>
+template <typename TAccess>
 class VariantFieldValidCheckHelper
 {
 public:
@@ -135,7 +259,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        result_ = reinterpret_cast<const TField*>(storage_)->valid();
+        result_ = TAccess::template get<TField>(storage_)->valid();
     }
 
 private:
@@ -143,7 +267,7 @@ private:
     const void* storage_;
 };
 
-template <typename...>
+template <typename TAccess>
 class VariantFieldRefreshHelper
 {
 public:
@@ -156,7 +280,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        result_ = reinterpret_cast<TField*>(storage_)->refresh();
+        result_ = TAccess::template get<TField>(storage_)->refresh();
     }
 
 private:
@@ -164,7 +288,7 @@ private:
     void* storage_ = nullptr;
 };
 
-template <typename TFunc>
+template <typename TAccess, typename TFunc>
 class VariantExecHelper
 {
     static_assert(std::is_lvalue_reference<TFunc>::value || std::is_rvalue_reference<TFunc>::value,
@@ -178,9 +302,9 @@ public:
     {
 #if COMMS_IS_MSVC
         // VS compiler
-        func_.operator()<TIdx>(*(reinterpret_cast<TField*>(storage_)));
+        func_.operator()<TIdx>(*(TAccess::template get<TField>(storage_)));
 #else // #if COMMS_IS_MSVC
-        func_.template operator()<TIdx>(*(reinterpret_cast<TField*>(storage_)));
+        func_.template operator()<TIdx>(*(TAccess::template get<TField>(storage_)));
 #endif // #if COMMS_IS_MSVC
     }
 private:
@@ -188,7 +312,7 @@ private:
     TFunc func_;
 };
 
-template <typename TFunc>
+template <typename TAccess, typename TFunc>
 class VariantConstExecHelper
 {
     static_assert(std::is_lvalue_reference<TFunc>::value || std::is_rvalue_reference<TFunc>::value,
@@ -202,9 +326,9 @@ public:
     {
 #if COMMS_IS_MSVC
         // VS compiler
-        func_.operator()<TIdx>(*(reinterpret_cast<const TField*>(storage_)));
+        func_.operator()<TIdx>(*(TAccess::template get<TField>(storage_)));
 #else // #if COMMS_IS_MSVC
-        func_.template operator()<TIdx>(*(reinterpret_cast<const TField*>(storage_)));
+        func_.template operator()<TIdx>(*(TAccess::template get<TField>(storage_)));
 #endif // #if COMMS_IS_MSVC
     }
 private:
@@ -213,7 +337,7 @@ private:
 };
 
 
-template <typename TIter, typename TVerBase, bool TVerDependent>
+template <typename TAccess, typename TIter, typename TVerBase, bool TVerDependent>
 class VariantReadHelper
 {
     template <typename... TParams>
@@ -230,6 +354,22 @@ class VariantReadHelper
             VersionDependentTag,
             NoVersionDependencyTag
         >;    
+
+    template <typename... TParams>
+    using SpilledTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using InlineTag = comms::details::tag::Tag4<>;
+
+    template <typename TField>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            TAccess::template isSpilled<TField>()
+        >::template Type<
+            SpilledTag,
+            InlineTag
+        >;
+
 public:
     VariantReadHelper(
         std::size_t& idx,
@@ -260,29 +400,52 @@ public:
             return;
         }
 
-        auto* field = new (storage_) TField;
-        updateMemberVersionInternal(*field, VersionTag<>());
+        readInternal<TField>(StorageTag<TField>());
+    }
+
+private:
+    template <typename TField, typename... TParams>
+    void readInternal(InlineTag<TParams...>)
+    {
+        auto* field = TAccess::template construct<TField>(storage_);
+        if (!readMember(*field)) {
+            TAccess::template destroy<TField>(storage_);
+        }
+    }
+
+    template <typename TField, typename... TParams>
+    void readInternal(SpilledTag<TParams...>)
+    {
+        // Allocate only for the successfully read member
+        TField field;
+        if (readMember(field)) {
+            TAccess::template construct<TField>(storage_, std::move(field));
+        }
+    }
+
+    template <typename TField>
+    bool readMember(TField& field)
+    {
+        updateMemberVersionInternal(field, VersionTag<>());
 
         auto iterTmp = iter_;
-        auto es = field->read(iterTmp, len_);
+        auto es = field.read(iterTmp, len_);
         if (es == comms::ErrorStatus::Success) {
             iter_ = iterTmp;
             es_ = es;
             readComplete_ = true;
-            return;
+            return true;
         }
 
-        field->~TField();
-
         if ((es_ == comms::ErrorStatus::NumOfErrorStatuses) ||
             (es == comms::ErrorStatus::NotEnoughData)) {
             es_ = es;
         }
 
         ++idx_;
+        return false;
     }
 
-private:
     template <typename TField, typename... TParams>
     void updateMemberVersionInternal(TField& field, NoVersionDependencyTag<TParams...>)
     {
@@ -304,7 +467,7 @@ private:
     bool readComplete_ = false;
 };
 
-template <typename TIter>
+template <typename TAccess, typename TIter>
 class VariantFieldWriteHelper
 {
 public:
@@ -319,7 +482,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        es_ = reinterpret_cast<const TField*>(storage_)->write(iter_, len_);
+        es_ = TAccess::template get<TField>(storage_)->write(iter_, len_);
     }
 
 private:
@@ -329,7 +492,7 @@ private:
     const void* storage_ = nullptr;
 };
 
-template <typename TIter>
+template <typename TAccess, typename TIter>
 class VariantWriteNoStatusHelper
 {
 public:
@@ -342,7 +505,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        reinterpret_cast<const TField*>(storage_)->writeNoStatus(iter_);
+        TAccess::template get<TField>(storage_)->writeNoStatus(iter_);
     }
 
 private:
@@ -350,7 +513,7 @@ private:
     const void* storage_ = nullptr;
 };
 
-template <typename TVersionType>
+template <typename TAccess, typename TVersionType>
 class VariantSetVersionHelper
 {
 public:
@@ -364,7 +527,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        updated_ = reinterpret_cast<TField*>(storage_)->setVersion(version_) || updated_;
+        updated_ = TAccess::template get<TField>(storage_)->setVersion(version_) || updated_;
     }
 
 private:
@@ -373,7 +536,7 @@ private:
     void* storage_ = nullptr;
 };
 
-template<typename...>
+template <typename TAccess>
 class VariantCanWriteHelper
 {
 public:
@@ -386,7 +549,7 @@ public:
     template <std::size_t TIdx, typename TField>
     void operator()()
     {
-        result_ = reinterpret_cast<const TField*>(storage_)->canWrite();
+        result_ = TAccess::template get<TField>(storage_)->canWrite();
     }
 
 private:
@@ -450,20 +613,32 @@ struct VariantVersionDependencyDetectHelper<comms::field::details::MembersVersio
 
 } // namespace details
 
-template <typename TFieldBase, comms::field::details::MembersVersionDependency TVersionDependency, typename TMembers>
+template <
+    typename TFieldBase,
+    comms::field::details::MembersVersionDependency TVersionDependency,
+    std::size_t TSpillThreshold,
+    typename TMembers>
 class Variant;
 
-template <typename TFieldBase, comms::field::details::MembersVersionDependency TVersionDependency, typename... TMembers>
-class Variant<TFieldBase, TVersionDependency, std::tuple<TMembers...> > :
+template <
+    typename TFieldBase,
+    comms::field::details::MembersVersionDependency TVersionDependency,
+    std::size_t TSpillThreshold,
+    typename... TMembers>
+class Variant<TFieldBase, TVersionDependency, TSpillThreshold, std::tuple<TMembers...> > :
         public TFieldBase,
         public details::VariantVersionStorageBase<TFieldBase, TVersionDependency, TMembers...>
 {
     using BaseImpl = TFieldBase;
     using VersionBaseImpl = details::VariantVersionStorageBase<TFieldBase, TVersionDependency, TMembers...>;
+    using StorageAccess = details::VariantStorageAccess<TSpillThreshold>;
 
 public:
     using Members = std::tuple<TMembers...>;
-    using ValueType = comms::util::TupleAsAlignedUnionT<Members>;
+    using ValueType =
+        comms::util::TupleAsAlignedUnionT<
+            std::tuple<typename StorageAccess::template SlotType<TMembers>...>
+        >;
     using VersionType = typename BaseImpl::VersionType;
     using CommsTag = comms::field::tag::Variant;
 
@@ -481,7 +656,7 @@ public:
         }
 
         comms::util::tupleForSelectedType<Members>(
-            other.memIdx_, details::VariantFieldCopyConstructHelper<>(&storage_, &other.storage_));
+            other.memIdx_, details::VariantFieldCopyConstructHelper<StorageAccess>(&storage_, &other.storage_));
 
         memIdx_ = other.memIdx_;
     }
@@ -492,10 +667,7 @@ public:
             return;
         }
 
-        comms::util::tupleForSelectedType<Members>(
-            other.memIdx_, details::VariantFieldMoveConstructHelper<>(&storage_, &other.storage_));
-
-        memIdx_ = other.memIdx_;
+        moveFrom(other);
     }
 
     ~Variant() noexcept
@@ -515,7 +687,7 @@ public:
         }
 
         comms::util::tupleForSelectedType<Members>(
-            other.memIdx_, details::VariantFieldCopyConstructHelper<>(&storage_, &other.storage_));
+            other.memIdx_, details::VariantFieldCopyConstructHelper<StorageAccess>(&storage_, &other.storage_));
 
         memIdx_ = other.memIdx_;
         return *this;
@@ -533,10 +705,7 @@ public:
             return *this;
         }
 
-        comms::util::tupleForSelectedType<Members>(
-            other.memIdx_, details::VariantFieldMoveConstructHelper<>(&storage_, &other.storage_));
-
-        memIdx_ = other.memIdx_;
+        moveFrom(other);
         return *this;
     }
 
@@ -568,7 +737,7 @@ public:
         }
 
         std::size_t len = std::numeric_limits<std::size_t>::max();
-        comms::util::tupleForSelectedType<Members>(memIdx_, details::VariantLengthCalcHelper<>(len, &storage_));
+        comms::util::tupleForSelectedType<Members>(memIdx_, details::VariantLengthCalcHelper<StorageAccess>(len, &storage_));
         return len;
     }
 
@@ -582,6 +751,11 @@ public:
         return CommonFuncs::FieldSelectMaxLengthIntType<TMembers...>::value;
     }
 
+    static constexpr bool hasStrictMaxLength()
+    {
+        return CommonFuncs::AllFieldsHaveStrictMaxLengthBoolType<TMembers...>::value;
+    }
+
     bool valid() const
     {
         if (!currentFieldValid()) {
@@ -590,7 +764,7 @@ public:
 
         bool val = false;
         comms::util::tupleForSelectedType<Members>(
-            memIdx_, details::VariantFieldValidCheckHelper<>(val, &storage_));
+            memIdx_, details::VariantFieldValidCheckHelper<StorageAccess>(val, &storage_));
         return val;
     }
 
@@ -607,7 +781,7 @@ public:
 
         bool val = false;
         comms::util::tupleForSelectedType<Members>(
-            memIdx_, details::VariantFieldRefreshHelper<>(val, &storage_));
+            memIdx_, details::VariantFieldRefreshHelper<StorageAccess>(val, &storage_));
         return val;
     }
 
@@ -639,7 +813,7 @@ public:
 
         bool val = false;
         comms::util::tupleForSelectedType<Members>(
-            memIdx_, details::VariantCanWriteHelper<>(val, &storage_));
+            memIdx_, details::VariantCanWriteHelper<StorageAccess>(val, &storage_));
         return val;
     }
 
@@ -689,7 +863,7 @@ public:
         }
 
         comms::util::tupleForSelectedType<Members>(
-            idx, details::VariantFieldConstructHelper<>(&storage_));
+            idx, details::VariantFieldConstructHelper<StorageAccess>(&storage_));
         memIdx_ = idx;
     }
 
@@ -726,10 +900,10 @@ public:
         COMMS_ASSERT(!currentFieldValid());
 
         using FieldType = typename std::tuple_element<TIdx, Members>::type;
-        new (&storage_) FieldType(std::forward<TArgs>(args)...);
+        auto* field = StorageAccess::template construct<FieldType>(&storage_, std::forward<TArgs>(args)...);
         memIdx_ = TIdx;
         updateVersionInternal(VersionTag<>());
-        return reinterpret_cast<FieldType&>(storage_);
+        return *field;
     }
 
     template <std::size_t TIdx>
@@ -739,7 +913,7 @@ public:
         COMMS_ASSERT(memIdx_ == TIdx);
 
         using FieldType = typename std::tuple_element<TIdx, Members>::type;
-        reinterpret_cast<FieldType*>(&storage_)->~FieldType();
+        StorageAccess::template destroy<FieldType>(&storage_);
         memIdx_ = MembersCount;
     }    
 
@@ -750,7 +924,7 @@ public:
         COMMS_ASSERT(TIdx == memIdx_); // Accessing non initialised field
 
         using FieldType = typename std::tuple_element<TIdx, Members>::type;
-        return reinterpret_cast<FieldType&>(storage_);
+        return *(StorageAccess::template get<FieldType>(&storage_));
     }
 
     template <std::size_t TIdx>
@@ -760,7 +934,7 @@ public:
         COMMS_ASSERT(TIdx == memIdx_); // Accessing non initialised field
 
         using FieldType = typename std::tuple_element<TIdx, Members>::type;
-        return reinterpret_cast<const FieldType&>(storage_);
+        return *(StorageAccess::template get<FieldType>(&storage_));
     }
 
     bool currentFieldValid() const
@@ -812,21 +986,21 @@ private:
         >;
 
     template <typename TFunc>
-    auto makeExecHelper(TFunc&& func) -> details::VariantExecHelper<decltype(std::forward<TFunc>(func))>
+    auto makeExecHelper(TFunc&& func) -> details::VariantExecHelper<StorageAccess, decltype(std::forward<TFunc>(func))>
     {
         using FuncType = decltype(std::forward<TFunc>(func));
-        return details::VariantExecHelper<FuncType>(&storage_, std::forward<TFunc>(func));
+        return details::VariantExecHelper<StorageAccess, FuncType>(&storage_, std::forward<TFunc>(func));
     }
 
     template <typename TFunc>
-    auto makeConstExecHelper(TFunc&& func) const -> details::VariantConstExecHelper<decltype(std::forward<TFunc>(func))>
+    auto makeConstExecHelper(TFunc&& func) const -> details::VariantConstExecHelper<StorageAccess, decltype(std::forward<TFunc>(func))>
     {
         using FuncType = decltype(std::forward<TFunc>(func));
-        return details::VariantConstExecHelper<FuncType>(&storage_, std::forward<TFunc>(func));
+        return details::VariantConstExecHelper<StorageAccess, FuncType>(&storage_, std::forward<TFunc>(func));
     }
 
     template <typename TIter, typename TVerBase>
-    details::VariantReadHelper<TIter, TVerBase, details::VariantVersionDependencyDetectHelper<TVersionDependency, TMembers...>::Value> 
+    details::VariantReadHelper<StorageAccess, TIter, TVerBase, details::VariantVersionDependencyDetectHelper<TVersionDependency, TMembers...>::Value> 
     makeReadHelper(
         comms::ErrorStatus& es,
         TIter& iter,
@@ -837,27 +1011,39 @@ private:
         memIdx_ = 0;
         static constexpr bool VerDependent = isVersionDependent();
         return 
-            details::VariantReadHelper<TIter, TVerBase, VerDependent>(
+            details::VariantReadHelper<StorageAccess, TIter, TVerBase, VerDependent>(
                 memIdx_, es, iter, len, storage, verBase);
     }
 
     template <typename TIter>
-    static details::VariantFieldWriteHelper<TIter> makeWriteHelper(comms::ErrorStatus& es, TIter& iter, std::size_t len, const void* storage)
+    static details::VariantFieldWriteHelper<StorageAccess, TIter> makeWriteHelper(comms::ErrorStatus& es, TIter& iter, std::size_t len, const void* storage)
     {
-        return details::VariantFieldWriteHelper<TIter>(es, iter, len, storage);
+        return details::VariantFieldWriteHelper<StorageAccess, TIter>(es, iter, len, storage);
     }
 
     template <typename TIter>
-    static details::VariantWriteNoStatusHelper<TIter> makeWriteNoStatusHelper(TIter& iter, const void* storage)
+    static details::VariantWriteNoStatusHelper<StorageAccess, TIter> makeWriteNoStatusHelper(TIter& iter, const void* storage)
     {
-        return details::VariantWriteNoStatusHelper<TIter>(iter, storage);
+        return details::VariantWriteNoStatusHelper<StorageAccess, TIter>(iter, storage);
+    }
+
+    void moveFrom(Variant& other)
+    {
+        bool released = false;
+        comms::util::tupleForSelectedType<Members>(
+            other.memIdx_, details::VariantFieldMoveConstructHelper<StorageAccess>(released, &storage_, &other.storage_));
+
+        memIdx_ = other.memIdx_;
+        if (released) {
+            other.memIdx_ = MembersCount;
+        }
     }
 
     void checkDestruct()
     {
         if (currentFieldValid()) {
             comms::util::tupleForSelectedType<Members>(
-                memIdx_, details::VariantFieldDestructHelper<>(&storage_));
+                memIdx_, details::VariantFieldDestructHelper<StorageAccess>(&storage_));
             memIdx_ = MembersCount;
         }
     }
@@ -881,7 +1067,7 @@ private:
         bool updated = false;
         if (currentFieldValid()) {
             comms::util::tupleForSelectedType<Members>(
-                memIdx_, details::VariantSetVersionHelper<VersionType>(version, updated, &storage_));
+                memIdx_, details::VariantSetVersionHelper<StorageAccess, VersionType>(version, updated, &storage_));
         }
         return updated;
     }
@@ -190,8 +190,11 @@ class AdaptBasicField
      using RemLengthMemberFieldAdapted = 
         typename ParsedOptions::template AdaptRemLengthMemberField<SequenceTerminationFieldSuffixAdapted>;
 
+    using PresenceBitmaskMemberFieldAdapted = 
+        typename ParsedOptions::template AdaptPresenceBitmaskMemberField<RemLengthMemberFieldAdapted>;
+
     using DefaultValueInitialiserAdapted = 
-        typename ParsedOptions::template AdaptDefaultValueInitialiser<RemLengthMemberFieldAdapted>;
+        typename ParsedOptions::template AdaptDefaultValueInitialiser<PresenceBitmaskMemberFieldAdapted>;
 
     using MultiRangeValidationAdapted = 
         typename ParsedOptions::template AdaptMultiRangeValidation<DefaultValueInitialiserAdapted>;
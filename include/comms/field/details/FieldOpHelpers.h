@@ -217,7 +217,7 @@ template <typename TIter>
 class FieldWriteHelper
 {
 public:
-    FieldWriteHelper(ErrorStatus& es, TIter& iter, std::size_t len)
+    COMMS_CONSTEXPR20 FieldWriteHelper(ErrorStatus& es, TIter& iter, std::size_t len)
       : es_(es),
         iter_(iter),
         len_(len)
@@ -225,7 +225,7 @@ public:
     }
 
     template <typename TField>
-    void operator()(const TField& field)
+    COMMS_CONSTEXPR20 void operator()(const TField& field)
     {
         if (es_ != comms::ErrorStatus::Success) {
             return;
@@ -247,13 +247,13 @@ template <typename TIter>
 class FieldWriteNoStatusHelper
 {
 public:
-    FieldWriteNoStatusHelper(TIter& iter)
+    COMMS_CONSTEXPR20 FieldWriteNoStatusHelper(TIter& iter)
       : iter_(iter)
     {
     }
 
     template <typename TField>
-    void operator()(const TField& field)
+    COMMS_CONSTEXPR20 void operator()(const TField& field)
     {
         field.writeNoStatus(iter_);
     }
@@ -294,6 +294,67 @@ struct FieldWriteNoStatusDetectHelper
     }
 };
 
+template<typename...>
+struct FieldStrictMaxLengthDetectHelper
+{
+    template <typename TField>
+    constexpr bool operator()() const
+    {
+        return TField::hasStrictMaxLength();
+    }
+
+    template <typename TField>
+    constexpr bool operator()(bool soFar) const
+    {
+        return TField::hasStrictMaxLength() && soFar;
+    }
+};
+
+template<typename...>
+struct FieldHostLayoutDetectHelper
+{
+    template <typename TField>
+    constexpr bool operator()() const
+    {
+        return hasHostLayout<TField>();
+    }
+
+    template <typename TField>
+    constexpr bool operator()(bool soFar) const
+    {
+        return hasHostLayout<TField>() && soFar;
+    }
+
+private:
+    template <typename TField>
+    static constexpr bool hasHostLayout()
+    {
+        return
+            TField::hasHostLayout() &&
+            (!TField::isVersionDependent()) &&
+            (TField::minLength() == TField::maxLength()) &&
+            (sizeof(TField) == TField::minLength());
+    }
+};
+
+template <typename... TFields>
+struct FieldFixedLengthReadNoStatusPrefixCountHelper;
+
+template <>
+struct FieldFixedLengthReadNoStatusPrefixCountHelper<>
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename TField, typename... TRest>
+struct FieldFixedLengthReadNoStatusPrefixCountHelper<TField, TRest...>
+{
+    static const std::size_t Value = 
+        ((TField::minLength() == TField::maxLength()) && TField::hasReadNoStatus()) ? 
+            (1U + FieldFixedLengthReadNoStatusPrefixCountHelper<TRest...>::Value) : 
+            0U;
+};
+
 template <typename...>
 struct FieldCanWriteCheckHelper
 {
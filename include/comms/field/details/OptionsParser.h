@@ -53,6 +53,7 @@ public:
     static constexpr bool HasSequenceTrailingFieldSuffix = false;
     static constexpr bool HasSequenceTerminationFieldSuffix = false;
     static constexpr bool HasRemLengthMemberField = false;
+    static constexpr bool HasPresenceBitmaskMemberField = false;
     static constexpr bool HasDefaultValueInitialiser = false;
     static constexpr bool HasMultiRangeValidation = false;
     static constexpr bool HasCustomValidator = false;
@@ -68,11 +69,15 @@ public:
     static constexpr bool HasScalingRatio = false;
     static constexpr bool HasUnits = false;
     static constexpr bool HasOrigDataView = false;
+    static constexpr bool HasColumnarStorage = false;
+    static constexpr bool HasHostLayoutStorage = false;
+    static constexpr bool HasInternedStringStorage = false;
     static constexpr bool HasCustomVersionUpdate = false;
     static constexpr bool HasFieldType = false;
     static constexpr bool HasMissingOnReadFail = false;
     static constexpr bool HasMissingOnInvalid = false;
     static constexpr bool HasVariantCustomResetOnDestruct = false;
+    static constexpr bool HasVariantSpillLargeMembers = false;
     static constexpr bool HasVersionDependentMembersForced = false;
     static constexpr bool HasFixedValue = false;
     static constexpr bool HasDisplayOffset = false;
@@ -91,6 +96,7 @@ public:
 
     static constexpr std::size_t SequenceFixedSize = std::numeric_limits<std::size_t>::max();
     static constexpr MembersVersionDependency ForcedMembersVersionDependency = MembersVersionDependency_NotSpecified;
+    static constexpr std::size_t VariantSpillThreshold = 0U;
 
     template <typename TField>
     using AdaptInvalidByDefault = TField;
@@ -149,6 +155,9 @@ public:
     template <typename TField>
     using AdaptRemLengthMemberField = TField;
 
+    template <typename TField>
+    using AdaptPresenceBitmaskMemberField = TField;
+
     template <typename TField>
     using AdaptDefaultValueInitialiser = TField;
 
@@ -572,6 +581,35 @@ public:
     static constexpr bool HasOrigDataView = true;
 };
 
+template <typename... TOptions>
+class OptionsParser<
+    comms::option::app::ColumnarStorage,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasColumnarStorage = true;
+};
+
+template <typename... TOptions>
+class OptionsParser<
+    comms::option::app::HostLayoutStorage,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasHostLayoutStorage = true;
+};
+
+template <std::size_t TCapacity, typename TTag, typename... TOptions>
+class OptionsParser<
+    comms::option::app::InternedStringStorage<TCapacity, TTag>,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasInternedStringStorage = true;
+    static constexpr std::size_t InternedStringStorageCapacity = TCapacity;
+    using InternedStringStorageTag = TTag;
+};
+
 template <typename... TOptions>
 class OptionsParser<
     comms::option::def::EmptySerialization,
@@ -729,6 +767,23 @@ public:
         comms::field::adapter::RemLengthMemberField<RemLengthMemberFieldIdx, TField>;
 };
 
+template <std::size_t TIdx, typename... TOptions>
+class OptionsParser<
+    comms::option::def::PresenceBitmaskMemberField<TIdx>,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+    using BaseImpl = OptionsParser<TOptions...>;
+    static_assert(!BaseImpl::HasPresenceBitmaskMemberField, 
+        "Option comms::def::option::PresenceBitmaskMemberField used multiple times");
+public:
+    static constexpr bool HasPresenceBitmaskMemberField = true;
+    static constexpr std::size_t PresenceBitmaskMemberFieldIdx = TIdx;
+
+    template <typename TField>
+    using AdaptPresenceBitmaskMemberField = 
+        comms::field::adapter::PresenceBitmaskMemberField<PresenceBitmaskMemberFieldIdx, TField>;
+};
+
 template <typename... TOptions>
 class OptionsParser<
     comms::option::def::HasCustomWrite,
@@ -790,6 +845,17 @@ public:
     using AdaptVariantResetOnDestruct = TField;    
 };
 
+template <std::size_t TThreshold, typename... TOptions>
+class OptionsParser<
+    comms::option::app::VariantSpillLargeMembers<TThreshold>,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+    static_assert(0U < TThreshold, "The spill threshold must be greater than 0");
+public:
+    static constexpr bool HasVariantSpillLargeMembers = true;
+    static constexpr std::size_t VariantSpillThreshold = TThreshold;
+};
+
 template <bool TVersionDependent, typename... TOptions>
 class OptionsParser<
     comms::option::def::HasVersionDependentMembers<TVersionDependent>,
@@ -26,6 +26,7 @@
 #include "comms/field/adapter/MissingOnInvalid.h"
 #include "comms/field/adapter/MissingOnReadFail.h"
 #include "comms/field/adapter/NumValueMultiRangeValidator.h"
+#include "comms/field/adapter/PresenceBitmaskMemberField.h"
 #include "comms/field/adapter/RemLengthMemberField.h"
 #include "comms/field/adapter/SequenceElemFixedSerLengthFieldPrefix.h"
 #include "comms/field/adapter/SequenceElemLengthForcing.h"
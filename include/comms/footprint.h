@@ -0,0 +1,461 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of functions that report memory footprint
+///     of fields and messages.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "comms/details/tag.h"
+#include "comms/field/tag.h"
+#include "comms/util/Tuple.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+/// @brief Memory footprint information of a single field or message type.
+/// @details Reported by @ref comms::footprintVisitField() and
+///     @ref comms::footprintVisitMessage().
+/// @headerfile comms/footprint.h
+struct FootprintInfo
+{
+    /// @brief Nesting depth, @b 0 for the reported type itself.
+    std::size_t depth;
+
+    /// @brief Index of the member within its parent.
+    std::size_t index;
+
+    /// @brief Name of the field, @b nullptr if unknown.
+    const char* name;
+
+    /// @brief Result of @b sizeof() on the type.
+    std::size_t size;
+
+    /// @brief Result of @b alignof() on the type.
+    std::size_t alignment;
+
+    /// @brief Bytes of the object not occupied by the direct members or value storage.
+    /// @details Includes alignment padding as well as extra bookkeeping data, such
+    ///     as index of the @ref comms::field::Variant member, mode of the
+    ///     @ref comms::field::Optional, version storage or v-table pointer of the message.
+    std::size_t overhead;
+
+    /// @brief Minimal serialisation length.
+    std::size_t minLength;
+
+    /// @brief Maximal serialisation length.
+    std::size_t maxLength;
+
+    /// @brief Whether the reported @ref maxLength is a strict upper limit.
+    /// @details Variable length collections without fixed size storage
+    ///     report the maximal length their size prefix can express, which
+    ///     is not a strict limit.
+    bool strictMaxLength;
+};
+
+namespace details
+{
+
+template <typename...>
+class FootprintHelper
+{
+public:
+    template <typename TField>
+    static constexpr FootprintInfo fieldInfo(std::size_t depth, std::size_t idx, const char* name)
+    {
+        return FootprintInfo{
+            depth,
+            idx,
+            name,
+            sizeof(TField),
+            alignof(TField),
+            sizeof(TField) - valueSize<TField>(typename TField::CommsTag()),
+            TField::minLength(),
+            TField::maxLength(),
+            TField::hasStrictMaxLength()
+        };
+    }
+
+    template <typename TMsg>
+    static constexpr FootprintInfo messageInfo(const char* name)
+    {
+        return FootprintInfo{
+            0U,
+            0U,
+            name,
+            sizeof(TMsg),
+            alignof(TMsg),
+            sizeof(TMsg) - membersSize<typename TMsg::AllFields>(),
+            TMsg::doMinLength(),
+            TMsg::doMaxLength(),
+            TMsg::doFieldsHaveStrictMaxLength()
+        };
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitField(TFunc& func, std::size_t depth, std::size_t idx, const char* name)
+    {
+        func(fieldInfo<TField>(depth, idx, fieldName<TField>(name, NameTag<TField>())));
+        visitFieldMembers<TField>(func, depth + 1U, typename TField::CommsTag());
+    }
+
+    template <typename TMsg, typename TFunc>
+    static void visitMessage(TFunc& func, const char* name)
+    {
+        func(messageInfo<TMsg>(messageName<TMsg>(name, MessageNameTag<TMsg>())));
+        visitMembers<typename TMsg::AllFields>(func, 1U);
+    }
+
+    template <typename TBuf>
+    class ReportAppendHelper
+    {
+    public:
+        ReportAppendHelper(TBuf& buf, const char* defaultName) : buf_(buf), defaultName_(defaultName) {}
+
+        void operator()(const FootprintInfo& info)
+        {
+            for (auto idx = 0U; idx < info.depth; ++idx) {
+                appendLiteral(buf_, "  ");
+            }
+
+            appendName(info);
+            appendLiteral(buf_, ": size=");
+            appendUnsigned(buf_, info.size);
+            appendLiteral(buf_, ", align=");
+            appendUnsigned(buf_, info.alignment);
+            appendLiteral(buf_, ", overhead=");
+            appendUnsigned(buf_, info.overhead);
+            appendLiteral(buf_, ", minLength=");
+            appendUnsigned(buf_, info.minLength);
+            appendLiteral(buf_, ", maxLength=");
+            appendUnsigned(buf_, info.maxLength);
+            if (!info.strictMaxLength) {
+                appendLiteral(buf_, " (non-strict)");
+            }
+            buf_.push_back('\n');
+        }
+
+    private:
+        void appendName(const FootprintInfo& info)
+        {
+            if (info.name != nullptr) {
+                appendLiteral(buf_, info.name);
+                return;
+            }
+
+            if (info.depth == 0U) {
+                appendLiteral(buf_, defaultName_);
+                return;
+            }
+
+            appendLiteral(buf_, "field");
+            appendUnsigned(buf_, info.index);
+        }
+
+        TBuf& buf_;
+        const char* defaultName_ = nullptr;
+    };
+
+private:
+    template <typename... TParams>
+    using NamedTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using UnnamedTag = comms::details::tag::Tag2<>;
+
+    template <typename TField>
+    using NameTag =
+        typename comms::util::LazyShallowConditional<
+            TField::hasName()
+        >::template Type<
+            NamedTag,
+            UnnamedTag
+        >;
+
+    template <typename TMsg>
+    using MessageNameTag =
+        typename comms::util::LazyShallowConditional<
+            TMsg::hasCustomName()
+        >::template Type<
+            NamedTag,
+            UnnamedTag
+        >;
+
+    struct SizeAccumulateHelper
+    {
+        template <typename TElem, typename TValue>
+        constexpr TValue operator()(const TValue& value) const
+        {
+            return value + sizeof(TElem);
+        }
+    };
+
+    template <typename TFunc>
+    class MemberVisitHelper
+    {
+    public:
+        MemberVisitHelper(TFunc& func, std::size_t depth) : func_(func), depth_(depth) {}
+
+        template <typename TField>
+        void operator()()
+        {
+            visitField<TField>(func_, depth_, idx_, nullptr);
+            ++idx_;
+        }
+
+    private:
+        TFunc& func_;
+        std::size_t depth_ = 0U;
+        std::size_t idx_ = 0U;
+    };
+
+    template <typename TMembers>
+    static constexpr std::size_t membersSize()
+    {
+        return comms::util::tupleTypeAccumulate<TMembers>(std::size_t(0U), SizeAccumulateHelper());
+    }
+
+    template <typename TField>
+    static constexpr std::size_t valueSize(comms::field::tag::Bundle)
+    {
+        return membersSize<typename TField::ValueType>();
+    }
+
+    template <typename TField>
+    static constexpr std::size_t valueSize(comms::field::tag::Bitfield)
+    {
+        return membersSize<typename TField::ValueType>();
+    }
+
+    template <typename TField, typename TTag>
+    static constexpr std::size_t valueSize(TTag)
+    {
+        return sizeof(typename TField::ValueType);
+    }
+
+    template <typename TField, typename... TParams>
+    static const char* fieldName(const char* name, NamedTag<TParams...>)
+    {
+        static_cast<void>(name);
+        return TField::name();
+    }
+
+    template <typename TField, typename... TParams>
+    static const char* fieldName(const char* name, UnnamedTag<TParams...>)
+    {
+        return name;
+    }
+
+    template <typename TMsg, typename... TParams>
+    static const char* messageName(const char* name, NamedTag<TParams...>)
+    {
+        if (name != nullptr) {
+            return name;
+        }
+
+        return TMsg::doName();
+    }
+
+    template <typename TMsg, typename... TParams>
+    static const char* messageName(const char* name, UnnamedTag<TParams...>)
+    {
+        return name;
+    }
+
+    template <typename TMembers, typename TFunc>
+    static void visitMembers(TFunc& func, std::size_t depth)
+    {
+        comms::util::tupleForEachType<TMembers>(MemberVisitHelper<TFunc>(func, depth));
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, comms::field::tag::Bundle)
+    {
+        visitMembers<typename TField::ValueType>(func, depth);
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, comms::field::tag::Bitfield)
+    {
+        visitMembers<typename TField::ValueType>(func, depth);
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, comms::field::tag::Variant)
+    {
+        visitMembers<typename TField::Members>(func, depth);
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, comms::field::tag::Optional)
+    {
+        visitField<typename TField::Field>(func, depth, 0U, nullptr);
+    }
+
+    template <typename TField, typename TFunc>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, comms::field::tag::ArrayList)
+    {
+        visitField<typename TField::ElementType>(func, depth, 0U, "element");
+    }
+
+    template <typename TField, typename TFunc, typename TTag>
+    static void visitFieldMembers(TFunc& func, std::size_t depth, TTag)
+    {
+        static_cast<void>(func);
+        static_cast<void>(depth);
+    }
+
+    template <typename TBuf>
+    static void appendLiteral(TBuf& buf, const char* str)
+    {
+        while (*str != '\0') {
+            buf.push_back(*str);
+            ++str;
+        }
+    }
+
+    template <typename TBuf>
+    static void appendUnsigned(TBuf& buf, std::uintmax_t value)
+    {
+        char digits[std::numeric_limits<std::uintmax_t>::digits10 + 1];
+        std::size_t count = 0U;
+        do {
+            digits[count] = static_cast<char>('0' + (value % 10U));
+            value /= 10U;
+            ++count;
+        } while (value != 0U);
+
+        while (0U < count) {
+            --count;
+            buf.push_back(digits[count]);
+        }
+    }
+};
+
+} // namespace details
+
+/// @brief Compile time memory footprint information of the field type.
+/// @details Can be used in @b static_assert() statements to detect
+///     unexpected growth of the field objects.
+///     @code
+///     static_assert(comms::footprintOfField<MyField>().size <= 16U, "MyField is too big");
+///     @endcode
+/// @tparam TField Field type.
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TField>
+constexpr FootprintInfo footprintOfField()
+{
+    return details::FootprintHelper<>::fieldInfo<TField>(0U, 0U, nullptr);
+}
+
+/// @brief Compile time memory footprint information of the message type.
+/// @details Similar to @ref comms::footprintOfField(). The @b overhead
+///     member includes the v-table pointer of the polymorphic interface
+///     and the storage of the transport fields (if such exist).
+/// @tparam TMsg Message type, expected to be (or derive from) @ref comms::MessageBase
+///     with fields provided via @ref comms::option::def::FieldsImpl option.
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TMsg>
+constexpr FootprintInfo footprintOfMessage()
+{
+    return details::FootprintHelper<>::messageInfo<TMsg>(nullptr);
+}
+
+/// @brief Walk the member fields tree of the field type and report
+///     memory footprint of every node.
+/// @details The provided function is invoked with @ref comms::FootprintInfo
+///     of the field itself (depth @b 0) followed by the information on its members
+///     in the depth-first order:
+///     @li @ref comms::field::Bundle and @ref comms::field::Bitfield report their members;
+///     @li @ref comms::field::Variant reports all its supported member types;
+///     @li @ref comms::field::Optional reports the wrapped field;
+///     @li @ref comms::field::ArrayList of fields reports its element type.
+///
+///     The name of the field is taken from its @b name() function when provided
+///     (see @ref comms::option::def::HasName), the name of the list element
+///     is reported as @b "element", @b nullptr otherwise.
+///     @code
+///     comms::footprintVisitField<MyField>(
+///         [](const comms::FootprintInfo& info)
+///         {
+///             ...
+///         });
+///     @endcode
+/// @tparam TField Field type.
+/// @param[in] func Function object accepting @ref comms::FootprintInfo.
+/// @param[in] name Name to report for the field itself, its own name (if available) takes precedence.
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TField, typename TFunc>
+void footprintVisitField(TFunc&& func, const char* name = nullptr)
+{
+    details::FootprintHelper<>::visitField<TField>(func, 0U, 0U, name);
+}
+
+/// @brief Walk the fields tree of the message type and report
+///     memory footprint of every node.
+/// @details Similar to @ref comms::footprintVisitField(), the message itself
+///     is reported at depth @b 0 followed by its fields.
+/// @tparam TMsg Message type, expected to be (or derive from) @ref comms::MessageBase
+///     with fields provided via @ref comms::option::def::FieldsImpl option.
+/// @param[in] func Function object accepting @ref comms::FootprintInfo.
+/// @param[in] name Name to report for the message, when not provided the
+///     name is taken from the message's @b doName() function (if available,
+///     see @ref comms::MessageBase::hasCustomName()).
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TMsg, typename TFunc>
+void footprintVisitMessage(TFunc&& func, const char* name = nullptr)
+{
+    details::FootprintHelper<>::visitMessage<TMsg>(func, name);
+}
+
+/// @brief Append human readable memory footprint report of the field type
+///     to the provided buffer.
+/// @details Every node reported by @ref comms::footprintVisitField() is
+///     appended as a separate line, indented according to its depth:
+///     @code
+///     MyField: size=8, align=4, overhead=1, minLength=3, maxLength=3
+///       field0: size=1, align=1, overhead=0, minLength=1, maxLength=1
+///       field1: size=4, align=4, overhead=0, minLength=2, maxLength=2
+///     @endcode
+///     Unnamed members are reported as @b "fieldN", where @b N is the index of the
+///     member. The maximal length which is not a strict upper limit is
+///     followed by the @b "(non-strict)" suffix. The buffer can be any container with @b push_back(char) member function.
+/// @tparam TField Field type.
+/// @param[in, out] buf Output buffer.
+/// @param[in] name Name to report for the field itself.
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TField, typename TBuf>
+void footprintAppendFieldReport(TBuf& buf, const char* name = nullptr)
+{
+    using Helper = details::FootprintHelper<>::ReportAppendHelper<TBuf>;
+    footprintVisitField<TField>(Helper(buf, "field"), name);
+}
+
+/// @brief Append human readable memory footprint report of the message type
+///     to the provided buffer.
+/// @details Same as @ref comms::footprintAppendFieldReport(), but walks
+///     the fields of the message.
+/// @tparam TMsg Message type, expected to be (or derive from) @ref comms::MessageBase
+///     with fields provided via @ref comms::option::def::FieldsImpl option.
+/// @param[in, out] buf Output buffer.
+/// @param[in] name Name to report for the message.
+/// @note Defined in "comms/footprint.h" headerfile
+template <typename TMsg, typename TBuf>
+void footprintAppendMessageReport(TBuf& buf, const char* name = nullptr)
+{
+    using Helper = details::FootprintHelper<>::ReportAppendHelper<TBuf>;
+    footprintVisitMessage<TMsg>(Helper(buf, "message"), name);
+}
+
+} // namespace comms
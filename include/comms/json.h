@@ -0,0 +1,119 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of functions that produce JSON representation
+///     of fields and messages.
+
+#pragma once
+
+#include "comms/details/JsonHelper.h"
+#include "comms/details/tag.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename...>
+class JsonMessageHelper
+{
+public:
+    template <typename TBuf, typename TMsg>
+    static void append(TBuf& buf, const TMsg& msg)
+    {
+        using Tag =
+            typename comms::util::LazyShallowConditional<
+                TMsg::hasCustomName()
+            >::template Type<
+                NamedTag,
+                UnnamedTag
+            >;
+
+        appendInternal(buf, msg, Tag());
+    }
+
+private:
+    template <typename... TParams>
+    using NamedTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using UnnamedTag = comms::details::tag::Tag2<>;
+
+    template <typename TBuf, typename TMsg>
+    static void appendInternal(TBuf& buf, const TMsg& msg, NamedTag<>)
+    {
+        using Helper = JsonHelper<>;
+        Helper::appendLiteral(buf, "{\"name\":");
+        Helper::appendQuoted(buf, msg.doName());
+        Helper::appendLiteral(buf, ",\"fields\":");
+        Helper::appendMembers(buf, msg.fields());
+        Helper::appendChar(buf, '}');
+    }
+
+    template <typename TBuf, typename TMsg>
+    static void appendInternal(TBuf& buf, const TMsg& msg, UnnamedTag<>)
+    {
+        JsonHelper<>::appendMembers(buf, msg.fields());
+    }
+};
+
+} // namespace details
+
+/// @brief Append JSON representation of the field to the provided buffer.
+/// @details The field's structure is walked at compile time, no dynamic memory
+///     allocation is performed by the function itself:
+///     @li integral, enum and bitmask fields are appended as numbers;
+///     @li floating point fields are appended as numbers with enough precision
+///         to restore the value, @b NaN and infinities are appended as @b null,
+///         the output doesn't depend on the current C locale;
+///     @li string fields are appended as escaped JSON strings;
+///     @li raw data lists are appended as arrays of numbers, lists of fields
+///         as arrays of JSON representations of the elements;
+///     @li bundles and bitfields are appended as objects, member name is
+///         taken from the member's @b name() function when provided
+///         (see @ref comms::option::def::HasName), @b "fieldN" otherwise;
+///     @li variants are appended as JSON representation of the currently
+///         selected member, @b null when none is selected;
+///     @li missing optional fields are appended as @b null.
+///
+///     The buffer can be any container with @b push_back(char) member function,
+///     for example @ref comms::util::StaticString or @b std::string with
+///     pre-reserved capacity which is cleared and reused between the calls.
+///     @code
+///     comms::util::StaticString<256> buf;
+///     comms::jsonAppend(buf, field);
+///     @endcode
+/// @param[in, out] buf Output buffer.
+/// @param[in] field Field object.
+/// @note Defined in "comms/json.h" headerfile
+template <typename TBuf, typename TField>
+void jsonAppend(TBuf& buf, const TField& field)
+{
+    details::JsonHelper<>::appendField(buf, field);
+}
+
+/// @brief Append JSON representation of the message to the provided buffer.
+/// @details The message fields are appended as JSON object the same way as
+///     members of the bundle field (see @ref comms::jsonAppend()).
+///     When the message definition reports its name (see
+///     @ref comms::MessageBase::hasCustomName()), the output has the following form:
+///     @code
+///     {"name":"<message name>","fields":{...}}
+///     @endcode
+/// @param[in, out] buf Output buffer.
+/// @param[in] msg Message object, expected to be (or derive from) @ref comms::MessageBase.
+/// @note Defined in "comms/json.h" headerfile
+template <typename TBuf, typename TMsg>
+void jsonAppendMessage(TBuf& buf, const TMsg& msg)
+{
+    details::JsonMessageHelper<>::append(buf, msg);
+}
+
+} // namespace comms
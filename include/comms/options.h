@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <cstddef>
 
+#include "comms/CompileControl.h"
 #include "comms/traits.h"
 #include "comms/ErrorStatus.h"
 #include "comms/field/OptionalMode.h"
@@ -53,7 +54,7 @@ template<typename T, T TVal>
 struct DefaultNumValueInitialiser
 {
     template <typename TField>
-    void operator()(TField&& field)
+    COMMS_CONSTEXPR20 void operator()(TField&& field)
     {
         using FieldType = typename std::decay<TField>::type;
         using ValueType = typename FieldType::ValueType;
@@ -1081,6 +1082,18 @@ using DefaultVariantIndex = DefaultValueInitialiser<details::DefaultVariantIndex
 /// @headerfile comms/options.h
 struct ChecksumLayerVerifyBeforeRead {};
 
+/// @brief Force @ref comms::protocol::ChecksumLayer to calculate the checksum
+///     while the wrapped layer(s) read or write the data instead of iterating
+///     over the same data again afterwards.
+/// @details The iterator passed to the wrapped layer(s) gets replaced with
+///     @ref comms::protocol::checksum::SinglePassIterator, which requires
+///     the checksum calculator to support incremental calculation.
+///     Has no effect when used with @ref ChecksumLayerVerifyBeforeRead
+///     for the read operation. See also @ref comms::protocol::checksum::SinglePassIterator
+///     for the requirements of the message interface definition.
+/// @headerfile comms/options.h
+struct ChecksumLayerSinglePass {};
+
 /// @brief Force field not to be serialized during read/write operations
 /// @details Some protocols may define some constant values that are predefined
 ///     and are not present on I/O link when serialized. Sometimes it is convenient
@@ -1215,6 +1228,21 @@ struct ExtendingClass {};
 template <std::size_t TIdx>
 struct RemLengthMemberField {};
 
+/// @brief Option to specify index of member field containing bitmask of
+///     presence flags of the following @ref comms::field::Optional members.
+/// @details Applicable only to @ref comms::field::Bundle fields. The bundle
+///     member at index @b TIdx is expected to be @ref comms::field::BitmaskValue
+///     (or any other field with integral value), all the members following it
+///     are expected to be @ref comms::field::Optional. The bit @b N of
+///     the bitmask indicates presence of the member with index <b>TIdx + 1 + N</b>.
+///     The modes of the optional members are updated in the same pass as
+///     they are being read, while the bitmask value is calculated from
+///     the modes of the optional members on @b write() and @b refresh(),
+///     i.e. there is no need to provide custom @b read() and/or @b refresh() functionality.
+/// @headerfile comms/options.h
+template <std::size_t TIdx>
+struct PresenceBitmaskMemberField {};
+
 /// @brief Mark an @ref comms::field::Optional field as missing
 ///     if its read operation fails.
 /// @headerfile comms/options.h
@@ -1331,6 +1359,19 @@ struct NoRefreshImpl {};
 /// @headerfile comms/options.h
 struct InPlaceAllocation {};
 
+/// @brief Option that forces the message factory to return the allocated
+///     message objects held by the intrusively reference counted
+///     @ref comms::util::alloc::SharedPtr instead of @b std::unique_ptr.
+/// @details The reference counter is updated atomically and located in
+///     the same allocation as the message object itself, which allows cheap sharing
+///     of a single decoded message between multiple consumers (possibly running
+///     on different threads). Can be combined with @ref comms::option::app::InPlaceAllocation,
+///     in such case new message object can be allocated only after all the pointers
+///     to the previous one have been destructed. Applicable to @ref comms::MsgFactory
+///     and @ref comms::protocol::MsgIdLayer.
+/// @headerfile comms/options.h
+struct SharedMsgPtr {};
+
 /// @brief Option used to allow @ref comms::GenericMessage generation inside
 ///  @ref comms::MsgFactory and/or @ref comms::protocol::MsgIdLayer classes.
 /// @tparam TGenericMessage Type of message, expected to be a variant of
@@ -1407,6 +1448,78 @@ struct NoVirtualDestructor {};
 /// @headerfile comms/options.h
 struct OrigDataView {};
 
+/// @brief Store the elements of @ref comms::field::ArrayList as
+///     "struct of arrays".
+/// @details Applicable only to @ref comms::field::ArrayList of
+///     @ref comms::field::Bundle elements of fixed serialisation length.
+///     It forces usage of @ref comms::util::ColumnarVector as inner storage
+///     type (instead of @b std::vector of bundles), which keeps the values of
+///     every bundle member in a separate contiguous column. The elements are
+///     accessed via proxy objects, while the columns can be accessed
+///     directly as @b std::vector of member values.
+/// @note Incompatible with other options that control data storage type,
+///     such as @ref comms::option::app::CustomStorageType or @ref comms::option::app::FixedSizeStorage,
+///     as well as with the options that require access to the elements by reference,
+///     such as @ref comms::option::def::SequenceElemSerLengthFieldPrefix or
+///     @ref comms::option::def::SequenceTerminationFieldSuffix.
+/// @headerfile comms/options.h
+struct ColumnarStorage {};
+
+/// @brief Store the members of @ref comms::field::Bundle in the
+///     layout of their serialised data.
+/// @details Applicable only to @ref comms::field::Bundle. When all the members
+///     are serialised exactly as their values are stored in memory (such as
+///     @ref comms::field::IntValue fields serialised with the endian of the host
+///     without options modifying the serialisation) and their offsets in the
+///     packed storage are properly aligned, it forces usage of
+///     @ref comms::util::PackedTuple as inner storage type (instead of @b std::tuple).
+///     Such bundle reports @b true from its @b hasHostLayout() and is
+///     (de)serialised with a single @b memcpy() when the raw data is accessed via
+///     pointer. The @ref comms::field::ArrayList of such bundles (without padding
+///     at the end) is (de)serialised with a single @b memcpy() as well.
+///     Otherwise the option is ignored.
+/// @note The members of @ref comms::util::PackedTuple cannot be accessed with
+///     @b std::get(), use the accessor functions generated by the
+///     @ref COMMS_FIELD_MEMBERS_NAMES() macro or @ref comms::util::tupleGet() instead.
+/// @headerfile comms/options.h
+struct HostLayoutStorage {};
+
+/// @brief Store the value of @ref comms::field::String in the table of
+///     interned strings.
+/// @details Forces usage of @ref comms::util::InternedString as inner storage type
+///     (instead of @b std::string). Every distinct string value is stored
+///     once in the @ref comms::util::InternTable with the provided capacity, while
+///     the field keeps only a handle to it. Reading of a previously seen value
+///     doesn't allocate memory, and comparison of two values is a pointer comparison.
+///     The lookup in the table is lock-free. When the table is full the new values
+///     are copied into a separately allocated buffer owned by the field. When used
+///     with @ref comms::option::def::SequenceFixedSize, the zero padding is
+///     dropped before the value is interned.
+/// @tparam TCapacity Maximal number of distinct strings kept in the table.
+/// @tparam TTag Tag type to distinguish independent tables of the same capacity,
+///     the fields that use the same capacity and tag share the table.
+/// @note Incompatible with other options that control data storage type,
+///     such as @ref comms::option::app::CustomStorageType or @ref comms::option::app::FixedSizeStorage.
+/// @headerfile comms/options.h
+template <std::size_t TCapacity, typename TTag = void>
+struct InternedStringStorage {};
+
+/// @brief Store large members of @ref comms::field::Variant out-of-line.
+/// @details By default the @ref comms::field::Variant field contains inline
+///     storage area that can fit the largest of its members. When one of the
+///     alternatives is much larger than the others, every instance of the
+///     field pays for it, even if that alternative is rarely used (consider
+///     @ref comms::field::ArrayList of variants). With this option every
+///     member which size (@b sizeof) exceeds the provided threshold
+///     is allocated on the heap when selected, while the inline storage keeps
+///     only a pointer to it. Members that fit the threshold are still
+///     stored inline without any dynamic memory allocation.
+/// @tparam TThreshold Maximal size (in bytes) of the member stored inline,
+///     must be greater than @b 0.
+/// @headerfile comms/options.h
+template <std::size_t TThreshold>
+struct VariantSpillLargeMembers {};
+
 /// @brief Force a particular way to dispatch message object and/or type.
 /// @tparam T Expected to be one of the tags from @ref comms::traits::dispatch namespace.
 template <typename T>
@@ -1424,6 +1537,10 @@ using ForceDispatchStaticBinSearch = ForceDispatch<comms::traits::dispatch::Stat
 ///     message object and/or message object type
 using ForceDispatchLinearSwitch = ForceDispatch<comms::traits::dispatch::LinearSwitch>;
 
+/// @brief Force generation of flat jump table (indexed by message ID) for
+///     dispatch logic of message object and/or message object type
+using ForceDispatchJumpTable = ForceDispatch<comms::traits::dispatch::JumpTable>;
+
 /// @brief Force usage of the provide message factory.
 /// @details Applicable to @ref comms::protocol::MsgIdLayer.
 /// @tparam TFactory Factory class, expected to expose the same interface as @ref comms::MsgFactory
@@ -1438,6 +1555,102 @@ struct MsgFactory {};
 template <template<typename, typename, typename...> class TFactory>
 struct MsgFactoryTempl {};
 
+/// @brief Add small adaptive cache of recently created message IDs in front
+///     of the ID to type mapping of the @ref comms::MsgFactory.
+/// @details Applicable to @ref comms::MsgFactory and @ref comms::protocol::MsgIdLayer.
+///     The cache is consulted first when a message object is created. On a miss
+///     the configured dispatch lookup is performed. The cached entries count
+///     their hits and are kept sorted by them, so the most frequently received
+///     IDs end up being checked first. The least frequently used entry is aged
+///     on every miss and replaced by the missed ID only when its hits count
+///     drops to the minimum, so rare IDs don't evict the frequent ones. Useful for
+///     the protocols where a few message IDs make up most of the traffic.
+///     Only the first message type (index @b 0) reporting the ID is cached.
+///     The cache is updated only by the non-const @b createMsg() of the factory
+///     (used by the @ref comms::protocol::MsgIdLayer), the const one performs
+///     read-only lookup.@n
+///     Note that the cache adds the cost of a miss to every lookup of the
+///     uncached ID, i.e. it is expected to slow down the message creation when
+///     the traffic is not skewed. Use the @b comms.MsgFactoryBench benchmark
+///     (see @b CC_COMMS_BUILD_BENCHMARKS cmake option) as a reference.
+/// @tparam TSize Maximal number of cached IDs, must be greater than @b 0.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct MsgFactoryHotIdCache {};
+
+/// @brief Seed the message ID cache of the @ref comms::MsgFactory with
+///     the list of the likely IDs.
+/// @details Applicable to @ref comms::MsgFactory and @ref comms::protocol::MsgIdLayer.
+///     The provided IDs are resolved and cached on construction of the factory.
+///     When used without @ref comms::option::app::MsgFactoryHotIdCache, the cache
+///     size equals the number of provided IDs.
+/// @tparam TIds Numeric values of the likely message IDs.
+/// @headerfile comms/options.h
+template <std::intmax_t... TIds>
+struct MsgFactoryLikelyIds {};
+
+/// @brief Make @ref comms::protocol::MsgIdLayer reuse previously decoded
+///     message objects instead of allocating new ones.
+/// @details The layer keeps (per message type) a message object returned
+///     back via @ref comms::protocol::MsgIdLayer::recycleMsg() "recycleMsg()"
+///     and reads the next message of the same type into it. The fields of the
+///     reused object are reset to their default state by copy assignment,
+///     so the storage fields (such as @ref comms::field::ArrayList or
+///     @ref comms::field::String) keep their allocated capacity,
+///     which allows steady state decoding without heap allocations even
+///     when the standard containers are used.
+///     Not applicable in conjunction with @ref comms::option::app::InPlaceAllocation.
+/// @headerfile comms/options.h
+struct MsgIdLayerRecycleMessages {};
+
+/// @brief Minimal size of the payload @ref comms::protocol::CompressionLayer
+///     attempts to compress.
+/// @details Smaller payloads are written as-is. The default threshold is
+///     @b 32 bytes.
+/// @tparam TSize Minimal payload size in bytes.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct CompressionLayerMinSize {};
+
+/// @brief Maximal length of the decompressed data accepted by
+///     @ref comms::protocol::CompressionLayer.
+/// @details The length of the decompressed data is part of the received
+///     frame. The @b read operation fails with @ref comms::ErrorStatus::ProtocolError
+///     when it exceeds the limit, prior to allocating any memory for it. The
+///     @b write operation doesn't compress the longer data.
+///     See @ref comms::protocol::CompressionLayer::maxDecompressedSize() for the
+///     default limit.
+/// @tparam TSize Maximal length of the decompressed data in bytes.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct CompressionLayerMaxSize {};
+
+/// @brief Number of the concurrent in-flight message reassemblies
+///     supported by @ref comms::protocol::FragmentationLayer.
+/// @details Every reassembly occupies a separate buffer. When a first fragment
+///     of a new transfer is received and all the buffers are in use, the least
+///     recently updated reassembly is discarded. The default value is @b 1.
+/// @tparam TCount Number of the reassembly buffers, must be greater than @b 0.
+/// @headerfile comms/options.h
+template <std::size_t TCount>
+struct FragmentationLayerMaxInFlight {};
+
+/// @brief Maximal length of the message data reassembled by
+///     @ref comms::protocol::FragmentationLayer.
+/// @details The reassembly is discarded and the @b read operation fails with
+///     @ref comms::ErrorStatus::InvalidMsgData when the accumulated fragments
+///     exceed the limit. See @ref comms::protocol::FragmentationLayer::maxReassemblySize()
+///     for the default limit.
+/// @tparam TSize Maximal length of the reassembled data in bytes.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct FragmentationLayerMaxSize {};
+
+/// @brief Use the @b "\r\n" (CR LF) sequence instead of the single @b '\n' (LF)
+///     character to terminate the lines in @ref comms::protocol::LineLayer.
+/// @headerfile comms/options.h
+struct LineLayerCrLf {};
+
 } // namespace app
 
 // Definition options
@@ -1771,6 +1984,9 @@ using DefaultVariantIndex = comms::option::def::DefaultVariantIndex<TIdx>;
 /// @brief Same as @ref comms::option::def::ChecksumLayerVerifyBeforeRead
 using ChecksumLayerVerifyBeforeRead = comms::option::def::ChecksumLayerVerifyBeforeRead;
 
+/// @brief Same as @ref comms::option::def::ChecksumLayerSinglePass
+using ChecksumLayerSinglePass = comms::option::def::ChecksumLayerSinglePass;
+
 /// @brief Same as @ref comms::option::def::EmptySerialization
 using EmptySerialization = comms::option::def::EmptySerialization;
 
@@ -1834,6 +2050,10 @@ using ExtendingClass = comms::option::def::ExtendingClass<T>;
 template <std::size_t TIdx>
 using RemLengthMemberField = comms::option::def::RemLengthMemberField<TIdx>;
 
+/// @brief Same as @ref comms::option::def::PresenceBitmaskMemberField
+template <std::size_t TIdx>
+using PresenceBitmaskMemberField = comms::option::def::PresenceBitmaskMemberField<TIdx>;
+
 // Application customization options
 
 /// @brief Same as @ref comms::option::app::EmptyOption
@@ -1887,6 +2107,9 @@ using NoRefreshImpl = comms::option::app::NoRefreshImpl;
 /// @brief Same as @ref comms::option::app::InPlaceAllocation
 using InPlaceAllocation = comms::option::app::InPlaceAllocation;
 
+/// @brief Same as @ref comms::option::app::SharedMsgPtr
+using SharedMsgPtr = comms::option::app::SharedMsgPtr;
+
 /// @brief Same as @ref comms::option::app::SupportGenericMessage
 template <typename TGenericMessage>
 using SupportGenericMessage = comms::option::app::SupportGenericMessage<TGenericMessage>;
@@ -1908,6 +2131,20 @@ using NoVirtualDestructor = comms::option::app::NoVirtualDestructor;
 /// @brief Same as @ref comms::option::app::OrigDataView
 using OrigDataView = comms::option::app::OrigDataView;
 
+/// @brief Same as @ref comms::option::app::ColumnarStorage
+using ColumnarStorage = comms::option::app::ColumnarStorage;
+
+/// @brief Same as @ref comms::option::app::HostLayoutStorage
+using HostLayoutStorage = comms::option::app::HostLayoutStorage;
+
+/// @brief Same as @ref comms::option::app::InternedStringStorage
+template <std::size_t TCapacity, typename TTag = void>
+using InternedStringStorage = comms::option::app::InternedStringStorage<TCapacity, TTag>;
+
+/// @brief Same as @ref comms::option::app::VariantSpillLargeMembers
+template <std::size_t TThreshold>
+using VariantSpillLargeMembers = comms::option::app::VariantSpillLargeMembers<TThreshold>;
+
 /// @brief Same as @ref comms::option::app::ForceDispatch
 template <typename T>
 using ForceDispatch = comms::option::app::ForceDispatch<T>;
@@ -1921,6 +2158,23 @@ using ForceDispatchStaticBinSearch = comms::option::app::ForceDispatchStaticBinS
 /// @brief Same as @ref comms::option::app::ForceDispatchLinearSwitch
 using ForceDispatchLinearSwitch = comms::option::app::ForceDispatchLinearSwitch;
 
+/// @brief Same as @ref comms::option::app::ForceDispatchJumpTable
+using ForceDispatchJumpTable = comms::option::app::ForceDispatchJumpTable;
+
+/// @brief Same as @ref comms::option::app::MsgFactoryHotIdCache
+template <std::size_t TSize>
+using MsgFactoryHotIdCache = comms::option::app::MsgFactoryHotIdCache<TSize>;
+
+/// @brief Same as @ref comms::option::app::MsgFactoryLikelyIds
+template <std::intmax_t... TIds>
+using MsgFactoryLikelyIds = comms::option::app::MsgFactoryLikelyIds<TIds...>;
+
+/// @brief Same as @ref comms::option::app::MsgIdLayerRecycleMessages
+using MsgIdLayerRecycleMessages = comms::option::app::MsgIdLayerRecycleMessages;
+
+/// @brief Same as @ref comms::option::app::LineLayerCrLf
+using LineLayerCrLf = comms::option::app::LineLayerCrLf;
+
 }  // namespace option
 
 }  // namespace comms
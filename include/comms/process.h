@@ -21,6 +21,7 @@
 #include "comms/MsgDispatcher.h"
 #include "comms/details/detect.h"
 #include "comms/details/process.h"
+#include "comms/util/InputBuffer.h"
 #include "comms/util/ScopeGuard.h"
 #include "comms/protocol/ProtocolLayerBase.h"
 
@@ -47,6 +48,10 @@ namespace  comms
 /// @return ErrorStatus of the protocol frame / stack @ref comms::protocol::ProtocolLayerBase::read() "read()"
 ///     operation.
 /// @note Defined in comms/process.h
+/// @note When the frame packs multiple messages (see @ref comms::protocol::BatchLayer),
+///     only the first one is read. The remaining ones need to be read using
+///     @ref comms::protocol::ProtocolLayerBase::readPendingRecord() "readPendingRecord()"
+///     while the input buffer is still valid.
 /// @see @ref page_dispatch
 template <typename TBufIter, typename TFrame, typename TMsg, typename... TExtraValues>
 comms::ErrorStatus processSingle(
@@ -91,6 +96,10 @@ comms::ErrorStatus processSingle(
 /// @brief Process input until first message is recognized, its object is created
 ///     and dispatched to appropriate handling function, or missing data is reported.
 /// @details Similar to @ref comms::processSingle(), but adds dispatch stage.
+///     When the frame packs multiple messages (see @ref comms::protocol::BatchLayer),
+///     all of them are read and dispatched before the function returns, the
+///     @b msg parameter holds the last one. The failure to read one of the
+///     records doesn't prevent the following ones from being dispatched.
 ///     Can be used to implement @ref page_use_prot_transport_read.
 /// @param[in, out] bufIter Iterator to input buffer. Passed by reference and is updated
 ///     when buffer is iterated over. Number of consumed bytes cat be determined by
@@ -109,7 +118,7 @@ comms::ErrorStatus processSingle(
 ///     @ref comms::protocol::ProtocolLayerBase::read() "read()" member function
 ///     of the protocol frame / stack.
 /// @return ErrorStatus of the protocol frame / stack @ref comms::protocol::ProtocolLayerBase::read() "read()"
-///     operation.
+///     operation, i.e. of the first record when multiple messages are packed.
 /// @note Defined in comms/process.h
 /// @note If default dispatch behaviour of the @ref comms::dispatchMsg()
 ///     function doesn't suit the application needs, consider using
@@ -138,22 +147,42 @@ comms::ErrorStatus processSingleWithDispatch(
             comms::protocol::msgIndex(idx),
             extraValues...);
 
-    if (es != comms::ErrorStatus::Success) {
-        return es;
-    }
-
     static_cast<void>(handler);
     using FrameType = typename std::decay<decltype(frame)>::type;
     using AllMessagesType = typename FrameType::AllMessages;
-    auto& msgObj = details::processMsgCastToMsgObj(msg);
-    comms::dispatchMsg<AllMessagesType>(id, idx, msgObj, handler);
+    if (es == comms::ErrorStatus::Success) {
+        auto& msgObj = details::processMsgCastToMsgObj(msg);
+        comms::dispatchMsg<AllMessagesType>(id, idx, msgObj, handler);
+    }
+
+    // The remaining records of the batch are read even if the first one has failed,
+    // the next read operation discards them.
+    while (frame.hasPendingReadRecords()) {
+        details::processMsgReset(msg);
+        id = LocalMsgIdType();
+        idx = 0U;
+        auto recEs =
+            frame.readPendingRecord(
+                msg,
+                comms::protocol::msgId(id),
+                comms::protocol::msgIndex(idx),
+                extraValues...);
+
+        if (recEs != comms::ErrorStatus::Success) {
+            continue;
+        }
+
+        comms::dispatchMsg<AllMessagesType>(id, idx, details::processMsgCastToMsgObj(msg), handler);
+    }
+
     return es;
 }
 
 /// @brief Process input until first message is recognized, its object is created
 ///     and dispatched to appropriate handling function, or missing data is reported.
 /// @details Similar to @ref comms::processSingleWithDispatch(), but allows forcing
-///     a particular dispatch policy.
+///     a particular dispatch policy. All the messages packed into a single frame
+///     are dispatched as well.
 /// @tparam TDispatcher A variant of @ref comms::MsgDispatcher class. It's going
 ///     to be used to dispatch message object into appropriate handling function
 ///     instead of using @ref comms::dispatchMsg() like @ref comms::processSingleWithDispatch()
@@ -205,18 +234,37 @@ comms::ErrorStatus processSingleWithDispatchViaDispatcher(
             comms::protocol::msgIndex(idx),
             extraValues...);
 
-    if (es != comms::ErrorStatus::Success) {
-        return es;
-    }
-
     using FrameType = typename std::decay<decltype(frame)>::type;
     using AllMessagesType = typename FrameType::AllMessages;
     static_assert(
         comms::isMsgDispatcher<TDispatcher>(),
         "TDispatcher is expected to be a variant of comms::MsgDispatcher");
 
-    auto& msgObj = details::processMsgCastToMsgObj(msg);
-    TDispatcher::template dispatch<AllMessagesType>(id, idx, msgObj, handler);
+    if (es == comms::ErrorStatus::Success) {
+        auto& msgObj = details::processMsgCastToMsgObj(msg);
+        TDispatcher::template dispatch<AllMessagesType>(id, idx, msgObj, handler);
+    }
+
+    // The remaining records of the batch are read even if the first one has failed,
+    // the next read operation discards them.
+    while (frame.hasPendingReadRecords()) {
+        details::processMsgReset(msg);
+        id = LocalMsgIdType();
+        idx = 0U;
+        auto recEs =
+            frame.readPendingRecord(
+                msg,
+                comms::protocol::msgId(id),
+                comms::protocol::msgIndex(idx),
+                extraValues...);
+
+        if (recEs != comms::ErrorStatus::Success) {
+            continue;
+        }
+
+        TDispatcher::template dispatch<AllMessagesType>(id, idx, details::processMsgCastToMsgObj(msg), handler);
+    }
+
     return es;
 }
 
@@ -268,6 +316,30 @@ std::size_t processAllWithDispatch(
     return consumed;
 }
 
+/// @brief Process all available input accumulated in the @ref comms::util::InputBuffer
+///     and dispatch all created message objects to appropriate handling function.
+/// @details Similar to @ref comms::processAllWithDispatch(TBufIter, std::size_t, TFrame&&, THandler&),
+///     but also consumes the processed bytes from the buffer. The remaining bytes
+///     of the incomplete message stay in the buffer until more data is received.
+/// @param[in, out] buf Input buffer.
+/// @param[in] frame Protocol frame / stack (see @ref page_use_prot_transport) that
+///     is used to process the raw input.
+/// @param[in] handler Handler to handle message object when dispatched. The dispatch
+///     is performed using @ref comms::dispatchMsg() function.
+/// @return Number of consumed bytes.
+/// @note Defined in comms/process.h
+/// @see @ref page_use_prot_transport_read
+template <typename T, typename TFrame, typename THandler>
+std::size_t processAllWithDispatch(
+    comms::util::InputBuffer<T>& buf,
+    TFrame&& frame,
+    THandler& handler)
+{
+    auto consumed = processAllWithDispatch(buf.data(), buf.size(), std::forward<TFrame>(frame), handler);
+    buf.consume(consumed);
+    return consumed;
+}
+
 /// @brief Process all available input and dispatch all created message objects
 ///     to appropriate handling function.
 /// @details Similar to @ref comms::processAllWithDispatch(), but allows forcing
@@ -317,4 +389,29 @@ std::size_t processAllWithDispatchViaDispatcher(
     return consumed;
 }
 
+/// @brief Process all available input accumulated in the @ref comms::util::InputBuffer
+///     and dispatch all created message objects to appropriate handling function.
+/// @details Similar to @ref comms::processAllWithDispatchViaDispatcher(TBufIter, std::size_t, TFrame&&, THandler&),
+///     but also consumes the processed bytes from the buffer. The remaining bytes
+///     of the incomplete message stay in the buffer until more data is received.
+/// @tparam TDispatcher A variant of @ref comms::MsgDispatcher class.
+/// @param[in, out] buf Input buffer.
+/// @param[in] frame Protocol frame / stack (see @ref page_use_prot_transport) that
+///     is used to process the raw input.
+/// @param[in] handler Handler to handle message object when dispatched. The dispatch
+///     is performed via provded @b TDispatcher class (see @ref comms::MsgDispatcher).
+/// @return Number of consumed bytes.
+/// @note Defined in comms/process.h
+/// @see @ref page_use_prot_transport_read
+template <typename TDispatcher, typename T, typename TFrame, typename THandler>
+std::size_t processAllWithDispatchViaDispatcher(
+    comms::util::InputBuffer<T>& buf,
+    TFrame&& frame,
+    THandler& handler)
+{
+    auto consumed = processAllWithDispatchViaDispatcher<TDispatcher>(buf.data(), buf.size(), std::forward<TFrame>(frame), handler);
+    buf.consume(consumed);
+    return consumed;
+}
+
 } // namespace  comms
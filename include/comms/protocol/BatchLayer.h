@@ -0,0 +1,673 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::BatchLayer
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/BatchLayerOptionsParser.h"
+#include "comms/protocol/details/ProtocolLayerDetails.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/util/type_traits.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that packs multiple messages into a single frame.
+/// @details The layer's field contains the number of the records that follow.
+///     Every record is produced by the wrapped layers, which are expected to
+///     make it self delimiting, for example:
+///     @code
+///     using Frame =
+///         comms::protocol::SyncPrefixLayer<SyncField,
+///             comms::protocol::MsgSizeLayer<SizeField,
+///                 comms::protocol::BatchLayer<CountField,
+///                     comms::protocol::MsgSizeLayer<RecordSizeField,
+///                         comms::protocol::MsgIdLayer<IdField, Message, AllMessages,
+///                             comms::protocol::MsgDataLayer<>
+///                         >
+///                     >
+///                 >
+///             >
+///         >;
+///     @endcode
+///     As the result the transport overhead of the outer layers (sync, size,
+///     checksum) is paid once per batch.@n
+///     @b Write: The messages are appended to the batch using the non-const
+///     @ref queueMsg(). The @b write() operation of the protocol stack writes
+///     the queued records followed by the provided message without modifying
+///     the queue. The number of records in the batch is limited by the maximal
+///     value the field can hold (see @ref maxRecordsCount()), the @ref queueMsg()
+///     refuses to queue more messages than that. The queue needs to be cleared explicitly with @ref discardQueued()
+///     after the batch has been written (and updated if needed). The reported
+///     @b length() of the message object includes all the queued records.
+///     @code
+///     auto& batch = stack.layer_batch();
+///     batch.queueMsg(msg1);
+///     batch.queueMsg(msg2);
+///     auto es = stack.write(msg3, writeIter, bufSize); // Writes all 3 messages
+///     if (es == comms::ErrorStatus::Success) {
+///         batch.discardQueued();
+///     }
+///     @endcode
+///     @b Read: The @b read() operation of the protocol stack reads the first
+///     record of the batch and reports the whole batch as consumed. The remaining
+///     records are read by @ref readNext() directly from the input buffer, i.e.
+///     the input buffer must remain valid until all the records are read or
+///     @ref discardPendingRecords() is called. The @ref readNext() is also
+///     available via the @b readPendingRecord() member function of the
+///     protocol stack, which is used by the processing functions defined in
+///     comms/process.h (such as @ref comms::processAllWithDispatch()) to dispatch
+///     all the records of the batch before the consumed bytes are reported
+///     back to the caller.
+///     @code
+///     auto es = stack.read(msgPtr, readIter, bufSize);
+///     ... // Handle first message
+///     while (stack.hasPendingReadRecords()) {
+///         msgPtr.reset();
+///         es = stack.readPendingRecord(msgPtr);
+///         ... // Handle next message
+///     }
+///     @endcode
+///     The iterators used to access the records are @b const @b std::uint8_t*
+///     for reading and @b std::uint8_t* for writing. When the layer is used
+///     for polymorphic read and/or write of the message objects, they must be convertible
+///     to the @b ReadIterator and/or @b WriteIterator of the message interface.
+///     The iterator used for the @b read() operation of the protocol stack
+///     must be convertible to @b const @b std::uint8_t* as well.@n
+///     The queued records are stored in the internal buffer, which is reused
+///     between the calls, the dynamic memory allocation happens only when its
+///     capacity needs to grow. Use @ref comms::option::app::FixedSizeStorage option
+///     to avoid dynamic memory allocation altogether.@n
+///     When the layer is wrapped by the @ref comms::protocol::ChecksumLayer, it is
+///     recommended to use @ref comms::option::def::ChecksumLayerVerifyBeforeRead option
+///     to avoid reading records of the corrupted frame with @ref readNext().
+/// @tparam TField Type of the field that is used to store number of records.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::FixedSizeStorage - Use fixed size storage
+///         for the queued records instead of @b std::vector. In case
+///         the data doesn't fit, the @ref queueMsg() operation returns
+///         @ref comms::ErrorStatus::BufferOverflow.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/BatchLayer.h
+template <typename TField, typename TNextLayer, typename... TOptions>
+class BatchLayer : public
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                BatchLayer<TField, TNextLayer, TOptions...>,
+                details::BatchLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                BatchLayer<TField, TNextLayer, TOptions...>,
+                details::BatchLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::BatchLayerOptionsParser<TOptions...>;
+    using ScratchBuffer = typename ParsedOptionsInternal::ScratchBuffer;
+
+public:
+    /// @brief Type of the field object used to read/write number of records.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Default constructor
+    explicit BatchLayer() = default;
+
+    /// @brief Copy constructor
+    BatchLayer(const BatchLayer&) = default;
+
+    /// @brief Move constructor
+    BatchLayer(BatchLayer&&) = default;
+
+    /// @brief Destructor.
+    ~BatchLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    BatchLayer& operator=(const BatchLayer&) = default;
+
+    /// @brief Move assignment.
+    BatchLayer& operator=(BatchLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether fixed size storage is used
+    ///     for the queued records.
+    static constexpr bool hasFixedSizeStorage()
+    {
+        return ParsedOptionsInternal::HasFixedSizeStorage;
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame.
+    /// @details The number of records in the batch is not limited.
+    /// @return Always @b std::numeric_limits<std::size_t>::max().
+    template <typename... TParams>
+    static constexpr std::size_t maxFrameLength()
+    {
+        return details::protocolLayerNoMaxFrameLength();
+    }
+
+    /// @brief Compile time evaluation of the maximal number of records in the batch.
+    /// @details Evaluated as the maximal value of the field, which still fits into its
+    ///     serialisation length. Not limited when the value of the field is not integral.
+    ///     May be hidden by the extending class if the number of records
+    ///     is stored in some other way.
+    static constexpr std::size_t maxRecordsCount()
+    {
+        return details::ProtocolLayerFieldMaxValueHelper<Field>::Value;
+    }
+
+    /// @brief Append the message to the batch written by the following @b write() operations.
+    /// @details Invokes the write operation of the next layer into the internal buffer.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @return Status of the write operation. @ref comms::ErrorStatus::BufferOverflow
+    ///     in case the batch already contains @ref maxRecordsCount() records when
+    ///     the message provided to the @b write() operation is counted as well.
+    template <typename TMsg>
+    comms::ErrorStatus queueMsg(const TMsg& msg)
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "BatchLayer requires the message length to be known prior to write");
+
+        auto& thisObj = BaseImpl::thisLayer();
+        if (thisObj.maxRecordsCount() <= (queuedCount_ + 1U)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        auto& nextLayer = BaseImpl::nextLayer();
+        auto prevSize = queuedBuf_.size();
+        auto len = nextLayer.length(msg);
+        if (!prepareScratch(queuedBuf_, prevSize + len)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        std::uint8_t* recBegIter = queuedBuf_.data() + prevSize;
+        std::uint8_t* writeIter = recBegIter;
+        auto es = nextLayer.write(msg, writeIter, len);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            std::uint8_t* updateIter = recBegIter;
+            es = nextLayer.update(msg, updateIter, static_cast<std::size_t>(writeIter - recBegIter));
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            queuedBuf_.resize(prevSize);
+            return es;
+        }
+
+        queuedBuf_.resize(static_cast<std::size_t>(writeIter - queuedBuf_.data()));
+        ++queuedCount_;
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Number of the queued messages.
+    std::size_t queuedCount() const
+    {
+        return queuedCount_;
+    }
+
+    /// @brief Total serialisation length of the queued records.
+    std::size_t queuedLength() const
+    {
+        return queuedBuf_.size();
+    }
+
+    /// @brief Discard all the queued messages.
+    /// @details Expected to be called after the batch has been written.
+    void discardQueued()
+    {
+        queuedBuf_.clear();
+        queuedCount_ = 0U;
+    }
+
+    /// @brief Check whether there are records of the recently read batch
+    ///     which haven't been read yet.
+    bool hasPendingRecords() const
+    {
+        return pendingCount_ != 0U;
+    }
+
+    /// @brief Number of the records of the recently read batch which haven't been read yet.
+    std::size_t pendingRecordsCount() const
+    {
+        return pendingCount_;
+    }
+
+    /// @brief Discard the records of the recently read batch.
+    void discardPendingRecords()
+    {
+        pendingCount_ = 0U;
+        pendingSize_ = 0U;
+        pendingIter_ = nullptr;
+    }
+
+    /// @brief Read the next record of the recently read batch.
+    /// @details Forwards the read operation to the next layer with the
+    ///     iterator to the next record in the input buffer of the recent
+    ///     @b read() operation of the protocol stack.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[out] extraValues Variadic extra output parameters, the same
+    ///     as ones accepted by the @b read() operation of the next layer.
+    /// @return Status of the read operation. @ref comms::ErrorStatus::NotEnoughData
+    ///     in case there are no pending records, @ref comms::ErrorStatus::ProtocolError
+    ///     in case the record is malformed. In the latter case all the remaining
+    ///     records are discarded.
+    template <typename TMsg, typename... TExtraValues>
+    comms::ErrorStatus readNext(TMsg& msg, TExtraValues... extraValues)
+    {
+        if (pendingCount_ == 0U) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto* fromIter = pendingIter_;
+        auto es = BaseImpl::nextLayer().read(msg, pendingIter_, pendingSize_, extraValues...);
+        if ((es == comms::ErrorStatus::NotEnoughData) ||
+            (es == comms::ErrorStatus::ProtocolError)) {
+            discardPendingRecords();
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        pendingSize_ -= static_cast<std::size_t>(pendingIter_ - fromIter);
+        --pendingCount_;
+        return es;
+    }
+
+    /// @brief Same as @ref hasPendingRecords().
+    /// @details Hides and overrides the default implementation provided by
+    ///     the @ref comms::protocol::ProtocolLayerBase.
+    bool hasPendingReadRecords() const
+    {
+        return hasPendingRecords();
+    }
+
+    /// @brief Same as @ref readNext().
+    /// @details Hides and overrides the default implementation provided by
+    ///     the @ref comms::protocol::ProtocolLayerBase.
+    template <typename TMsg, typename... TExtraValues>
+    comms::ErrorStatus readPendingRecord(TMsg& msg, TExtraValues... extraValues)
+    {
+        return readNext(msg, extraValues...);
+    }
+
+    /// @brief Same as @ref discardPendingRecords().
+    /// @details Hides and overrides the default implementation provided by
+    ///     the @ref comms::protocol::ProtocolLayerBase.
+    void discardPendingReadRecords()
+    {
+        discardPendingRecords();
+    }
+
+    /// @cond SKIP_DOC
+
+    static constexpr std::size_t doFieldLength()
+    {
+        return BaseImpl::doFieldLength();
+    }
+
+    template <typename TMsg>
+    std::size_t doFieldLength(const TMsg& msg) const
+    {
+        return fieldLengthInternal(msg, LengthTag<>()) + queuedBuf_.size();
+    }
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads the number of records and forwards the read operation
+    ///     to the next layer to read the first one. The remaining records are
+    ///     left pending to be read by @ref readNext().
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading, must be convertible
+    ///     to @b const @b std::uint8_t*.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced over the whole batch, while the
+    ///     remaining records are still read from the same input buffer
+    ///     by the following @ref readNext() calls.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        static_assert(std::is_convertible<IterType, const std::uint8_t*>::value,
+            "BatchLayer requires the read iterator to be convertible to const std::uint8_t*");
+
+        discardPendingRecords();
+
+        auto begIter = iter;
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, iter, size);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto fieldLen = static_cast<std::size_t>(std::distance(begIter, iter));
+        auto remSize = size - fieldLen;
+        auto count = thisObj.getRecordsCountFromField(field);
+        if (count == 0U) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        const std::uint8_t* recIter = iter;
+        es = nextLayerReader.read(msg, recIter, remSize, extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (es == comms::ErrorStatus::ProtocolError) {
+            return es;
+        }
+
+        auto consumed = static_cast<std::size_t>(recIter - static_cast<const std::uint8_t*>(iter));
+        pendingIter_ = recIter;
+        pendingSize_ = remSize - consumed;
+        pendingCount_ = count - 1U;
+        std::advance(iter, remSize);
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Writes the number of records, the queued records and the
+    ///     provided message. The queue is not modified.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        auto& thisObj = BaseImpl::thisLayer();
+        thisObj.prepareFieldForWrite(queuedCount_ + 1U, &msg, field);
+        auto es = thisObj.doWriteField(&msg, field, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        auto remSize = size - field.length();
+        if (remSize < queuedBuf_.size()) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        iter = std::copy_n(queuedBuf_.data(), queuedBuf_.size(), iter);
+        return nextLayerWriter.write(msg, iter, remSize - queuedBuf_.size());
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details The queued records written by the @ref doWrite() are already final,
+    ///     the function skips them and forwards the update operation to the next
+    ///     layer for the last record only. Must be invoked prior to @ref discardQueued().
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        std::size_t remSize = 0U;
+        auto es = skipQueued(field, iter, size, remSize);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return nextLayerUpdater.update(iter, remSize);
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::BatchLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        std::size_t remSize = 0U;
+        auto es = skipQueued(field, iter, size, remSize);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return nextLayerUpdater.update(msg, iter, remSize);
+    }
+
+protected:
+    /// @brief Retrieve number of records from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    /// @return Number of records in the batch.
+    static std::size_t getRecordsCountFromField(const Field& field)
+    {
+        return static_cast<std::size_t>(field.getValue());
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided number of records.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] count Number of records in the batch.
+    /// @param[in] msg Pointer to message object being written.
+    /// @param[out] field Field, value of which needs to be populated
+    /// @note May be non-static in the extending class
+    template <typename TMsg>
+    static void prepareFieldForWrite(std::size_t count, const TMsg* msg, Field& field)
+    {
+        static_cast<void>(msg);
+        COMMS_ASSERT(count <= maxRecordsCount());
+        field.setValue(count);
+    }
+
+private:
+    template <typename... TParams>
+    using FixedLengthTag = typename BaseImpl::template FixedLengthTag<TParams...>;
+
+    template <typename...TParams>
+    using VarLengthTag = typename BaseImpl::template VarLengthTag<TParams...>;
+
+    template <typename... TParams>
+    using LengthTag = typename BaseImpl::template LengthTag<TParams...>;
+
+    template <typename... TParams>
+    using DynamicStorageTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FixedStorageTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasFixedSizeStorage
+        >::template Type<
+            FixedStorageTag,
+            DynamicStorageTag
+        >;
+
+    template <typename TMsg, typename... TParams>
+    constexpr std::size_t fieldLengthInternal(const TMsg& msg, FixedLengthTag<TParams...>) const
+    {
+        return BaseImpl::doFieldLength(msg);
+    }
+
+    template <typename TMsg, typename... TParams>
+    std::size_t fieldLengthInternal(const TMsg& msg, VarLengthTag<TParams...>) const
+    {
+        auto& thisObj = BaseImpl::thisLayer();
+        Field fieldTmp;
+        thisObj.prepareFieldForWrite(queuedCount_ + 1U, &msg, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus skipQueued(Field& field, TIter& iter, std::size_t size, std::size_t& remSize) const
+    {
+        auto fromIter = iter;
+        auto es = field.read(iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto consumed = static_cast<std::size_t>(std::distance(fromIter, iter));
+        if ((size - consumed) < queuedBuf_.size()) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        std::advance(iter, queuedBuf_.size());
+        remSize = size - consumed - queuedBuf_.size();
+        return comms::ErrorStatus::Success;
+    }
+
+    static bool prepareScratch(ScratchBuffer& buf, std::size_t len)
+    {
+        return prepareScratchInternal(buf, len, StorageTag<>());
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, DynamicStorageTag<TParams...>)
+    {
+        buf.resize(len);
+        return true;
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, FixedStorageTag<TParams...>)
+    {
+        if (buf.capacity() < len) {
+            return false;
+        }
+
+        buf.resize(len);
+        return true;
+    }
+
+    ScratchBuffer queuedBuf_;
+    std::size_t queuedCount_ = 0U;
+    const std::uint8_t* pendingIter_ = nullptr;
+    std::size_t pendingSize_ = 0U;
+    std::size_t pendingCount_ = 0U;
+};
+
+namespace details
+{
+template <typename T>
+struct BatchLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TNextLayer, typename... TOptions>
+struct BatchLayerCheckHelper<BatchLayer<TField, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref BatchLayer
+/// @related BatchLayer
+template <typename T>
+constexpr bool isBatchLayer()
+{
+    return details::BatchLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
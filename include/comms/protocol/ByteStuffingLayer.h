@@ -0,0 +1,548 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::ByteStuffingLayer
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/Field.h"
+#include "comms/field/IntValue.h"
+#include "comms/details/tag.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/ByteStuffingHelpers.h"
+#include "comms/protocol/details/ByteStuffingLayerOptionsParser.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/protocol/stuffing/Cobs.h"
+#include "comms/protocol/stuffing/Hdlc.h"
+#include "comms/protocol/stuffing/Slip.h"
+#include "comms/util/type_traits.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that applies byte stuffing to the data written by
+///     all the wrapped internal layers and removes it prior to forwarding the read
+///     operation to them.
+/// @details The layer is expected to be the outermost one, it defines the
+///     boundaries of the frame by the delimiter byte, which never appears inside the
+///     stuffed data. The layer's field is the frame terminating delimiter.
+///     When reading, the leading delimiters (if any) are skipped, the stuffed data
+///     up to the terminating delimiter is decoded in a single pass into the internal scratch
+///     buffer, and the read operation is forwarded to the next layer with the
+///     iterator to the decoded data. When writing, the wrapped layers write into
+///     the scratch buffer local to the @b write operation, which is then encoded
+///     directly into the output buffer. The @b write operation doesn't modify
+///     the state of the layer and is safe to be invoked concurrently.
+///     As the result, the wrapped layers (such as @ref comms::protocol::ChecksumLayer)
+///     operate on the unstuffed data without any extra copy, i.e. the checksum
+///     is calculated on the original data and gets stuffed itself, as required
+///     by the HDLC framing.@n
+///     The read scratch buffer is reused between the calls, the dynamic memory allocation
+///     happens only when its capacity needs to grow. Use
+///     @ref comms::option::app::FixedSizeStorage option to avoid dynamic memory
+///     allocation altogether, in such case the write scratch buffer resides on the stack.@n
+///     When the input iterator is a pointer to @b std::uint8_t, the special bytes are
+///     searched using @b memchr() (vectorised by the standard library implementations)
+///     and the runs of the regular bytes between them are copied in bulk.
+///     The search for the bytes to escape when writing is performed eight bytes at a time.@n
+///     The reported @b length() of the message is the upper limit of
+///     the written data (see @ref hasExactLength()), it assumes the worst case
+///     stuffing overhead reported by the codec's @b maxEncodedLength() (for example,
+///     twice the data length for SLIP and HDLC), because the exact length depends on the
+///     contents and would require the message to be serialised. The @b write
+///     operation counts the escaped bytes only when the provided buffer is shorter
+///     than the worst case length.@n
+///     The iterators used to access the scratch buffers are @b const @b std::uint8_t*
+///     for reading and @b std::uint8_t* for writing. When the layer is used
+///     for polymorphic read and/or write of the message objects, they must be convertible
+///     to the @b ReadIterator and/or @b WriteIterator of the message interface.
+/// @tparam TCodec The byte stuffing codec class. It must have the following members
+///     defined:
+///     @code
+///     // Frame delimiter
+///     static const std::uint8_t Delimiter = ...;
+///
+///     // Maximal length of the encoded data, not including the terminating delimiter
+///     static constexpr std::size_t maxEncodedLength(std::size_t len);
+///
+///     // Exact length of the encoded data, not including the terminating delimiter
+///     std::size_t encodedLength(const std::uint8_t* src, std::size_t srcLen) const;
+///
+///     // Encode the data, not including the terminating delimiter
+///     template <typename TIter>
+///     void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const;
+///
+///     // Decode srcLen bytes (not including the delimiter) into dst, which
+///     // can accommodate at least srcLen bytes, returns false on malformed data
+///     template <typename TIter>
+///     bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const;
+///     @endcode
+///     Available codecs provided by the COMMS library reside in
+///     @ref comms::protocol::stuffing namespace (`comms/protocol/stuffing` folder):
+///     @ref comms::protocol::stuffing::Slip, @ref comms::protocol::stuffing::Hdlc and
+///     @ref comms::protocol::stuffing::Cobs.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::FixedSizeStorage - Use fixed size storage
+///         for the scratch buffers instead of @b std::vector. In case the data
+///         doesn't fit, the @b write operation returns
+///         @ref comms::ErrorStatus::BufferOverflow and the @b read operation
+///         returns @ref comms::ErrorStatus::ProtocolError.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/ByteStuffingLayer.h
+template <typename TCodec, typename TNextLayer, typename... TOptions>
+class ByteStuffingLayer : public
+        details::ProtocolLayerBase<
+            comms::field::IntValue<
+                comms::Field<comms::option::def::BigEndian>,
+                std::uint8_t,
+                comms::option::def::DefaultNumValue<TCodec::Delimiter>
+            >,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                ByteStuffingLayer<TCodec, TNextLayer, TOptions...>,
+                details::ByteStuffingLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            comms::field::IntValue<
+                comms::Field<comms::option::def::BigEndian>,
+                std::uint8_t,
+                comms::option::def::DefaultNumValue<TCodec::Delimiter>
+            >,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                ByteStuffingLayer<TCodec, TNextLayer, TOptions...>,
+                details::ByteStuffingLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::ByteStuffingLayerOptionsParser<TOptions...>;
+    using ScratchBuffer = typename ParsedOptionsInternal::ScratchBuffer;
+
+public:
+    /// @brief Type of the field object used to read/write the frame delimiter.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Provided byte stuffing codec.
+    using Codec = TCodec;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Frame delimiter
+    static const std::uint8_t Delimiter = TCodec::Delimiter;
+
+    /// @brief Default constructor
+    explicit ByteStuffingLayer() = default;
+
+    /// @brief Copy constructor
+    ByteStuffingLayer(const ByteStuffingLayer&) = default;
+
+    /// @brief Move constructor
+    ByteStuffingLayer(ByteStuffingLayer&&) = default;
+
+    /// @brief Destructor.
+    ~ByteStuffingLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    ByteStuffingLayer& operator=(const ByteStuffingLayer&) = default;
+
+    /// @brief Move assignment.
+    ByteStuffingLayer& operator=(ByteStuffingLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether fixed size storage is used
+    ///     for the scratch buffers.
+    static constexpr bool hasFixedSizeStorage()
+    {
+        return ParsedOptionsInternal::HasFixedSizeStorage;
+    }
+
+    /// @brief Compile time check whether the @b length() reported for the
+    ///     message object is the exact number of bytes the @b write() operation produces.
+    /// @details The number of the escaped bytes depends on the written data,
+    ///     i.e. the reported @b length() is the upper limit only.
+    /// @return Always @b false.
+    static constexpr bool hasExactLength()
+    {
+        return false;
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame.
+    /// @details Takes into account the worst case stuffing overhead.
+    static constexpr std::size_t maxFrameLength()
+    {
+        return maxFrameLength<typename BaseImpl::AllMessages>();
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame
+    ///     for the provided messages.
+    /// @details Takes into account the worst case stuffing overhead.
+    /// @tparam TMessages Messages, bundled in @b std::tuple.
+    template <typename TMessages>
+    static constexpr std::size_t maxFrameLength()
+    {
+        return stuffedFrameLength(BaseImpl::NextLayer::template maxFrameLength<TMessages>());
+    }
+
+    /// @brief Serialise message into the output buffer, which is known to be
+    ///     big enough.
+    /// @details Same as @ref comms::protocol::ProtocolLayerBase::writeNoStatus(),
+    ///     but takes into account the worst case stuffing overhead.
+    template <typename TMsg, typename TIter>
+    void writeNoStatus(const TMsg& msg, TIter& iter) const
+    {
+        static_assert(maxFrameLength() != details::protocolLayerNoMaxFrameLength(),
+            "The maximal frame length must be known at compile time");
+
+        auto es = BaseImpl::write(msg, iter, maxFrameLength());
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    }
+
+    /// @cond SKIP_DOC
+
+    static constexpr std::size_t doFieldLength()
+    {
+        return BaseImpl::doFieldLength();
+    }
+
+    template <typename TMsg>
+    std::size_t doFieldLength(const TMsg& msg) const
+    {
+        auto dataLen = BaseImpl::nextLayer().length(msg);
+        return BaseImpl::doFieldLength() + (Codec::maxEncodedLength(dataLen) - dataLen);
+    }
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Skips the leading delimiters, decodes the stuffed data up to the
+    ///     terminating delimiter into the scratch buffer, reads the delimiter
+    ///     into the field and forwards the read operation to the next layer
+    ///     with the iterator to the decoded data.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto dataIter = iter;
+        std::size_t skipped = 0U;
+        while ((skipped < size) && (static_cast<std::uint8_t>(*dataIter) == Delimiter)) {
+            ++dataIter;
+            ++skipped;
+        }
+
+        auto remSize = size - skipped;
+        auto encodedLen = findDelimiter(dataIter, remSize);
+        if (remSize <= encodedLen) {
+            BaseImpl::setMissingSize(1U, extraValues...);
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if (!prepareScratch(readBuf_, encodedLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        std::size_t decodedLen = 0U;
+        if (!Codec().decode(dataIter, encodedLen, readBuf_.data(), decodedLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, dataIter, remSize - encodedLen);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        const std::uint8_t* readIter = readBuf_.data();
+        es = nextLayerReader.read(msg, readIter, decodedLen, extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (es != comms::ErrorStatus::ProtocolError) {
+            iter = dataIter;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Invokes the write operation of the next layer into the
+    ///     scratch buffer, then encodes the written data into the output
+    ///     buffer followed by the terminating delimiter.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "ByteStuffingLayer requires the message length to be known prior to write");
+
+        auto rawLen = BaseImpl::nextLayer().length(msg);
+        ScratchBuffer writeBuf;
+        if (!prepareScratch(writeBuf, rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        std::uint8_t* writeIter = writeBuf.data();
+        auto es = nextLayerWriter.write(msg, writeIter, rawLen);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            std::uint8_t* updateIter = writeBuf.data();
+            es = BaseImpl::nextLayer().update(msg, updateIter, static_cast<std::size_t>(writeIter - writeBuf.data()));
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        rawLen = static_cast<std::size_t>(writeIter - writeBuf.data());
+        field.setValue(Delimiter);
+        auto fieldLen = field.length();
+        if (size < fieldLen) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        // Count the escaped bytes only when the buffer may be insufficient
+        Codec codec;
+        auto availLen = size - fieldLen;
+        if ((availLen < Codec::maxEncodedLength(rawLen)) &&
+            (availLen < codec.encodedLength(writeBuf.data(), rawLen))) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        codec.encode(writeBuf.data(), rawLen, iter);
+        auto& thisObj = BaseImpl::thisLayer();
+        return thisObj.doWriteField(&msg, field, iter, fieldLen);
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details The data written by the @ref doWrite() is already final,
+    ///     the function just skips it without forwarding the update
+    ///     operation to the next layer.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(field);
+        static_cast<void>(nextLayerUpdater);
+        std::advance(iter, size);
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::ByteStuffingLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(msg);
+        return doUpdate(field, iter, size, std::forward<TNextLayerUpdater>(nextLayerUpdater));
+    }
+
+private:
+    template <typename... TParams>
+    using DynamicStorageTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FixedStorageTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasFixedSizeStorage
+        >::template Type<
+            FixedStorageTag,
+            DynamicStorageTag
+        >;
+
+    static constexpr std::size_t stuffedFrameLength(std::size_t len)
+    {
+        return
+            (len == details::protocolLayerNoMaxFrameLength()) ?
+                details::protocolLayerNoMaxFrameLength() :
+                details::protocolLayerMaxFrameLengthSum(Field::maxLength(), Codec::maxEncodedLength(len));
+    }
+
+    // Returns size if not found
+    template <typename TIter>
+    static std::size_t findDelimiter(const TIter& iter, std::size_t size)
+    {
+        return findDelimiterInternal(iter, size, details::ByteStuffingIterTag<TIter>());
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findDelimiterInternal(const TIter& iter, std::size_t size, details::ByteStuffingRawPtrTag<TParams...>)
+    {
+        return static_cast<std::size_t>(details::byteStuffingFind(iter, iter + size, Delimiter) - iter);
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findDelimiterInternal(const TIter& iter, std::size_t size, details::ByteStuffingGenericIterTag<TParams...>)
+    {
+        auto searchIter = iter;
+        for (auto idx = 0U; idx < size; ++idx) {
+            if (static_cast<std::uint8_t>(*searchIter) == Delimiter) {
+                return idx;
+            }
+
+            ++searchIter;
+        }
+
+        return size;
+    }
+
+    static bool prepareScratch(ScratchBuffer& buf, std::size_t len)
+    {
+        return prepareScratchInternal(buf, len, StorageTag<>());
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, DynamicStorageTag<TParams...>)
+    {
+        buf.resize(len);
+        return true;
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, FixedStorageTag<TParams...>)
+    {
+        if (buf.capacity() < len) {
+            return false;
+        }
+
+        buf.resize(len);
+        return true;
+    }
+
+    ScratchBuffer readBuf_;
+};
+
+template <typename TCodec, typename TNextLayer, typename... TOptions>
+const std::uint8_t ByteStuffingLayer<TCodec, TNextLayer, TOptions...>::Delimiter;
+
+namespace details
+{
+template <typename T>
+struct ByteStuffingLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TCodec, typename TNextLayer, typename... TOptions>
+struct ByteStuffingLayerCheckHelper<ByteStuffingLayer<TCodec, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref ByteStuffingLayer
+/// @related ByteStuffingLayer
+template <typename T>
+constexpr bool isByteStuffingLayer()
+{
+    return details::ByteStuffingLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
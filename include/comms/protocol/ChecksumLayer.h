@@ -18,6 +18,7 @@
 #include "comms/protocol/details/ProtocolLayerBase.h"
 #include "comms/protocol/details/ChecksumLayerOptionsParser.h"
 #include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/protocol/checksum/SinglePassIterator.h"
 #include "comms/util/type_traits.h"
 #include "comms/details/tag.h"
 #include "comms/cast.h"
@@ -55,6 +56,22 @@ namespace protocol
 ///         checksum value. Usage of @ref comms::option::def::ChecksumLayerVerifyBeforeRead
 ///         modifies the default behaviour by forcing the checksum verification
 ///         prior to invocation of @b read operation in the wrapped layer(s).
+///     @li @ref comms::option::def::ChecksumLayerSinglePass - By default, the
+///         checksum is calculated on the data after it has been read or written by
+///         the wrapped layers, i.e. the same data is iterated over twice.
+///         Usage of @ref comms::option::def::ChecksumLayerSinglePass forces
+///         the checksum to be calculated while the data is being read or written by passing
+///         @ref comms::protocol::checksum::SinglePassIterator to the wrapped layer(s).
+///         Requires the checksum calculator to support incremental calculation
+///         (all the calculators in @ref comms::protocol::checksum namespace do) and
+///         the random access iterator to be used. In case the calculated value cannot
+///         be used (for example the wrapped @ref comms::protocol::MsgSizeLayer
+///         needs to update the already written data), the layer falls back
+///         to the @ref calculateChecksum() invocation. When
+///         @ref comms::option::ExtendingClass is used, the checksum is always
+///         calculated by the (possibly overridden) @ref calculateChecksum() of the
+///         extending class after the data is read or written, i.e. the option
+///         only affects the type of the iterator passed to the wrapped layers.
 ///     @li  @ref comms::option::ExtendingClass - Use this option to provide a class
 ///         name of the extending class, which can be used to extend existing functionality.
 ///         See also @ref page_custom_checksum_layer tutorial page.
@@ -130,6 +147,16 @@ public:
         return ParsedOptionsInternal::HasVerifyBeforeRead;
     }     
 
+    /// @brief Compile time inquiry of whether @ref comms::option::def::ChecksumLayerSinglePass
+    ///     options has been used.
+    /// @details The single pass calculation is not performed when
+    ///     @ref comms::option::ExtendingClass is used (see @ref hasExtendingClass()),
+    ///     @ref calculateChecksum() is invoked instead.
+    static constexpr bool hasSinglePass()
+    {
+        return ParsedOptionsInternal::HasSinglePass;
+    }
+
     /// @brief Customized read functionality, invoked by @ref read().
     /// @details First, executes the read() member function of the next layer.
     ///     If the call returns comms::ErrorStatus::Success, it calculated the
@@ -218,7 +245,7 @@ public:
     ///       written. In case of an error, distance between original position
     ///       and advanced will pinpoint the location of the error.
     template <typename TMsg, typename TIter, typename TNextLayerWriter>
-    ErrorStatus doWrite(
+    COMMS_CONSTEXPR20 ErrorStatus doWrite(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -316,7 +343,7 @@ protected:
     /// @note May be static in the extending class, but needs to be const.
     /// @deprecated Override @ref comms::protocol::ChecksumLayer::doWriteField() "doWriteField()" instead    
     template <typename TMsg, typename TIter>
-    comms::ErrorStatus writeField(const TMsg* msgPtr, const Field& field, TIter& iter, std::size_t len) const
+    COMMS_CONSTEXPR20 comms::ErrorStatus writeField(const TMsg* msgPtr, const Field& field, TIter& iter, std::size_t len) const
     {
         return BaseImpl::thisLayer().doWriteField(msgPtr, field, iter, len);
     }
@@ -333,7 +360,7 @@ protected:
     /// @return The checksum value.
     /// @note May be non-static in the extending class, but needs to be const.
     template <typename TMsg, typename TIter>
-    static auto calculateChecksum(const TMsg* msg, TIter& iter, std::size_t len, bool& checksumValid) -> decltype(TCalc()(iter, len))
+    static COMMS_CONSTEXPR20 auto calculateChecksum(const TMsg* msg, TIter& iter, std::size_t len, bool& checksumValid) -> decltype(TCalc()(iter, len))
     {
         static_cast<void>(msg);
         checksumValid = true;
@@ -364,7 +391,7 @@ protected:
     /// @param[out] field Field, value of which needs to be populated
     /// @note May be non-static in the extending class. In case of non-static must be const.
     template <typename TChecksum, typename TMsg>
-    static void prepareFieldForWrite(TChecksum checksum, const TMsg* msg, Field& field)
+    static COMMS_CONSTEXPR20 void prepareFieldForWrite(TChecksum checksum, const TMsg* msg, Field& field)
     {
         static_cast<void>(msg);
         field.setValue(checksum);
@@ -377,6 +404,32 @@ private:
     template <typename... TParams>
     using VerifyAfterReadTag = comms::details::tag::Tag2<>;
 
+    template <typename... TParams>
+    using SinglePassTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using MultiPassTag = comms::details::tag::Tag4<>;
+
+    template <typename...>
+    using PassTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasSinglePass
+        >::template Type<
+            SinglePassTag,
+            MultiPassTag
+        >;
+
+    template <typename TIter>
+    using SinglePassIterHelper = comms::protocol::checksum::details::SinglePassIteratorHelper<TIter>;
+
+    template <typename TIter>
+    using SinglePassCtx =
+        comms::protocol::checksum::SinglePassContext<typename SinglePassIterHelper<TIter>::BaseIterator, TCalc>;
+
+    // The single pass calculation bypasses calculateChecksum(), which
+    // can be overridden by the extending class.
+    static const bool UseSinglePassValue = !ParsedOptionsInternal::HasExtendingClass;
+
     template <typename TMsg, typename TIter, typename TReader, typename... TExtraValues>
     ErrorStatus verifyRead(
         Field& field,
@@ -482,6 +535,112 @@ private:
         return es;
     }
 
+    template <typename TMsg, typename TIter, typename TReader, typename... TExtraValues>
+    ErrorStatus readVerifySinglePass(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IterHelper = SinglePassIterHelper<IterType>;
+        using CalcIter = typename IterHelper::Type;
+
+        auto fromIter = iter;
+        SinglePassCtx<IterType> ctx(IterHelper::base(iter), false);
+        CalcIter calcIter(IterHelper::base(iter), UseSinglePassValue ? &ctx : nullptr);
+
+        auto es = nextLayerReader.read(msg, calcIter, size, extraValues...);
+        auto len = static_cast<std::size_t>(std::distance(IterHelper::base(fromIter), calcIter.base()));
+        std::advance(iter, len);
+        if ((es == ErrorStatus::NotEnoughData) ||
+            (es == ErrorStatus::ProtocolError)) {
+            return es;
+        }
+
+        COMMS_ASSERT(len <= size);
+        auto remSize = size - len;
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto checksumEs = thisObj.readField(msgPtr, field, iter, remSize);
+        if (checksumEs == ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, remSize, extraValues...);
+        }
+
+        if (checksumEs != ErrorStatus::Success) {
+            BaseImpl::resetMsg(msg);
+            return checksumEs;
+        }
+
+        ctx.flush();
+        bool checksumValid = UseSinglePassValue && ctx.isValid(calcIter.base());
+        auto checksum = ctx.getValue();
+        if (!checksumValid) {
+            checksum = 
+                static_cast<decltype(checksum)>(
+                    thisObj.calculateChecksum(
+                        BaseImpl::toMsgPtr(msg),
+                        fromIter,
+                        len,
+                        checksumValid));
+        }
+
+        if (!checksumValid) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto expectedValue = thisObj.getChecksumFromField(field);
+
+        if (expectedValue != static_cast<decltype(expectedValue)>(checksum)) {
+            BaseImpl::resetMsg(msg);
+            return ErrorStatus::ProtocolError;
+        }
+
+        return es;
+    }
+
+    template <typename TMsg, typename TIter, typename TReader, typename... TExtraValues>
+    ErrorStatus readVerifyTagged(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReader&& nextLayerReader,
+        MultiPassTag<>,
+        TExtraValues... extraValues)
+    {
+        return
+            readVerify(
+                field,
+                msg,
+                iter,
+                size,
+                std::forward<TReader>(nextLayerReader),
+                extraValues...);
+    }
+
+    template <typename TMsg, typename TIter, typename TReader, typename... TExtraValues>
+    ErrorStatus readVerifyTagged(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TReader&& nextLayerReader,
+        SinglePassTag<>,
+        TExtraValues... extraValues)
+    {
+        return
+            readVerifySinglePass(
+                field,
+                msg,
+                iter,
+                size,
+                std::forward<TReader>(nextLayerReader),
+                extraValues...);
+    }
+
     template <typename TMsg, typename TIter, typename TReader, typename... TExtraValues>
     ErrorStatus readInternal(
         Field& field,
@@ -513,17 +672,18 @@ private:
         TExtraValues... extraValues)
     {
         return
-            readVerify(
+            readVerifyTagged(
                 field,
                 msg,
                 iter,
                 size,
                 std::forward<TReader>(nextLayerReader),
+                PassTag<>(),
                 extraValues...);
     }
 
     template <typename TMsg, typename TIter, typename TWriter>
-    ErrorStatus writeInternalRandomAccess(
+    COMMS_CONSTEXPR20 ErrorStatus writeInternalRandomAccess(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -568,6 +728,89 @@ private:
         return thisObj.writeField(&msg, field, iter, remSize);
     }
 
+    template <typename TMsg, typename TIter, typename TWriter>
+    ErrorStatus writeInternalRandomAccessSinglePass(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter&& nextLayerWriter) const
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IterHelper = SinglePassIterHelper<IterType>;
+        using CalcIter = typename IterHelper::Type;
+
+        auto fromIter = iter;
+        SinglePassCtx<IterType> ctx(IterHelper::base(iter), true);
+        CalcIter calcIter(IterHelper::base(iter), UseSinglePassValue ? &ctx : nullptr);
+
+        auto es = nextLayerWriter.write(msg, calcIter, size);
+        COMMS_ASSERT(IterHelper::base(fromIter) <= calcIter.base());
+        auto len = static_cast<std::size_t>(std::distance(IterHelper::base(fromIter), calcIter.base()));
+        std::advance(iter, len);
+        if ((es != comms::ErrorStatus::Success) &&
+            (es != comms::ErrorStatus::UpdateRequired)) {
+            return es;
+        }
+
+        auto remSize = size - len;
+        auto& thisObj = BaseImpl::thisLayer();
+
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            thisObj.prepareFieldForWrite(0, &msg, field);
+            auto esTmp = thisObj.writeField(&msg, field, iter, remSize);
+            if (esTmp != comms::ErrorStatus::Success) {
+                return esTmp;
+            }
+
+            return es;
+        }
+
+        ctx.flush();
+        bool checksumValid = UseSinglePassValue && ctx.isValid(calcIter.base());
+        auto checksum = ctx.getValue();
+        if (!checksumValid) {
+            checksum = 
+                static_cast<decltype(checksum)>(
+                    thisObj.calculateChecksum(
+                        &msg,
+                        fromIter,
+                        len,
+                        checksumValid));
+        }
+
+        if (!checksumValid) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        thisObj.prepareFieldForWrite(checksum, &msg, field);
+        return thisObj.writeField(&msg, field, iter, remSize);
+    }
+
+    template <typename TMsg, typename TIter, typename TWriter>
+    COMMS_CONSTEXPR20 ErrorStatus writeInternalRandomAccessTagged(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter&& nextLayerWriter,
+        MultiPassTag<>) const
+    {
+        return writeInternalRandomAccess(field, msg, iter, size, std::forward<TWriter>(nextLayerWriter));
+    }
+
+    template <typename TMsg, typename TIter, typename TWriter>
+    ErrorStatus writeInternalRandomAccessTagged(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TWriter&& nextLayerWriter,
+        SinglePassTag<>) const
+    {
+        return writeInternalRandomAccessSinglePass(field, msg, iter, size, std::forward<TWriter>(nextLayerWriter));
+    }
+
     template <typename TMsg, typename TIter, typename TWriter>
     ErrorStatus writeInternalOutput(
         Field& field,
@@ -591,7 +834,7 @@ private:
     }
 
     template <typename TMsg, typename TIter, typename TWriter>
-    ErrorStatus writeInternal(
+    COMMS_CONSTEXPR20 ErrorStatus writeInternal(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -599,7 +842,7 @@ private:
         TWriter&& nextLayerWriter,
         std::random_access_iterator_tag) const
     {
-        return writeInternalRandomAccess(field, msg, iter, size, std::forward<TWriter>(nextLayerWriter));
+        return writeInternalRandomAccessTagged(field, msg, iter, size, std::forward<TWriter>(nextLayerWriter), PassTag<>());
     }
 
     template <typename TMsg, typename TIter, typename TWriter>
@@ -0,0 +1,561 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::CompressionLayer
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/CompressionLayerOptionsParser.h"
+#include "comms/protocol/details/ProtocolLayerDetails.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/protocol/compression/Lz.h"
+#include "comms/util/type_traits.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that compresses the data written by all the wrapped
+///     internal layers and decompresses it prior to forwarding the read
+///     operation to them.
+/// @details The layer's field contains the length of the decompressed data,
+///     value @b 0 indicates that the data following the field is not
+///     compressed. The data is not compressed when it is shorter than the
+///     configured threshold (see @ref comms::option::app::CompressionLayerMinSize),
+///     longer than @ref maxCompressSize(), or when compression doesn't reduce its length.@n
+///     The reported @b length() of the message is the upper limit of
+///     the written data (see @ref hasExactLength()).@n
+///     The compressed data is expected to occupy all the remaining bytes
+///     of the frame, i.e. the layer needs to be wrapped by other layer which
+///     defines the boundaries of the frame, such as @ref comms::protocol::MsgSizeLayer.@n
+///     The wrapped layers write the data into the internal scratch buffer, which is
+///     then compressed into another internal scratch buffer. When reading, the data is
+///     decompressed into the third internal scratch buffer. All of them are reused
+///     between the calls, the dynamic memory allocation happens only when their capacity
+///     needs to grow. Use @ref comms::option::app::FixedSizeStorage option
+///     to avoid dynamic memory allocation altogether. Note that as the result
+///     the @b write operation, although being @b const, is not re-entrant and
+///     must not be invoked concurrently on the same layer object.@n
+///     The iterators used to access the scratch buffers are @b const @b std::uint8_t*
+///     for reading and @b std::uint8_t* for writing. When the layer is used
+///     for polymorphic read and/or write of the message objects, they must be convertible
+///     to the @b ReadIterator and/or @b WriteIterator of the message interface.
+///     The same requirement applies to the iterator type passed to
+///     @ref comms::protocol::msgPayload() when used.
+/// @tparam TField Type of the field that is used to store length of the decompressed data.
+/// @tparam TCodec The compression codec class. It must have the following member
+///     functions defined:
+///     @code
+///     // Returns number of written bytes, 0 in case compressed data doesn't fit into the buffer
+///     std::size_t compress(const std::uint8_t* src, std::size_t srcLen, std::uint8_t* dst, std::size_t dstLen) const;
+///
+///     // Returns true if srcLen bytes have been decompressed into exactly dstLen bytes
+///     template <typename TIter>
+///     bool decompress(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t dstLen) const;
+///     @endcode
+///     Available codecs provided by the COMMS library reside in
+///     @ref comms::protocol::compression namespace (`comms/protocol/compression` folder).
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::CompressionLayerMinSize - Minimal length of
+///         the data to attempt compression of.
+///     @li @ref comms::option::app::CompressionLayerMaxSize - Maximal length of
+///         the decompressed data accepted by the @b read operation
+///         (see @ref maxDecompressedSize()), longer data is written uncompressed.
+///     @li @ref comms::option::app::FixedSizeStorage - Use fixed size storage
+///         for the scratch buffers instead of @b std::vector. In case the data
+///         doesn't fit, the @b write operation returns
+///         @ref comms::ErrorStatus::BufferOverflow and the @b read operation
+///         returns @ref comms::ErrorStatus::ProtocolError.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/CompressionLayer.h
+template <typename TField, typename TCodec, typename TNextLayer, typename... TOptions>
+class CompressionLayer : public
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                CompressionLayer<TField, TCodec, TNextLayer, TOptions...>,
+                details::CompressionLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                CompressionLayer<TField, TCodec, TNextLayer, TOptions...>,
+                details::CompressionLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::CompressionLayerOptionsParser<TOptions...>;
+    using ScratchBuffer = typename ParsedOptionsInternal::ScratchBuffer;
+
+public:
+    /// @brief Type of the field object used to read/write length of the decompressed data.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Provided compression codec.
+    using Codec = TCodec;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Minimal length of the data the compression is attempted for.
+    static const std::size_t MinCompressSize = ParsedOptionsInternal::MinSize;
+
+    /// @brief Maximal length of the decompressed data accepted by the @b read
+    ///     operation when it cannot be determined otherwise.
+    /// @see @ref maxDecompressedSize()
+    static const std::size_t DefaultMaxDecompressedSize = 0x10000;
+
+    /// @brief Default constructor
+    explicit CompressionLayer() = default;
+
+    /// @brief Copy constructor
+    CompressionLayer(const CompressionLayer&) = default;
+
+    /// @brief Move constructor
+    CompressionLayer(CompressionLayer&&) = default;
+
+    /// @brief Destructor.
+    ~CompressionLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    CompressionLayer& operator=(const CompressionLayer&) = default;
+
+    /// @brief Move assignment.
+    CompressionLayer& operator=(CompressionLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether fixed size storage is used
+    ///     for the scratch buffers.
+    static constexpr bool hasFixedSizeStorage()
+    {
+        return ParsedOptionsInternal::HasFixedSizeStorage;
+    }
+
+    /// @brief Maximal length of the decompressed data accepted by the @b read operation.
+    /// @details The value provided via @ref comms::option::app::CompressionLayerMaxSize
+    ///     option if such is used. Otherwise the maximal frame length of the
+    ///     wrapped layers (see @ref comms::protocol::ProtocolLayerBase::maxFrameLength() "maxFrameLength()")
+    ///     if it can be determined at compile time, or @ref DefaultMaxDecompressedSize
+    ///     if it cannot. The read of the frame reporting longer decompressed data fails
+    ///     with @ref comms::ErrorStatus::ProtocolError without allocating any memory.
+    static constexpr std::size_t maxDecompressedSize()
+    {
+        return
+            ParsedOptionsInternal::HasMaxSize ?
+                ParsedOptionsInternal::MaxSize :
+            (NextLayerMaxFrameLength != details::protocolLayerNoMaxFrameLength()) ?
+                NextLayerMaxFrameLength :
+                DefaultMaxDecompressedSize;
+    }
+
+    /// @brief Maximal length of the data the compression is attempted for.
+    /// @details The data is written uncompressed when its length exceeds the
+    ///     @ref maxDecompressedSize() (to allow the other side to read it), or the maximal
+    ///     value the field can hold. May be hidden by the extending class if the length
+    ///     of the decompressed data is stored in some other way.
+    static constexpr std::size_t maxCompressSize()
+    {
+        return
+            (details::ProtocolLayerFieldMaxValueHelper<Field>::Value < maxDecompressedSize()) ?
+                details::ProtocolLayerFieldMaxValueHelper<Field>::Value :
+                maxDecompressedSize();
+    }
+
+    /// @brief Compile time check whether the @b length() reported for the
+    ///     message object is the exact number of bytes the @b write() operation produces.
+    /// @details The written data may get compressed, i.e. the reported
+    ///     @b length() is the upper limit only.
+    /// @return Always @b false.
+    static constexpr bool hasExactLength()
+    {
+        return false;
+    }
+
+    /// @cond SKIP_DOC
+
+    static constexpr std::size_t doFieldLength()
+    {
+        return BaseImpl::doFieldLength();
+    }
+
+    template <typename TMsg>
+    constexpr std::size_t doFieldLength(const TMsg& msg) const
+    {
+        return fieldLengthInternal(msg, LengthTag<>());
+    }
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads the length of the decompressed data. If the data is
+    ///     compressed, decompresses all the remaining bytes into the scratch buffer
+    ///     and forwards the read operation to the next layer with the iterator
+    ///     to the decompressed data. Otherwise, forwards the read operation
+    ///     to the next layer as-is.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto begIter = iter;
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, iter, size);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto fieldLen = static_cast<std::size_t>(std::distance(begIter, iter));
+        auto remSize = size - fieldLen;
+        auto origSize = thisObj.getDecompressedSizeFromField(field);
+        if (origSize == 0U) {
+            return nextLayerReader.read(msg, iter, remSize, extraValues...);
+        }
+
+        if ((maxDecompressedSize() < origSize) ||
+            (!prepareScratch(readBuf_, origSize))) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto dataIter = iter;
+        if (!Codec().decompress(dataIter, remSize, readBuf_.data(), origSize)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        const std::uint8_t* readIter = readBuf_.data();
+        es = nextLayerReader.read(msg, readIter, origSize, extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (es != comms::ErrorStatus::ProtocolError) {
+            iter = dataIter;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Invokes the write operation of the next layer into the
+    ///     scratch buffer, compresses the written data (if applicable),
+    ///     then writes the field followed by the compressed (or original) data.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "CompressionLayer requires the message length to be known prior to write");
+
+        auto rawLen = BaseImpl::nextLayer().length(msg);
+        if (!prepareScratch(writeBuf_, rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        std::uint8_t* writeIter = writeBuf_.data();
+        auto es = nextLayerWriter.write(msg, writeIter, rawLen);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            std::uint8_t* updateIter = writeBuf_.data();
+            es = BaseImpl::nextLayer().update(msg, updateIter, static_cast<std::size_t>(writeIter - writeBuf_.data()));
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto& thisObj = BaseImpl::thisLayer();
+        rawLen = static_cast<std::size_t>(writeIter - writeBuf_.data());
+        const std::uint8_t* data = writeBuf_.data();
+        std::size_t dataLen = rawLen;
+        std::size_t origLen = 0U;
+        if ((MinCompressSize <= rawLen) && 
+            (0U < rawLen) && 
+            (rawLen <= thisObj.maxCompressSize()) &&
+            prepareScratch(compressBuf_, rawLen - 1U)) {
+            auto compressedLen = Codec().compress(writeBuf_.data(), rawLen, compressBuf_.data(), rawLen - 1U);
+            if (compressedLen != 0U) {
+                COMMS_ASSERT(compressedLen < rawLen);
+                data = compressBuf_.data();
+                dataLen = compressedLen;
+                origLen = rawLen;
+            }
+        }
+
+        thisObj.prepareFieldForWrite(origLen, &msg, field);
+        auto fieldLen = field.length();
+        if ((size < fieldLen) || ((size - fieldLen) < dataLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        es = thisObj.doWriteField(&msg, field, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        iter = std::copy_n(data, dataLen, iter);
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details The data written by the @ref doWrite() is already final,
+    ///     the function just skips it without forwarding the update
+    ///     operation to the next layer.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(nextLayerUpdater);
+        return skipUpdate(field, iter, size);
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::CompressionLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(msg);
+        static_cast<void>(nextLayerUpdater);
+        return skipUpdate(field, iter, size);
+    }
+
+protected:
+    /// @brief Retrieve length of the decompressed data from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    /// @return Length of the decompressed data, @b 0 if data is not compressed.
+    static std::size_t getDecompressedSizeFromField(const Field& field)
+    {
+        return static_cast<std::size_t>(field.getValue());
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided length of the decompressed data.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] size Length of the decompressed data, @b 0 if data is not compressed.
+    /// @param[in] msg Pointer to message object being written.
+    /// @param[out] field Field, value of which needs to be populated
+    /// @note May be non-static in the extending class
+    template <typename TMsg>
+    static void prepareFieldForWrite(std::size_t size, const TMsg* msg, Field& field)
+    {
+        static_cast<void>(msg);
+        field.setValue(size);
+    }
+
+private:
+    static const std::size_t NextLayerMaxFrameLength =
+        BaseImpl::NextLayer::template maxFrameLength<typename BaseImpl::AllMessages>();
+
+    template <typename... TParams>
+    using FixedLengthTag = typename BaseImpl::template FixedLengthTag<TParams...>;
+
+    template <typename...TParams>
+    using VarLengthTag = typename BaseImpl::template VarLengthTag<TParams...>;
+
+    template <typename... TParams>
+    using LengthTag = typename BaseImpl::template LengthTag<TParams...>;
+
+    template <typename... TParams>
+    using DynamicStorageTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FixedStorageTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasFixedSizeStorage
+        >::template Type<
+            FixedStorageTag,
+            DynamicStorageTag
+        >;
+
+    template <typename TMsg, typename... TParams>
+    constexpr std::size_t fieldLengthInternal(const TMsg& msg, FixedLengthTag<TParams...>) const
+    {
+        return BaseImpl::doFieldLength(msg);
+    }
+
+    template <typename TMsg, typename... TParams>
+    std::size_t fieldLengthInternal(const TMsg& msg, VarLengthTag<TParams...>) const
+    {
+        auto& thisObj = BaseImpl::thisLayer();
+        Field fieldTmp;
+        thisObj.prepareFieldForWrite(BaseImpl::nextLayer().length(msg), &msg, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus skipUpdate(Field& field, TIter& iter, std::size_t size)
+    {
+        auto fromIter = iter;
+        auto es = field.read(iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto consumed = static_cast<std::size_t>(std::distance(fromIter, iter));
+        std::advance(iter, size - consumed);
+        return comms::ErrorStatus::Success;
+    }
+
+    static bool prepareScratch(ScratchBuffer& buf, std::size_t len)
+    {
+        return prepareScratchInternal(buf, len, StorageTag<>());
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, DynamicStorageTag<TParams...>)
+    {
+        buf.resize(len);
+        return true;
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, FixedStorageTag<TParams...>)
+    {
+        if (buf.capacity() < len) {
+            return false;
+        }
+
+        buf.resize(len);
+        return true;
+    }
+
+    ScratchBuffer readBuf_;
+    mutable ScratchBuffer writeBuf_;
+    mutable ScratchBuffer compressBuf_;
+};
+
+namespace details
+{
+template <typename T>
+struct CompressionLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TCodec, typename TNextLayer, typename... TOptions>
+struct CompressionLayerCheckHelper<CompressionLayer<TField, TCodec, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref CompressionLayer
+/// @related CompressionLayer
+template <typename T>
+constexpr bool isCompressionLayer()
+{
+    return details::CompressionLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
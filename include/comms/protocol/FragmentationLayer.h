@@ -0,0 +1,849 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::FragmentationLayer
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/details/tag.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/FragmentationLayerOptionsParser.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/util/type_traits.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that splits the data written by all the wrapped
+///     internal layers into multiple frames and reassembles them on read.
+/// @details Every frame contains the fragment information field followed by
+///     the fragment data. The field is expected to be a
+///     @ref comms::field::Bundle or @ref comms::field::Bitfield with either
+///     two (fragment index and count) or three (transfer ID, fragment index
+///     and count) integral members.
+///     The transfer ID allows reassembly of several messages that are
+///     transmitted concurrently (see @ref comms::option::app::FragmentationLayerMaxInFlight).
+///     The fragment data is expected to occupy all the remaining bytes
+///     of the frame, i.e. the layer needs to be wrapped by other layer which
+///     defines the boundaries of the frame, such as @ref comms::protocol::MsgSizeLayer.@n
+///     @b Write: When the data written by the wrapped layers fits into the provided
+///     buffer (and doesn't exceed the limit set by @ref setMaxFragmentLength()),
+///     it is written directly as a single fragment. Otherwise the operation fails with
+///     @ref comms::ErrorStatus::BufferOverflow. Such message needs to be split
+///     explicitly by the non-const @ref prepareFragments() member function, which
+///     writes the message into the internal scratch buffer. Then every @b write() of
+///     the protocol stack with the same message object produces the current fragment,
+///     while @ref nextFragment() advances to the next one. The @b write() of any other
+///     message object is not affected by the pending fragments.
+///     @code
+///     auto& fragLayer = stack.layer_fragmentation();
+///     fragLayer.setMaxFragmentLength(MaxFragLen);
+///     auto es = fragLayer.prepareFragments(msg);
+///     ... // Check the status
+///     do {
+///         auto writeIter = outBuf.data();
+///         es = stack.write(msg, writeIter, Mtu);
+///         ... // Send the frame
+///     } while (fragLayer.nextFragment());
+///     @endcode
+///     @b Read: A frame containing the whole message is forwarded to the next layer
+///     as-is. Other fragments are accumulated in one of the reassembly buffers,
+///     and @ref comms::ErrorStatus::FragmentReceived is reported for every
+///     non-final one. When the last fragment is received the read operation
+///     is forwarded to the next layer with the iterator to the reassembly buffer,
+///     no additional copy of the data is made. Fragments received out of order
+///     discard the reassembly and @ref comms::ErrorStatus::InvalidMsgData is reported.
+///     The same happens when the reassembled data exceeds @ref maxReassemblySize().@n
+///     The buffers are reused between the calls, the dynamic memory allocation
+///     happens only when the capacity of the buffer needs to grow. Use
+///     @ref comms::option::app::FixedSizeStorage option to avoid dynamic
+///     memory allocation altogether.@n
+///     The iterators used to access the buffers are @b const @b std::uint8_t*
+///     for reading and @b std::uint8_t* for writing. When the layer is used
+///     for polymorphic read and/or write of the message objects, they must be convertible
+///     to the @b ReadIterator and/or @b WriteIterator of the message interface.@n
+///     When the layer is wrapped by the @ref comms::protocol::ChecksumLayer, it is
+///     recommended to use @ref comms::option::def::ChecksumLayerVerifyBeforeRead option
+///     to avoid accumulation of the corrupted fragments.
+/// @tparam TField Type of the field that is used to store fragment information.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::FragmentationLayerMaxInFlight - Number of
+///         concurrent in-flight reassemblies.
+///     @li @ref comms::option::app::FragmentationLayerMaxSize - Maximal length
+///         of the reassembled data (see @ref maxReassemblySize()).
+///     @li @ref comms::option::app::FixedSizeStorage - Use fixed size storage
+///         for the reassembly and scratch buffers instead of @b std::vector. In case
+///         the data doesn't fit, the @b write operation returns
+///         @ref comms::ErrorStatus::BufferOverflow and the @b read operation
+///         returns @ref comms::ErrorStatus::InvalidMsgData.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/FragmentationLayer.h
+template <typename TField, typename TNextLayer, typename... TOptions>
+class FragmentationLayer : public
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                FragmentationLayer<TField, TNextLayer, TOptions...>,
+                details::FragmentationLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            TField,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                FragmentationLayer<TField, TNextLayer, TOptions...>,
+                details::FragmentationLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::FragmentationLayerOptionsParser<TOptions...>;
+    using ScratchBuffer = typename ParsedOptionsInternal::ScratchBuffer;
+
+public:
+    /// @brief Type of the field object used to read/write fragment information.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Number of the concurrent in-flight reassemblies.
+    static const std::size_t MaxInFlight = ParsedOptionsInternal::MaxInFlight;
+
+    /// @brief Maximal length of the reassembled data when it cannot be
+    ///     determined otherwise.
+    /// @see @ref maxReassemblySize()
+    static const std::size_t DefaultMaxReassemblySize = 0x10000;
+
+    /// @brief Fragment information stored in the field.
+    struct FragmentInfo
+    {
+        std::size_t transferId = 0U; ///< ID of the transfer the fragment belongs to
+        std::size_t index = 0U; ///< Index of the fragment
+        std::size_t count = 1U; ///< Total number of fragments in the transfer
+    };
+
+    /// @brief Default constructor
+    explicit FragmentationLayer() = default;
+
+    /// @brief Copy constructor
+    FragmentationLayer(const FragmentationLayer&) = default;
+
+    /// @brief Move constructor
+    FragmentationLayer(FragmentationLayer&&) = default;
+
+    /// @brief Destructor.
+    ~FragmentationLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    FragmentationLayer& operator=(const FragmentationLayer&) = default;
+
+    /// @brief Move assignment.
+    FragmentationLayer& operator=(FragmentationLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether fixed size storage is used
+    ///     for the reassembly and scratch buffers.
+    static constexpr bool hasFixedSizeStorage()
+    {
+        return ParsedOptionsInternal::HasFixedSizeStorage;
+    }
+
+    /// @brief Maximal length of the data accumulated by a single reassembly.
+    /// @details The value provided via @ref comms::option::app::FragmentationLayerMaxSize
+    ///     option if such is used. Otherwise the maximal frame length of the
+    ///     wrapped layers (see @ref comms::protocol::ProtocolLayerBase::maxFrameLength() "maxFrameLength()")
+    ///     if it can be determined at compile time, or @ref DefaultMaxReassemblySize
+    ///     if it cannot.
+    static constexpr std::size_t maxReassemblySize()
+    {
+        return
+            ParsedOptionsInternal::HasMaxSize ?
+                ParsedOptionsInternal::MaxSize :
+            (NextLayerMaxFrameLength != details::protocolLayerNoMaxFrameLength()) ?
+                NextLayerMaxFrameLength :
+                DefaultMaxReassemblySize;
+    }
+
+    /// @brief Compile time check whether the @b length() reported for the
+    ///     message object is the exact number of bytes the @b write() operation produces.
+    /// @details The written data may get split into multiple frames,
+    ///     i.e. the reported @b length() is the upper limit only.
+    /// @return Always @b false.
+    static constexpr bool hasExactLength()
+    {
+        return false;
+    }
+
+    /// @brief Limit length of the fragment data produced by the @b write() operation.
+    /// @details Also used by @ref prepareFragments() to split the message.
+    /// @param[in] len Max number of data bytes in a single fragment, @b 0 means
+    ///     limited only by the size of the output buffer (default).
+    void setMaxFragmentLength(std::size_t len)
+    {
+        maxFragmentLen_ = len;
+    }
+
+    /// @brief Get max length of the fragment data set by @ref setMaxFragmentLength().
+    std::size_t getMaxFragmentLength() const
+    {
+        return maxFragmentLen_;
+    }
+
+    /// @brief Write the message into the internal scratch buffer and split it
+    ///     into fragments.
+    /// @details Discards the previously pending fragments. When the message fits
+    ///     into a single fragment of the length set by @ref setMaxFragmentLength()
+    ///     (or the length is not set), nothing becomes pending and the message is
+    ///     written directly by the @b write() operation. Otherwise the following
+    ///     @b write() operations of the protocol stack with the same message object
+    ///     write the current fragment, until @ref nextFragment() reports there are
+    ///     no more.
+    /// @param[in] msg Message object, must remain valid and unchanged until all
+    ///     its fragments are written.
+    /// @return Status of the operation, @ref comms::ErrorStatus::BufferOverflow
+    ///     in case the message doesn't fit into the scratch buffer or the number of
+    ///     the fragments cannot be recorded in the field.
+    template <typename TMsg>
+    comms::ErrorStatus prepareFragments(const TMsg& msg)
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "FragmentationLayer requires the message length to be known prior to write");
+
+        discardPendingFragments();
+        auto rawLen = BaseImpl::nextLayer().length(msg);
+        if ((maxFragmentLen_ == 0U) ||
+            (BaseImpl::NextLayer::hasExactLength() && (rawLen <= maxFragmentLen_))) {
+            return comms::ErrorStatus::Success;
+        }
+
+        if (!prepareScratch(writeBuf_, rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        std::uint8_t* writeIter = writeBuf_.data();
+        auto es = BaseImpl::nextLayer().write(msg, writeIter, rawLen);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            std::uint8_t* updateIter = writeBuf_.data();
+            es = BaseImpl::nextLayer().update(msg, updateIter, static_cast<std::size_t>(writeIter - writeBuf_.data()));
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        writeBuf_.resize(static_cast<std::size_t>(writeIter - writeBuf_.data()));
+
+        FragmentInfo info;
+        info.transferId = nextTransferId_;
+        info.count = std::max(std::size_t(1U), (writeBuf_.size() + maxFragmentLen_ - 1U) / maxFragmentLen_);
+
+        Field field;
+        BaseImpl::thisLayer().prepareFieldForWrite(info, &msg, field);
+        if (!fitsField(field, info.count)) {
+            // Too many fragments to be recorded in the field
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        ++nextTransferId_;
+        writeMsg_ = &msg;
+        writeTransferId_ = info.transferId;
+        writeFragLen_ = maxFragmentLen_;
+        writeCount_ = info.count;
+        writeIdx_ = 0U;
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Advance to the next pending fragment.
+    /// @details Expected to be called after the current fragment has been written.
+    /// @return @b true in case there are more fragments to write, @b false otherwise.
+    bool nextFragment()
+    {
+        if (writeCount_ == 0U) {
+            return false;
+        }
+
+        ++writeIdx_;
+        if (writeIdx_ < writeCount_) {
+            return true;
+        }
+
+        discardPendingFragments();
+        return false;
+    }
+
+    /// @brief Check whether there are fragments of the message passed to
+    ///     @ref prepareFragments() that still need to be written.
+    bool hasPendingFragments() const
+    {
+        return writeCount_ != 0U;
+    }
+
+    /// @brief Discard the pending fragments.
+    void discardPendingFragments()
+    {
+        writeCount_ = 0U;
+        writeIdx_ = 0U;
+        writeMsg_ = nullptr;
+    }
+
+    /// @brief Discard all the incomplete reassemblies.
+    void discardReassemblies()
+    {
+        for (auto& slot : slots_) {
+            slot.inUse_ = false;
+        }
+    }
+
+    /// @cond SKIP_DOC
+
+    static constexpr std::size_t doFieldLength()
+    {
+        return BaseImpl::doFieldLength();
+    }
+
+    template <typename TMsg>
+    constexpr std::size_t doFieldLength(const TMsg& msg) const
+    {
+        return fieldLengthInternal(msg, LengthTag<>());
+    }
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Reads the fragment information. A single fragment message
+    ///     is forwarded to the next layer as-is. Otherwise the remaining bytes
+    ///     are appended to the relevant reassembly buffer and the read operation
+    ///     is forwarded to the next layer only upon reception of the last fragment.
+    ///     The reassembly exceeding @ref maxReassemblySize() is discarded.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation, @ref comms::ErrorStatus::FragmentReceived
+    ///     in case non-final fragment has been consumed.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       read.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto begIter = iter;
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, iter, size);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::updateMissingSize(field, size, extraValues...);
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        auto fieldLen = static_cast<std::size_t>(std::distance(begIter, iter));
+        auto remSize = size - fieldLen;
+        auto info = thisObj.getFragmentInfoFromField(field);
+        if ((info.count == 0U) || (info.count <= info.index)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (info.count == 1U) {
+            return nextLayerReader.read(msg, iter, remSize, extraValues...);
+        }
+
+        auto* slot = acquireSlot(info);
+        if (slot == nullptr) {
+            std::advance(iter, remSize);
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
+        auto prevSize = slot->buf_.size();
+        COMMS_ASSERT(prevSize <= maxReassemblySize());
+        if (((maxReassemblySize() - prevSize) < remSize) ||
+            (!prepareScratch(slot->buf_, prevSize + remSize))) {
+            slot->inUse_ = false;
+            std::advance(iter, remSize);
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
+        auto* dataPtr = slot->buf_.data() + prevSize;
+        for (std::size_t idx = 0U; idx < remSize; ++idx) {
+            dataPtr[idx] = static_cast<std::uint8_t>(*iter);
+            ++iter;
+        }
+
+        ++slot->nextIdx_;
+        if (slot->nextIdx_ < slot->count_) {
+            return comms::ErrorStatus::FragmentReceived;
+        }
+
+        slot->inUse_ = false;
+        const std::uint8_t* readIter = slot->buf_.data();
+        es = nextLayerReader.read(msg, readIter, slot->buf_.size(), extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Writes the current fragment when invoked for the message object
+    ///     passed to the @ref prepareFragments() and there are pending fragments.
+    ///     Otherwise writes the whole message as a single fragment.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation, @ref comms::ErrorStatus::BufferOverflow
+    ///     in case the message doesn't fit into a single fragment.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        if ((writeCount_ != 0U) && (writeMsg_ == static_cast<const void*>(&msg))) {
+            return writeFragment(field, msg, iter, size);
+        }
+
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "FragmentationLayer requires the message length to be known prior to write");
+
+        auto rawLen = BaseImpl::nextLayer().length(msg);
+        if (((maxFragmentLen_ != 0U) && (maxFragmentLen_ < rawLen)) ||
+            (size < Field::maxLength()) ||
+            ((size - Field::maxLength()) < rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        auto& thisObj = BaseImpl::thisLayer();
+        thisObj.prepareFieldForWrite(FragmentInfo(), &msg, field);
+        auto es = thisObj.doWriteField(&msg, field, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        return nextLayerWriter.write(msg, iter, size - field.length());
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Forwards the update operation to the next layer when the
+    ///     written frame contains the whole message, skips the data otherwise.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        std::size_t remSize = 0U;
+        auto es = readForUpdate(field, iter, size, remSize);
+        if (es != comms::ErrorStatus::NumOfErrorStatuses) {
+            return es;
+        }
+
+        return nextLayerUpdater.update(iter, remSize);
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::FragmentationLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        std::size_t remSize = 0U;
+        auto es = readForUpdate(field, iter, size, remSize);
+        if (es != comms::ErrorStatus::NumOfErrorStatuses) {
+            return es;
+        }
+
+        return nextLayerUpdater.update(msg, iter, remSize);
+    }
+
+protected:
+    /// @brief Retrieve fragment information from the field.
+    /// @details May be overridden by the extending class
+    /// @param[in] field Field for this layer.
+    /// @return Fragment information.
+    static FragmentInfo getFragmentInfoFromField(const Field& field)
+    {
+        return getInfoInternal(field, MembersTag<>());
+    }
+
+    /// @brief Prepare field for writing
+    /// @details Must assign provided fragment information.
+    ///     May be overridden by the extending class if some complex functionality is required.
+    /// @param[in] info Fragment information.
+    /// @param[in] msg Pointer to message object being written.
+    /// @param[out] field Field, value of which needs to be populated
+    /// @note May be non-static in the extending class
+    template <typename TMsg>
+    static void prepareFieldForWrite(const FragmentInfo& info, const TMsg* msg, Field& field)
+    {
+        static_cast<void>(msg);
+        setInfoInternal(info, field, MembersTag<>());
+    }
+
+private:
+    static const std::size_t NextLayerMaxFrameLength =
+        BaseImpl::NextLayer::template maxFrameLength<typename BaseImpl::AllMessages>();
+
+    template <typename... TParams>
+    using FixedLengthTag = typename BaseImpl::template FixedLengthTag<TParams...>;
+
+    template <typename...TParams>
+    using VarLengthTag = typename BaseImpl::template VarLengthTag<TParams...>;
+
+    template <typename... TParams>
+    using LengthTag = typename BaseImpl::template LengthTag<TParams...>;
+
+    template <typename... TParams>
+    using DynamicStorageTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using FixedStorageTag = comms::details::tag::Tag4<>;
+
+    template <typename... TParams>
+    using NoTransferIdTag = comms::details::tag::Tag5<>;
+
+    template <typename... TParams>
+    using WithTransferIdTag = comms::details::tag::Tag6<>;
+
+    template <typename... TParams>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasFixedSizeStorage
+        >::template Type<
+            FixedStorageTag,
+            DynamicStorageTag
+        >;
+
+    template <typename... TParams>
+    using MembersTag =
+        typename comms::util::LazyShallowConditional<
+            std::tuple_size<typename Field::ValueType>::value == 2U
+        >::template Type<
+            NoTransferIdTag,
+            WithTransferIdTag
+        >;
+
+    struct ReassemblySlot
+    {
+        ScratchBuffer buf_;
+        std::size_t transferId_ = 0U;
+        std::size_t nextIdx_ = 0U;
+        std::size_t count_ = 0U;
+        std::size_t lastUse_ = 0U;
+        bool inUse_ = false;
+    };
+
+    template <typename TMsg, typename... TParams>
+    constexpr std::size_t fieldLengthInternal(const TMsg& msg, FixedLengthTag<TParams...>) const
+    {
+        return BaseImpl::doFieldLength(msg);
+    }
+
+    template <typename TMsg, typename... TParams>
+    std::size_t fieldLengthInternal(const TMsg& msg, VarLengthTag<TParams...>) const
+    {
+        auto& thisObj = BaseImpl::thisLayer();
+        Field fieldTmp;
+        thisObj.prepareFieldForWrite(FragmentInfo(), &msg, fieldTmp);
+        return fieldTmp.length();
+    }
+
+    template <typename... TParams>
+    static FragmentInfo getInfoInternal(const Field& field, NoTransferIdTag<TParams...>)
+    {
+        FragmentInfo info;
+        info.index = static_cast<std::size_t>(std::get<0>(field.value()).getValue());
+        info.count = static_cast<std::size_t>(std::get<1>(field.value()).getValue());
+        return info;
+    }
+
+    template <typename... TParams>
+    static FragmentInfo getInfoInternal(const Field& field, WithTransferIdTag<TParams...>)
+    {
+        FragmentInfo info;
+        info.transferId = static_cast<std::size_t>(std::get<0>(field.value()).getValue());
+        info.index = static_cast<std::size_t>(std::get<1>(field.value()).getValue());
+        info.count = static_cast<std::size_t>(std::get<2>(field.value()).getValue());
+        return info;
+    }
+
+    template <typename... TParams>
+    static void setInfoInternal(const FragmentInfo& info, Field& field, NoTransferIdTag<TParams...>)
+    {
+        std::get<0>(field.value()).setValue(info.index);
+        std::get<1>(field.value()).setValue(info.count);
+    }
+
+    template <typename... TParams>
+    static void setInfoInternal(const FragmentInfo& info, Field& field, WithTransferIdTag<TParams...>)
+    {
+        std::get<0>(field.value()).setValue(info.transferId);
+        std::get<1>(field.value()).setValue(info.index);
+        std::get<2>(field.value()).setValue(info.count);
+    }
+
+    template <typename TMsg, typename TIter>
+    comms::ErrorStatus writeFragment(Field& field, const TMsg& msg, TIter& iter, std::size_t size) const
+    {
+        COMMS_ASSERT(writeIdx_ < writeCount_);
+        auto offset = writeIdx_ * writeFragLen_;
+        COMMS_ASSERT(offset <= writeBuf_.size());
+        auto len = std::min(writeBuf_.size() - offset, writeFragLen_);
+
+        FragmentInfo info;
+        info.transferId = writeTransferId_;
+        info.index = writeIdx_;
+        info.count = writeCount_;
+
+        auto& thisObj = BaseImpl::thisLayer();
+        thisObj.prepareFieldForWrite(info, &msg, field);
+        auto es = thisObj.doWriteField(&msg, field, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        COMMS_ASSERT(field.length() <= size);
+        if ((size - field.length()) < len) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        iter = std::copy_n(writeBuf_.data() + offset, len, iter);
+        return comms::ErrorStatus::Success;
+    }
+
+    bool fitsField(const Field& field, std::size_t count) const
+    {
+        std::array<std::uint8_t, Field::maxLength()> buf;
+        std::uint8_t* writeIter = buf.data();
+        if (field.write(writeIter, buf.size()) != comms::ErrorStatus::Success) {
+            return false;
+        }
+
+        Field fieldTmp;
+        const std::uint8_t* readIter = buf.data();
+        if (fieldTmp.read(readIter, buf.size()) != comms::ErrorStatus::Success) {
+            return false;
+        }
+
+        auto info = BaseImpl::thisLayer().getFragmentInfoFromField(fieldTmp);
+        return (info.count == count) && (info.index == 0U);
+    }
+
+    // Returns NumOfErrorStatuses when the update needs to be forwarded to the next layer
+    template <typename TIter>
+    comms::ErrorStatus readForUpdate(Field& field, TIter& iter, std::size_t size, std::size_t& remSize) const
+    {
+        auto fromIter = iter;
+        auto es = field.read(iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        remSize = size - static_cast<std::size_t>(std::distance(fromIter, iter));
+        if (BaseImpl::thisLayer().getFragmentInfoFromField(field).count == 1U) {
+            return comms::ErrorStatus::NumOfErrorStatuses;
+        }
+
+        std::advance(iter, remSize);
+        return comms::ErrorStatus::Success;
+    }
+
+    ReassemblySlot* acquireSlot(const FragmentInfo& info)
+    {
+        ReassemblySlot* slot = nullptr;
+        for (auto& s : slots_) {
+            if (s.inUse_ && (s.transferId_ == info.transferId)) {
+                slot = &s;
+                break;
+            }
+        }
+
+        if (info.index != 0U) {
+            if (slot == nullptr) {
+                return nullptr;
+            }
+
+            if ((slot->nextIdx_ != info.index) || (slot->count_ != info.count)) {
+                slot->inUse_ = false;
+                return nullptr;
+            }
+
+            slot->lastUse_ = ++useCounter_;
+            return slot;
+        }
+
+        if (slot == nullptr) {
+            slot = &slots_[0];
+            for (auto& s : slots_) {
+                if (!s.inUse_) {
+                    slot = &s;
+                    break;
+                }
+
+                if (s.lastUse_ < slot->lastUse_) {
+                    slot = &s;
+                }
+            }
+        }
+
+        slot->inUse_ = true;
+        slot->transferId_ = info.transferId;
+        slot->nextIdx_ = 0U;
+        slot->count_ = info.count;
+        slot->lastUse_ = ++useCounter_;
+        slot->buf_.clear();
+        return slot;
+    }
+
+    static bool prepareScratch(ScratchBuffer& buf, std::size_t len)
+    {
+        return prepareScratchInternal(buf, len, StorageTag<>());
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, DynamicStorageTag<TParams...>)
+    {
+        buf.resize(len);
+        return true;
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, FixedStorageTag<TParams...>)
+    {
+        if (buf.capacity() < len) {
+            return false;
+        }
+
+        buf.resize(len);
+        return true;
+    }
+
+    std::array<ReassemblySlot, MaxInFlight> slots_;
+    std::size_t useCounter_ = 0U;
+    std::size_t maxFragmentLen_ = 0U;
+    ScratchBuffer writeBuf_;
+    const void* writeMsg_ = nullptr;
+    std::size_t writeFragLen_ = 0U;
+    std::size_t writeIdx_ = 0U;
+    std::size_t writeCount_ = 0U;
+    std::size_t writeTransferId_ = 0U;
+    std::size_t nextTransferId_ = 0U;
+};
+
+namespace details
+{
+template <typename T>
+struct FragmentationLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TField, typename TNextLayer, typename... TOptions>
+struct FragmentationLayerCheckHelper<FragmentationLayer<TField, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref FragmentationLayer
+/// @related FragmentationLayer
+template <typename T>
+constexpr bool isFragmentationLayer()
+{
+    return details::FragmentationLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
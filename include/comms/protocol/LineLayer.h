@@ -0,0 +1,391 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::LineLayer
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/Field.h"
+#include "comms/field/IntValue.h"
+#include "comms/protocol/details/ByteStuffingHelpers.h"
+#include "comms/protocol/details/LineLayerOptionsParser.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <bool TCrLf>
+struct LineLayerFieldHelper
+{
+    using Type =
+        comms::field::IntValue<
+            comms::Field<comms::option::def::BigEndian>,
+            std::uint8_t,
+            comms::option::def::DefaultNumValue<'\n'>
+        >;
+};
+
+template <>
+struct LineLayerFieldHelper<true>
+{
+    using Type =
+        comms::field::IntValue<
+            comms::Field<comms::option::def::BigEndian>,
+            std::uint16_t,
+            comms::option::def::DefaultNumValue<0x0d0a>
+        >;
+};
+
+template <typename... TOptions>
+using LineLayerField =
+    typename LineLayerFieldHelper<LineLayerOptionsParser<TOptions...>::HasCrLf>::Type;
+
+} // namespace details
+
+/// @brief Protocol layer that terminates the frame with the end of line.
+/// @details Used to model the line delimited text protocols, such as NMEA 0183.
+///     The layer's field is the line terminator, i.e. the @b '\\n' character or
+///     the @b "\\r\\n" sequence when @ref comms::option::app::LineLayerCrLf option
+///     is used. It is written after the data of the wrapped layers.@n
+///     When reading, the leading empty lines are skipped, and the read operation
+///     is forwarded to the next layer with the same iterator limited to the contents of the
+///     line, i.e. no data is copied. When the input iterator is a pointer to
+///     @b std::uint8_t, the end of line is searched using @b memchr(), which is vectorised
+///     by the standard library implementations. In case the line terminator is not
+///     found, the @ref comms::ErrorStatus::NotEnoughData is reported. Any
+///     @ref comms::ErrorStatus::NotEnoughData reported by the wrapped layers is
+///     converted into @ref comms::ErrorStatus::ProtocolError, because the
+///     line is complete.@n
+///     Without the @ref comms::option::app::LineLayerCrLf option the trailing
+///     @b '\\r' character of the line (if present) is not considered to be part of the
+///     line contents. With the option, the line not terminated with the @b "\\r\\n"
+///     sequence is reported as @ref comms::ErrorStatus::ProtocolError.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::LineLayerCrLf - Use the @b "\\r\\n"
+///         sequence to terminate the lines.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/LineLayer.h
+template <typename TNextLayer, typename... TOptions>
+class LineLayer : public
+        details::ProtocolLayerBase<
+            details::LineLayerField<TOptions...>,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                LineLayer<TNextLayer, TOptions...>,
+                details::LineLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            details::LineLayerField<TOptions...>,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                LineLayer<TNextLayer, TOptions...>,
+                details::LineLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::LineLayerOptionsParser<TOptions...>;
+
+public:
+    /// @brief Type of the field object used to read/write the line terminator.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Default constructor
+    explicit LineLayer() = default;
+
+    /// @brief Copy constructor
+    LineLayer(const LineLayer&) = default;
+
+    /// @brief Move constructor
+    LineLayer(LineLayer&&) = default;
+
+    /// @brief Destructor.
+    ~LineLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    LineLayer& operator=(const LineLayer&) = default;
+
+    /// @brief Move assignment.
+    LineLayer& operator=(LineLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether the lines are terminated with
+    ///     the @b "\\r\\n" sequence.
+    static constexpr bool hasCrLf()
+    {
+        return ParsedOptionsInternal::HasCrLf;
+    }
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Skips the leading empty lines, reads the line terminator
+    ///     into the field and forwards the read operation of the line contents
+    ///     to the next layer.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Random access iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced past the line terminator on
+    ///     successful read.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto dataIter = iter;
+        std::size_t skipped = 0U;
+        while ((skipped < size) && isLineEndChar(static_cast<std::uint8_t>(*dataIter))) {
+            ++dataIter;
+            ++skipped;
+        }
+
+        auto remSize = size - skipped;
+        auto lfPos = findLf(dataIter, remSize);
+        if (remSize <= lfPos) {
+            BaseImpl::setMissingSize(1U, extraValues...);
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto hasCr = (0U < lfPos) && (static_cast<std::uint8_t>(*std::next(dataIter, lfPos - 1U)) == '\r');
+        if (hasCrLf() && (!hasCr)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto contentLen = hasCr ? (lfPos - 1U) : lfPos;
+        auto fieldLen = Field::minLength();
+        auto fieldIter = std::next(dataIter, (lfPos + 1U) - fieldLen);
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, fieldIter, fieldLen);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        es = nextLayerReader.read(msg, dataIter, contentLen, extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (es != comms::ErrorStatus::ProtocolError) {
+            iter = fieldIter;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Invokes the write operation of the next layer followed
+    ///     by writing the line terminator.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        auto& thisObj = BaseImpl::thisLayer();
+        auto fieldLen = thisObj.doFieldLength(msg);
+        if (size < fieldLen) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        auto es = nextLayerWriter.write(msg, iter, size - fieldLen);
+        if ((es != comms::ErrorStatus::Success) &&
+            (es != comms::ErrorStatus::UpdateRequired)) {
+            return es;
+        }
+
+        field.setValue(Field().getValue());
+        auto esTmp = thisObj.doWriteField(&msg, field, iter, fieldLen);
+        if (esTmp != comms::ErrorStatus::Success) {
+            return esTmp;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Forwards the update operation to the next layer and skips
+    ///     the line terminator.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(field);
+        auto es = nextLayerUpdater.update(iter, size - Field::maxLength());
+        if (es == comms::ErrorStatus::Success) {
+            std::advance(iter, Field::maxLength());
+        }
+
+        return es;
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::LineLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(field);
+        auto fieldLen = BaseImpl::thisLayer().doFieldLength(msg);
+        auto es = nextLayerUpdater.update(msg, iter, size - fieldLen);
+        if (es == comms::ErrorStatus::Success) {
+            std::advance(iter, fieldLen);
+        }
+
+        return es;
+    }
+
+private:
+    static bool isLineEndChar(std::uint8_t byte)
+    {
+        return (byte == '\n') || (byte == '\r');
+    }
+
+    // Returns size if not found
+    template <typename TIter>
+    static std::size_t findLf(const TIter& iter, std::size_t size)
+    {
+        return findLfInternal(iter, size, details::ByteStuffingIterTag<TIter>());
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findLfInternal(const TIter& iter, std::size_t size, details::ByteStuffingRawPtrTag<TParams...>)
+    {
+        return static_cast<std::size_t>(details::byteStuffingFind(iter, iter + size, '\n') - iter);
+    }
+
+    template <typename TIter, typename... TParams>
+    static std::size_t findLfInternal(const TIter& iter, std::size_t size, details::ByteStuffingGenericIterTag<TParams...>)
+    {
+        auto searchIter = iter;
+        for (auto idx = 0U; idx < size; ++idx) {
+            if (static_cast<std::uint8_t>(*searchIter) == '\n') {
+                return idx;
+            }
+
+            ++searchIter;
+        }
+
+        return size;
+    }
+};
+
+namespace details
+{
+template <typename T>
+struct LineLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TNextLayer, typename... TOptions>
+struct LineLayerCheckHelper<LineLayer<TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref LineLayer
+/// @related LineLayer
+template <typename T>
+constexpr bool isLineLayer()
+{
+    return details::LineLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
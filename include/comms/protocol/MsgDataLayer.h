@@ -13,6 +13,7 @@
 #include <tuple>
 #include <iterator>
 #include <type_traits>
+#include "comms/CompileControl.h"
 #include "comms/Assert.h"
 #include "comms/Field.h"
 #include "comms/Message.h"
@@ -104,6 +105,14 @@ public:
         return true;
     }
 
+    /// @brief Compile time check whether the @b length() reported for the
+    ///     message object is the exact number of bytes the @b write() operation produces.
+    /// @return Always @b true.
+    static constexpr bool hasExactLength()
+    {
+        return true;
+    }
+
     /// @brief Read the message contents.
     /// @details Calls the read() member function of the message object.
     /// @tparam TMsg Type of the @b msg parameter.
@@ -312,7 +321,7 @@ public:
     /// @param[in] size Max number of bytes that can be written.
     /// @return Status of the write operation.
     template <typename TMsg, typename TIter>
-    static ErrorStatus write(
+    static COMMS_CONSTEXPR20 ErrorStatus write(
         const TMsg& msg,
         TIter& iter,
         std::size_t size)
@@ -511,6 +520,40 @@ public:
         return getMsgLength(msg, Tag());
     }
 
+    /// @brief Compile time evaluation of the maximal length of the message payload.
+    /// @details Reports maximal value of @b doMaxLength() of all the provided messages.
+    /// @tparam TMessages All the messages, bundled in @b std::tuple.
+    /// @return Maximal payload length or @b std::numeric_limits<std::size_t>::max()
+    ///     if the messages are unknown (@b void) or at least one of them
+    ///     doesn't report a strict upper limit of its serialisation length
+    ///     (see @ref comms::MessageBase::doFieldsHaveStrictMaxLength()).
+    template <typename TMessages = AllMessages>
+    static constexpr std::size_t maxFrameLength()
+    {
+        return details::ProtocolLayerMsgMaxLengthHelper<TMessages>::value();
+    }
+
+    /// @brief Check whether the recent read operation left pending records.
+    /// @return Always @b false.
+    static constexpr bool hasPendingReadRecords()
+    {
+        return false;
+    }
+
+    /// @brief Read the next pending record of the recently read frame.
+    /// @return Always @ref comms::ErrorStatus::NotEnoughData.
+    template <typename TMsg, typename... TExtraValues>
+    static comms::ErrorStatus readPendingRecord(TMsg&, TExtraValues...)
+    {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    /// @brief Discard pending records of the recently read frame.
+    /// @details Does nothing.
+    static void discardPendingReadRecords()
+    {
+    }
+
     /// @brief Access appropriate field from "cached" bundle of all the
     ///     protocol stack fields.
     /// @param allFields All fields of the protocol stack
@@ -599,25 +642,35 @@ private:
         std::back_insert_iterator<TCollection>& iter,
         std::size_t size)
     {
+        // Read the cached field back from the range appended to the output
+        // collection instead of serializing the message a second time.
+        auto& col = BackInsertContainerAccess<TCollection>::get(iter);
+        auto prevSize = static_cast<std::size_t>(col.size());
         auto es = write(msg, iter, size);
         if (es != comms::ErrorStatus::Success) {
             return es;
         }
 
-        TCollection col;
-        auto dataWriteIter = std::back_inserter(col);
-        auto dataWriteEs = write(msg, dataWriteIter, size);
-        COMMS_ASSERT(dataWriteEs == comms::ErrorStatus::Success);
-        static_cast<void>(dataWriteEs);
-
+        auto writtenCount = static_cast<std::size_t>(col.size()) - prevSize;
         auto dataReadIter = col.cbegin();
-        auto dataReadEs = field.read(dataReadIter, col.size());
+        std::advance(dataReadIter, prevSize);
+        auto dataReadEs = field.read(dataReadIter, writtenCount);
         COMMS_ASSERT(dataReadEs == comms::ErrorStatus::Success);
         static_cast<void>(dataReadEs);
 
         return comms::ErrorStatus::Success;
     }
 
+    template <typename TCollection>
+    struct BackInsertContainerAccess : public std::back_insert_iterator<TCollection>
+    {
+        static TCollection& get(std::back_insert_iterator<TCollection>& iter)
+        {
+            // The "container" is a protected member of std::back_insert_iterator
+            return *(iter.*(&BackInsertContainerAccess::container));
+        }
+    };
+
     template <typename TMsg, typename... TParams>
     static std::size_t getMsgLength(const TMsg& msg, MsgHasLengthTag<TParams...>)
     {
@@ -765,7 +818,7 @@ private:
     }
 
     template <typename TMsg, typename TIter, typename... TParams>
-    static ErrorStatus writeInternal(
+    static COMMS_CONSTEXPR20 ErrorStatus writeInternal(
         const TMsg& msg,
         TIter& iter,
         std::size_t size,
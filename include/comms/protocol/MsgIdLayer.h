@@ -24,6 +24,7 @@
 #include "comms/details/tag.h"
 #include "comms/protocol/details/ProtocolLayerBase.h"
 #include "comms/protocol/details/MsgIdLayerOptionsParser.h"
+#include "comms/protocol/details/MsgIdLayerRecycledMsgs.h"
 #include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
 #include "comms/util/Tuple.h"
 #include "comms/util/type_traits.h"
@@ -59,6 +60,8 @@ namespace protocol
 ///         The overriding class is expected to have the same public interface as @ref comms::MsgFactory.
 ///     @li @ref comms::option::app::MsgFactoryTempl - Override default message factory class.
 ///         The overriding class is expected to have the same public interface as @ref comms::MsgFactory.
+///     @li @ref comms::option::app::MsgIdLayerRecycleMessages - Reuse the message objects
+///         returned via @ref recycleMsg() when reading the next message of the same type.
 ///     @li All the options supported by the @ref comms::MsgFactory. All the options
 ///         except ones listed above will be forwarded to the definition of the
 ///         inner instance of @ref comms::MsgFactory.
@@ -128,6 +131,9 @@ public:
     /// @brief Reason for message creation failure
     using CreateFailureReason = typename MsgFactory::CreateFailureReason;
 
+    static_assert((!ParsedOptionsInternal::HasRecycleMessages) || (!MsgFactory::hasInPlaceAllocation()),
+        "The comms::option::app::MsgIdLayerRecycleMessages option cannot be used with in-place allocation");
+
     /// @brief Default constructor.
     explicit MsgIdLayer() = default;
 
@@ -163,6 +169,37 @@ public:
         return ParsedOptionsInternal::HasMsgFactory;
     }   
 
+    /// @brief Compile time inquiry of whether the decoded message objects
+    ///     are recycled, i.e. @ref comms::option::app::MsgIdLayerRecycleMessages
+    ///     option has been used.
+    static constexpr bool hasRecycleMessages()
+    {
+        return ParsedOptionsInternal::HasRecycleMessages;
+    }
+
+    /// @brief Return previously read message object back to the layer.
+    /// @details When @ref comms::option::app::MsgIdLayerRecycleMessages option
+    ///     is used, the object is kept by the layer and reused when the next
+    ///     message of the same type is read. Prior to the reuse its fields
+    ///     are copy assigned from the default constructed message object
+    ///     of the same type, which keeps the capacity of the storage fields.
+    ///     The message types without fields (see @ref comms::option::def::FieldsImpl)
+    ///     are not reused.
+    ///     Only the last message object of every type produced by the
+    ///     @ref doRead() is accepted, all the others (as well as all the objects
+    ///     when the option is not used) are just destructed.
+    /// @param[in, out] msg Smart pointer to the message object, reset upon return.
+    void recycleMsg(MsgPtr&& msg)
+    {
+        recycleMsgInternal(std::move(msg), RecycleTag<>());
+    }
+
+    /// @brief Release all the message objects kept for recycling.
+    void clearRecycledMsgs()
+    {
+        clearRecycledMsgsInternal(RecycleTag<>());
+    }
+
     /// @brief Customized read functionality, invoked by @ref read().
     /// @details The function will read message ID from the data sequence first,
     ///     generate appropriate (or validate provided) message object based on the read ID and
@@ -270,7 +307,7 @@ public:
     ///       and advanced will pinpoint the location of the error.
     /// @return Status of the write operation.
     template <typename TMsg, typename TIter, typename TNextLayerWriter>
-    ErrorStatus doWrite(
+    COMMS_CONSTEXPR20 ErrorStatus doWrite(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -338,6 +375,13 @@ public:
         return MsgFactory::isDispatchLinearSwitch();
     }
 
+    /// @brief Compile time inquiry whether flat jump table dispatch is 
+    ///     generated internally to map message ID to actual type.
+    static constexpr bool isDispatchJumpTable()
+    {
+        return MsgFactory::isDispatchJumpTable();
+    }
+
 protected:
 
     /// @brief Retrieve message id from the field.
@@ -374,7 +418,7 @@ protected:
     /// @param[out] field Field, value of which needs to be populated
     /// @note May be non-static in the extending class
     template <typename TMsg>
-    static void prepareFieldForWrite(MsgIdParamType id, const TMsg& msg, Field& field)
+    static COMMS_CONSTEXPR20 void prepareFieldForWrite(MsgIdParamType id, const TMsg& msg, Field& field)
     {
         static_cast<void>(msg);
         static_cast<void>(field);
@@ -425,6 +469,89 @@ private:
     template <typename... TParams>
     using NoGenericMsgTag = comms::details::tag::Tag8<>;     
 
+    template <typename... TParams>
+    using RecycleEnabledTag = comms::details::tag::Tag9<>;
+
+    template <typename... TParams>
+    using NoRecycleTag = comms::details::tag::Tag10<>;
+
+    template <typename... TParams>
+    using RecycleTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasRecycleMessages
+        >::template Type<
+            RecycleEnabledTag,
+            NoRecycleTag
+        >;
+
+    template <typename... TParams>
+    using FieldsImplTag = comms::details::tag::Tag11<>;
+
+    template <typename... TParams>
+    using NoFieldsImplTag = comms::details::tag::Tag12<>;
+
+    template <typename TMsg>
+    using FieldsResetTag =
+        typename comms::util::LazyShallowConditional<
+            details::protocolLayerHasFieldsImpl<TMsg>()
+        >::template Type<
+            FieldsImplTag,
+            NoFieldsImplTag
+        >;
+
+    template <typename... TParams>
+    using PolymorphicDispatchTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using LinearSwitchDispatchTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using JumpTableDispatchTag = comms::details::tag::Tag3<>;
+
+    template <typename... TParams>
+    using StaticBinSearchDispatchTag = comms::details::tag::Tag4<>;
+
+    template <typename TFactory>
+    using NonLinearDispatchTag =
+        typename comms::util::LazyShallowConditional<
+            TFactory::isDispatchJumpTable()
+        >::template Type<
+            JumpTableDispatchTag,
+            StaticBinSearchDispatchTag,
+            TFactory
+        >;
+
+    template <typename TFactory>
+    using NonPolymorphicDispatchTag =
+        typename comms::util::LazyShallowConditional<
+            TFactory::isDispatchLinearSwitch()
+        >::template Type<
+            LinearSwitchDispatchTag,
+            NonLinearDispatchTag,
+            TFactory
+        >;
+
+    // Same dispatch policy as used by the message factory
+    template <typename TFactory>
+    using FactoryDispatchTag =
+        typename comms::util::LazyShallowConditional<
+            TFactory::isDispatchPolymorphic()
+        >::template Type<
+            PolymorphicDispatchTag,
+            NonPolymorphicDispatchTag,
+            TFactory
+        >;
+
+    struct NoRecycledMsgs {};
+
+    using RecycledMsgs =
+        typename comms::util::Conditional<
+            ParsedOptionsInternal::HasRecycleMessages
+        >::template Type<
+            details::MsgIdLayerRecycledMsgs<MsgPtr, MsgIdType, std::tuple_size<AllMessages>::value>,
+            NoRecycledMsgs
+        >;
+
     template <typename TIter, typename TNextLayerReader, typename... TExtraValues>
     class ReadRedirectionHandler
     {
@@ -552,6 +679,48 @@ private:
         return ReadRedirectionHandler<TIter, TNextLayerReader, TExtraValues...>(iter, size, std::forward<TNextLayerReader>(nextLayerReader), extraValues...);
     }
 
+    class RecycledMsgResetHandler
+    {
+    public:
+        using RetType = bool;
+
+        template <typename TMsg>
+        RetType handle(TMsg& msg)
+        {
+            static_assert(comms::isMessageBase<TMsg>(), "Expected to be a valid message object");
+            return resetInternal(msg, FieldsResetTag<TMsg>());
+        }
+
+        RetType handle(TMessage& msg)
+        {
+            static_cast<void>(msg);
+            return false;
+        }
+
+    private:
+        template <typename TMsg, typename... TParams>
+        static bool resetInternal(TMsg& msg, FieldsImplTag<TParams...>)
+        {
+            // Copy assignment keeps the capacity of the storage fields
+            msg.fields() = defaultFields<TMsg>();
+            return true;
+        }
+
+        template <typename TMsg>
+        static const typename TMsg::AllFields& defaultFields()
+        {
+            static const typename TMsg::AllFields Fields = TMsg().fields();
+            return Fields;
+        }
+
+        template <typename TMsg, typename... TParams>
+        static bool resetInternal(TMsg& msg, NoFieldsImplTag<TParams...>)
+        {
+            static_cast<void>(msg);
+            return false;
+        }
+    };
+
     template <typename TIter, typename TNextLayerWriter>
     class WriteRedirectionHandler
     {
@@ -716,7 +885,7 @@ private:
         CreateFailureReason failureReason = CreateFailureReason::None;
         while (true) {
             COMMS_ASSERT(!msg);
-            msg = createMsgInternal(id, idx, &failureReason);
+            msg = acquireMsgInternal(id, idx, &failureReason, RecycleTag<>());
             if (!msg) {
                 break;
             }
@@ -729,11 +898,12 @@ private:
             thisObj.beforeRead(field, *msg);
             es = doReadInternal(id, idx, msg, iter, size, std::forward<TNextLayerReader>(nextLayerReader), Tag(), extraValues...);
             if (es == comms::ErrorStatus::Success) {
+                markIssuedInternal(id, idx, msg, RecycleTag<>());
                 BaseImpl::setMsgIndex(idx, extraValues...);
                 return es;
             }
 
-            msg.reset();
+            releaseMsgInternal(id, idx, msg, RecycleTag<>());
             iter = readStart;
             ++idx;
         }
@@ -804,6 +974,111 @@ private:
         return createMsgInternalTagged(std::forward<TId>(id), idx, reason, IdParamTag<IdType>());
     }
 
+    template <typename TId, typename... TParams>
+    MsgPtr acquireMsgInternal(TId&& id, unsigned idx, CreateFailureReason* reason, NoRecycleTag<TParams...>)
+    {
+        return createMsgInternal(std::forward<TId>(id), idx, reason);
+    }
+
+    template <typename TId, typename... TParams>
+    MsgPtr acquireMsgInternal(TId&& id, unsigned idx, CreateFailureReason* reason, RecycleEnabledTag<TParams...>)
+    {
+        auto msg = recycledMsgs_.take(static_cast<MsgIdType>(id), idx);
+        if (msg) {
+            RecycledMsgResetHandler handler;
+            if (dispatchRecycledMsg(static_cast<MsgIdType>(id), idx, *msg, handler)) {
+                return msg;
+            }
+
+            msg.reset();
+        }
+
+        return createMsgInternal(std::forward<TId>(id), idx, reason);
+    }
+
+    template <typename THandler>
+    static bool dispatchRecycledMsg(MsgIdParamType id, unsigned idx, TMessage& msg, THandler& handler)
+    {
+        return dispatchRecycledMsgInternal(id, idx, msg, handler, FactoryDispatchTag<MsgFactory>());
+    }
+
+    template <typename THandler, typename... TParams>
+    static bool dispatchRecycledMsgInternal(MsgIdParamType id, unsigned idx, TMessage& msg, THandler& handler, PolymorphicDispatchTag<TParams...>)
+    {
+        return comms::dispatchMsgPolymorphic<AllMessages>(id, idx, msg, handler);
+    }
+
+    template <typename THandler, typename... TParams>
+    static bool dispatchRecycledMsgInternal(MsgIdParamType id, unsigned idx, TMessage& msg, THandler& handler, LinearSwitchDispatchTag<TParams...>)
+    {
+        return comms::dispatchMsgLinearSwitch<AllMessages>(id, idx, msg, handler);
+    }
+
+    template <typename THandler, typename... TParams>
+    static bool dispatchRecycledMsgInternal(MsgIdParamType id, unsigned idx, TMessage& msg, THandler& handler, JumpTableDispatchTag<TParams...>)
+    {
+        return comms::dispatchMsgJumpTable<AllMessages>(id, idx, msg, handler);
+    }
+
+    template <typename THandler, typename... TParams>
+    static bool dispatchRecycledMsgInternal(MsgIdParamType id, unsigned idx, TMessage& msg, THandler& handler, StaticBinSearchDispatchTag<TParams...>)
+    {
+        return comms::dispatchMsgStaticBinSearch<AllMessages>(id, idx, msg, handler);
+    }
+
+    template <typename TId, typename TMsg, typename... TParams>
+    void markIssuedInternal(TId&& id, unsigned idx, const TMsg& msg, NoRecycleTag<TParams...>)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        static_cast<void>(msg);
+    }
+
+    template <typename TId, typename TMsg, typename... TParams>
+    void markIssuedInternal(TId&& id, unsigned idx, const TMsg& msg, RecycleEnabledTag<TParams...>)
+    {
+        recycledMsgs_.markIssued(static_cast<MsgIdType>(id), idx, msg.get());
+    }
+
+    template <typename TId, typename TMsg, typename... TParams>
+    void releaseMsgInternal(TId&& id, unsigned idx, TMsg& msg, NoRecycleTag<TParams...>)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        msg.reset();
+    }
+
+    template <typename TId, typename TMsg, typename... TParams>
+    void releaseMsgInternal(TId&& id, unsigned idx, TMsg& msg, RecycleEnabledTag<TParams...>)
+    {
+        recycledMsgs_.put(static_cast<MsgIdType>(id), idx, std::move(msg));
+        msg.reset();
+    }
+
+    template <typename... TParams>
+    void recycleMsgInternal(MsgPtr&& msg, NoRecycleTag<TParams...>)
+    {
+        msg.reset();
+    }
+
+    template <typename... TParams>
+    void recycleMsgInternal(MsgPtr&& msg, RecycleEnabledTag<TParams...>)
+    {
+        recycledMsgs_.recycle(std::move(msg));
+        msg.reset();
+    }
+
+    template <typename... TParams>
+    void clearRecycledMsgsInternal(NoRecycleTag<TParams...>)
+    {
+    }
+
+    template <typename... TParams>
+    void clearRecycledMsgsInternal(RecycleEnabledTag<TParams...>)
+    {
+        recycledMsgs_.clear();
+    }
+
     template <typename TId, typename... TParams>
     MsgPtr createGenericMsgInternalTagged(TId&& id, unsigned idx, IdParamAsIsTag<TParams...>)
     {
@@ -932,7 +1207,7 @@ private:
     }
 
     template <typename TMsg, typename TIter, typename TNextLayerWriter, typename... TParams>
-    ErrorStatus writeInternal(
+    COMMS_CONSTEXPR20 ErrorStatus writeInternal(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -961,6 +1236,7 @@ private:
     }
 
     MsgFactory factory_;
+    RecycledMsgs recycledMsgs_;
 };
 
 
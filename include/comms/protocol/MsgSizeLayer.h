@@ -246,7 +246,7 @@ public:
     ///       written. In case of an error, distance between original position
     ///       and advanced will pinpoint the location of the error.
     template <typename TMsg, typename TIter, typename TNextLayerWriter>
-    ErrorStatus doWrite(
+    COMMS_CONSTEXPR20 ErrorStatus doWrite(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -335,7 +335,7 @@ protected:
     /// @param[out] field Field, value of which needs to be populated
     /// @note May be non-static in the extending class
     template <typename TMsg>
-    static void prepareFieldForWrite(std::size_t size, const TMsg* msg, Field& field)
+    static COMMS_CONSTEXPR20 void prepareFieldForWrite(std::size_t size, const TMsg* msg, Field& field)
     {
         static_cast<void>(msg);
         field.setValue(size);
@@ -366,14 +366,15 @@ private:
     template<typename TMsg>
     using MsgLengthTag =
         typename comms::util::LazyShallowConditional<
-            details::ProtocolLayerHasFieldsImpl<TMsg>::Value || TMsg::hasLength()
+            (details::ProtocolLayerHasFieldsImpl<TMsg>::Value || TMsg::hasLength()) &&
+            BaseImpl::NextLayer::hasExactLength()
         >::template Type<
             MsgHasLengthTag,
             MsgNoLengthTag
         >;
 
     template <typename TMsg, typename TIter, typename TWriter>
-    ErrorStatus writeInternalHasLength(
+    COMMS_CONSTEXPR20 ErrorStatus writeInternalHasLength(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -490,7 +491,7 @@ private:
     }
 
     template <typename TMsg, typename TIter, typename TWriter, typename... TParams>
-    ErrorStatus writeInternal(
+    COMMS_CONSTEXPR20 ErrorStatus writeInternal(
         Field& field,
         const TMsg& msg,
         TIter& iter,
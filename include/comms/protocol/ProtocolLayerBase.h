@@ -14,6 +14,7 @@
 #include <utility>
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 
 #include "comms/CompileControl.h"
 #include "comms/ErrorStatus.h"
@@ -112,7 +113,7 @@ public:
     ///     @ref NextLayer object.
     /// @param args Arguments to be passed to the constructor of the next layer
     template <typename... TArgs>
-    explicit ProtocolLayerBase(TArgs&&... args)
+    explicit COMMS_CONSTEXPR20 ProtocolLayerBase(TArgs&&... args)
       : nextLayer_(std::forward<TArgs>(args)...)
     {
     }
@@ -130,7 +131,7 @@ public:
     }
 
     /// @brief Get "const" access to the next layer object.
-    const NextLayer& nextLayer() const
+    COMMS_CONSTEXPR20 const NextLayer& nextLayer() const
     {
         return nextLayer_;
     }
@@ -142,7 +143,7 @@ public:
     }
 
     /// @brief Get "const" access to this layer object.
-    const ThisLayer& thisLayer() const
+    COMMS_CONSTEXPR20 const ThisLayer& thisLayer() const
     {
         return static_cast<const ThisLayer&>(*this);
     }
@@ -154,6 +155,16 @@ public:
         return (!ParsedOptions::HasDisallowReadUntilDataSplit) && NextLayer::canSplitRead();
     }
 
+    /// @brief Compile time check whether the @ref length() reported for the
+    ///     message object is the exact number of bytes the @ref write() operation produces.
+    /// @details The default implementation forwards the inquiry to the next layer.
+    ///     Layers transforming the written data (such as @ref comms::protocol::CompressionLayer)
+    ///     report @b false, in such case @ref length() is the upper limit only.
+    static constexpr bool hasExactLength()
+    {
+        return NextLayer::hasExactLength();
+    }
+
     /// @brief Deserialise message from the input data sequence.
     /// @details The function will invoke @b doRead() member function
     ///     provided by the derived class, which must have the following signature
@@ -483,7 +494,7 @@ public:
     ///       and advanced will pinpoint the location of the error.
     /// @return Status of the write operation.
     template <typename TMsg, typename TIter>
-    comms::ErrorStatus write(
+    COMMS_CONSTEXPR20 comms::ErrorStatus write(
         const TMsg& msg,
         TIter& iter,
         std::size_t size) const
@@ -561,6 +572,73 @@ public:
         return thisLayer().doFieldLength(msg) + nextLayer_.length(msg);
     }
 
+    /// @brief Compile time evaluation of the maximal length of the serialised frame.
+    /// @details Sums the @b maxLength() of the fields of all the layers and
+    ///     the maximal @b doMaxLength() of the provided messages. Allows
+    ///     definition of the output buffer which is guaranteed to be big enough
+    ///     for any message, for example:
+    ///     @code
+    ///     std::array<std::uint8_t, ProtStack::maxFrameLength()> outBuf;
+    ///     @endcode
+    ///     The messages are the @b AllMessages of the stack (defined by
+    ///     @ref comms::protocol::MsgIdLayer).
+    /// @return Maximal frame length or @b std::numeric_limits<std::size_t>::max()
+    ///     if such cannot be determined at compile time (for example when
+    ///     some of the fields use storage of unlimited size like @b std::vector).
+    static constexpr std::size_t maxFrameLength()
+    {
+        return maxFrameLength<typename TDerived::AllMessages>();
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame
+    ///     for the provided messages.
+    /// @details Similar to other @ref maxFrameLength(), but allows limiting the
+    ///     evaluation to the subset of the supported messages.
+    /// @tparam TMessages Messages, bundled in @b std::tuple.
+    template <typename TMessages>
+    static constexpr std::size_t maxFrameLength()
+    {
+        return 
+            Field::hasStrictMaxLength() ?
+                details::protocolLayerMaxFrameLengthSum(
+                    MaxFieldLength, 
+                    NextLayer::template maxFrameLength<TMessages>()) :
+                details::protocolLayerNoMaxFrameLength();
+    }
+
+    /// @brief Serialise message into the output buffer, which is known to be
+    ///     big enough.
+    /// @details Invokes @ref write() with the output size being @ref maxFrameLength().
+    ///     When the message fields report strict upper limit of their serialisation
+    ///     length, the message object doesn't calculate its actual length
+    ///     prior to writing and uses @b writeNoStatus() of its fields (if such are
+    ///     available).
+    /// @tparam TMsg Type of the message being written.
+    /// @tparam TIter Type of random access iterator used for writing.
+    /// @param[in] msg Reference to message object, must be one of the @b AllMessages.
+    /// @param[in, out] iter Output iterator used for writing.
+    /// @pre There are at least @ref maxFrameLength() bytes available in the
+    ///     output buffer, for example:
+    ///     @code
+    ///     std::array<std::uint8_t, ProtStack::maxFrameLength()> outBuf;
+    ///     auto writeIter = comms::writeIteratorFor<MyMessage>(outBuf.begin());
+    ///     protStack.writeNoStatus(msg, writeIter);
+    ///     @endcode
+    template <typename TMsg, typename TIter>
+    void writeNoStatus(const TMsg& msg, TIter& iter) const
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IterCategory = typename std::iterator_traits<IterType>::iterator_category;
+        static_assert(std::is_base_of<std::random_access_iterator_tag, IterCategory>::value,
+            "Random access iterator is expected to be used");
+        static_assert(maxFrameLength() != details::protocolLayerNoMaxFrameLength(),
+            "The maximal frame length must be known at compile time");
+
+        auto es = write(msg, iter, maxFrameLength());
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    }
+
     /// @brief Update recently written (using write()) message contents data.
     /// @details Sometimes, when NON random access iterator is used for writing
     ///     (for example std::back_insert_iterator), some transport data cannot
@@ -774,6 +852,40 @@ public:
         return nextLayer().createMsg(std::forward<TId>(id), idx);
     }
 
+    /// @brief Check whether the recent @ref read() operation left records
+    ///     in the input buffer which haven't been read yet.
+    /// @details Relevant for the layers that pack multiple messages into a
+    ///     single frame, such as @ref comms::protocol::BatchLayer. The default
+    ///     implementation forwards this call to the next layer.
+    bool hasPendingReadRecords() const
+    {
+        return nextLayer().hasPendingReadRecords();
+    }
+
+    /// @brief Read the next pending record of the recently read frame.
+    /// @details The default implementation forwards this call to the next
+    ///     layer. One of the layers (usually comms::protocol::BatchLayer)
+    ///     hides and overrides this implementation. The input buffer of the
+    ///     recent @ref read() operation must still be valid.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[out] extraValues Variadic extra output parameters.
+    /// @return Status of the read operation, @ref comms::ErrorStatus::NotEnoughData
+    ///     in case there are no pending records.
+    template <typename TMsg, typename... TExtraValues>
+    comms::ErrorStatus readPendingRecord(TMsg& msg, TExtraValues... extraValues)
+    {
+        return nextLayer().readPendingRecord(msg, extraValues...);
+    }
+
+    /// @brief Discard pending records of the recently read frame.
+    /// @details The default implementation forwards this call to the next layer.
+    void discardPendingReadRecords()
+    {
+        nextLayer().discardPendingReadRecords();
+    }
+
     /// @brief Access appropriate field from "cached" bundle of all the
     ///     protocol stack fields.
     /// @param allFields All fields of the protocol stack
@@ -816,7 +928,7 @@ protected:
     /// @param[in] len Length of the output buffer
     /// @note May be non-static in the extending class, but needs to be const.
     template <typename TMsg, typename TIter>
-    static comms::ErrorStatus doWriteField(const TMsg* msgPtr, const Field& field, TIter& iter, std::size_t len)
+    static COMMS_CONSTEXPR20 comms::ErrorStatus doWriteField(const TMsg* msgPtr, const Field& field, TIter& iter, std::size_t len)
     {
         static_cast<void>(msgPtr);
         return field.write(iter, len);
@@ -1097,13 +1209,13 @@ protected:
     {
     public:
 
-        explicit NextLayerWriter(const NextLayer& nextLayer)
+        explicit COMMS_CONSTEXPR20 NextLayerWriter(const NextLayer& nextLayer)
           : nextLayer_(nextLayer)
         {
         }
 
         template <typename TMsg, typename TIter>
-        ErrorStatus write(const TMsg& msg, TIter& iter, std::size_t size) const
+        COMMS_CONSTEXPR20 ErrorStatus write(const TMsg& msg, TIter& iter, std::size_t size) const
         {
             return nextLayer_.write(msg, iter, size);
         }
@@ -1213,7 +1325,7 @@ protected:
         return NextLayerCachedFieldsUntilDataReader<TAllFields>(nextLayer_, fields);
     }
 
-    NextLayerWriter createNextLayerWriter() const
+    COMMS_CONSTEXPR20 NextLayerWriter createNextLayerWriter() const
     {
         return NextLayerWriter(nextLayer_);
     }
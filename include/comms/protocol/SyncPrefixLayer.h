@@ -171,7 +171,7 @@ public:
     ///       written. In case of an error, distance between original position
     ///       and advanced will pinpoint the location of the error.
     template <typename TMsg, typename TIter, typename TNextLayerWriter>
-    comms::ErrorStatus doWrite(
+    COMMS_CONSTEXPR20 comms::ErrorStatus doWrite(
         Field& field,
         const TMsg& msg,
         TIter& iter,
@@ -208,7 +208,7 @@ protected:
     /// @param[out] field Field, default value of which needs to be (re)populated
     /// @note May be non-static in the extending class, but must be const, use
     ///     mutable member data in case it needs to be updated.
-    static void prepareFieldForWrite(Field& field)
+    static COMMS_CONSTEXPR20 void prepareFieldForWrite(Field& field)
     {
         static_cast<void>(field);
     }
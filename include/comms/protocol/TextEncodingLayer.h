@@ -0,0 +1,458 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::TextEncodingLayer
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/CompileControl.h"
+#include "comms/ErrorStatus.h"
+#include "comms/Field.h"
+#include "comms/field/IntValue.h"
+#include "comms/details/tag.h"
+#include "comms/protocol/details/ProtocolLayerBase.h"
+#include "comms/protocol/details/ProtocolLayerExtendingClassHelper.h"
+#include "comms/protocol/details/TextEncodingLayerOptionsParser.h"
+#include "comms/protocol/text/Base64.h"
+#include "comms/protocol/text/Hex.h"
+#include "comms/util/type_traits.h"
+
+COMMS_MSVC_WARNING_PUSH
+COMMS_MSVC_WARNING_DISABLE(4189) // Disable erroneous initialized but not referenced variable warning
+
+namespace comms
+{
+
+namespace protocol
+{
+
+/// @brief Protocol layer that encodes the data written by all the wrapped
+///     internal layers as text (such as hexadecimal or Base64) and decodes it
+///     prior to forwarding the read operation to them.
+/// @details The layer doesn't define the frame boundaries, all the data
+///     passed to the read operation is expected to be the encoded frame. As the result
+///     it is expected to be wrapped by the layer that does, such as @ref comms::protocol::LineLayer.
+///     The layer's field has empty serialisation (see @ref comms::option::def::EmptySerialization).
+///     When reading, the whole encoded data is decoded in a single pass into the internal
+///     scratch buffer and the read operation is forwarded to the next layer with the iterator
+///     to the decoded data. When writing, the wrapped layers write into the scratch
+///     buffer local to the @b write operation, which is then encoded directly into
+///     the output buffer. The @b write operation doesn't modify the state of the
+///     layer and is safe to be invoked concurrently.@n
+///     The read scratch buffer is reused between the calls, the dynamic memory allocation
+///     happens only when its capacity needs to grow. Use
+///     @ref comms::option::app::FixedSizeStorage option to avoid dynamic memory
+///     allocation altogether, in such case the write scratch buffer resides on the stack.@n
+///     The iterators used to access the scratch buffers are @b const @b std::uint8_t*
+///     for reading and @b std::uint8_t* for writing. When the layer is used
+///     for polymorphic read and/or write of the message objects, they must be convertible
+///     to the @b ReadIterator and/or @b WriteIterator of the message interface.
+/// @tparam TCodec The text codec class. It must have the following members
+///     defined:
+///     @code
+///     // Length of the encoded data
+///     static constexpr std::size_t encodedLength(std::size_t len);
+///
+///     // Maximal length of the decoded data
+///     static constexpr std::size_t maxDecodedLength(std::size_t len);
+///
+///     // Encode the data
+///     template <typename TIter>
+///     void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const;
+///
+///     // Decode srcLen characters into dst, which can accommodate
+///     // at least maxDecodedLength(srcLen) bytes, returns false on malformed data
+///     template <typename TIter>
+///     bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const;
+///     @endcode
+///     Available codecs provided by the COMMS library reside in
+///     @ref comms::protocol::text namespace (`comms/protocol/text` folder):
+///     @ref comms::protocol::text::Hex and @ref comms::protocol::text::Base64.
+/// @tparam TNextLayer Next transport layer in protocol stack.
+/// @tparam TOptions Extending functionality options. Supported options are:
+///     @li @ref comms::option::app::FixedSizeStorage - Use fixed size storage
+///         for the scratch buffers instead of @b std::vector. In case the data
+///         doesn't fit, the @b write operation returns
+///         @ref comms::ErrorStatus::BufferOverflow and the @b read operation
+///         returns @ref comms::ErrorStatus::ProtocolError.
+///     @li  @ref comms::option::def::ExtendingClass - Use this option to provide a class
+///         name of the extending class, which can be used to extend existing functionality.
+/// @headerfile comms/protocol/TextEncodingLayer.h
+template <typename TCodec, typename TNextLayer, typename... TOptions>
+class TextEncodingLayer : public
+        details::ProtocolLayerBase<
+            comms::field::IntValue<
+                comms::Field<comms::option::def::BigEndian>,
+                std::uint8_t,
+                comms::option::def::EmptySerialization
+            >,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                TextEncodingLayer<TCodec, TNextLayer, TOptions...>,
+                details::TextEncodingLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >
+{
+    using BaseImpl =
+        details::ProtocolLayerBase<
+            comms::field::IntValue<
+                comms::Field<comms::option::def::BigEndian>,
+                std::uint8_t,
+                comms::option::def::EmptySerialization
+            >,
+            TNextLayer,
+            details::ProtocolLayerExtendingClassT<
+                TextEncodingLayer<TCodec, TNextLayer, TOptions...>,
+                details::TextEncodingLayerOptionsParser<TOptions...>
+            >,
+            comms::option::def::ProtocolLayerDisallowReadUntilDataSplit
+        >;
+
+    using ParsedOptionsInternal = details::TextEncodingLayerOptionsParser<TOptions...>;
+    using ScratchBuffer = typename ParsedOptionsInternal::ScratchBuffer;
+
+public:
+    /// @brief Type of the field object used by the layer, has empty serialisation.
+    using Field = typename BaseImpl::Field;
+
+    /// @brief Provided text codec.
+    using Codec = TCodec;
+
+    /// @brief Type of real extending class
+    /// @details Updated when @ref comms::option::def::ExtendingClass extension option us used,
+    ///    aliasing @b void if the options is not used.
+    using ExtendingClass = typename ParsedOptionsInternal::ExtendingClass;
+
+    /// @brief Default constructor
+    explicit TextEncodingLayer() = default;
+
+    /// @brief Copy constructor
+    TextEncodingLayer(const TextEncodingLayer&) = default;
+
+    /// @brief Move constructor
+    TextEncodingLayer(TextEncodingLayer&&) = default;
+
+    /// @brief Destructor.
+    ~TextEncodingLayer() noexcept = default;
+
+    /// @brief Copy assignment.
+    TextEncodingLayer& operator=(const TextEncodingLayer&) = default;
+
+    /// @brief Move assignment.
+    TextEncodingLayer& operator=(TextEncodingLayer&&) = default;
+
+    /// @brief Compile time inquiry of whether this class was extended via
+    ///    @ref comms::option::def::ExtendingClass option.
+    static constexpr bool hasExtendingClass()
+    {
+        return ParsedOptionsInternal::HasExtendingClass;
+    }
+
+    /// @brief Compile time inquiry of whether fixed size storage is used
+    ///     for the scratch buffers.
+    static constexpr bool hasFixedSizeStorage()
+    {
+        return ParsedOptionsInternal::HasFixedSizeStorage;
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame.
+    /// @details Takes into account the encoding overhead.
+    static constexpr std::size_t maxFrameLength()
+    {
+        return maxFrameLength<typename BaseImpl::AllMessages>();
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the serialised frame
+    ///     for the provided messages.
+    /// @details Takes into account the encoding overhead.
+    /// @tparam TMessages Messages, bundled in @b std::tuple.
+    template <typename TMessages>
+    static constexpr std::size_t maxFrameLength()
+    {
+        return encodedFrameLength(BaseImpl::NextLayer::template maxFrameLength<TMessages>());
+    }
+
+    /// @brief Serialise message into the output buffer, which is known to be
+    ///     big enough.
+    /// @details Same as @ref comms::protocol::ProtocolLayerBase::writeNoStatus(),
+    ///     but takes into account the encoding overhead.
+    template <typename TMsg, typename TIter>
+    void writeNoStatus(const TMsg& msg, TIter& iter) const
+    {
+        static_assert(maxFrameLength() != details::protocolLayerNoMaxFrameLength(),
+            "The maximal frame length must be known at compile time");
+
+        auto es = BaseImpl::write(msg, iter, maxFrameLength());
+        static_cast<void>(es);
+        COMMS_ASSERT(es == comms::ErrorStatus::Success);
+    }
+
+    /// @cond SKIP_DOC
+
+    static constexpr std::size_t doFieldLength()
+    {
+        return BaseImpl::doFieldLength();
+    }
+
+    template <typename TMsg>
+    std::size_t doFieldLength(const TMsg& msg) const
+    {
+        auto dataLen = BaseImpl::nextLayer().length(msg);
+        return Codec::encodedLength(dataLen) - dataLen;
+    }
+    /// @endcond
+
+    /// @brief Customized read functionality, invoked by @ref read().
+    /// @details Decodes all the provided data into the scratch buffer and
+    ///     forwards the read operation to the next layer with the iterator
+    ///     to the decoded data.
+    /// @tparam TMsg Type of @b msg parameter.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @tparam TNextLayerReader next layer reader object type.
+    /// @param[out] field Field object to read.
+    /// @param[in, out] msg Reference to smart pointer, that already holds or
+    ///     will hold allocated message object, or reference to actual message
+    ///     object (which extends @ref comms::MessageBase).
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the encoded frame.
+    /// @param[in] nextLayerReader Reader object, needs to be invoked to
+    ///     forward read operation to the next layer.
+    /// @param[out] extraValues Variadic extra output parameters passed to the
+    ///     "read" operatation of the protocol stack.
+    /// @return Status of the read operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by "size" bytes on successful read.
+    template <typename TMsg, typename TIter, typename TNextLayerReader, typename... TExtraValues>
+    comms::ErrorStatus doRead(
+        Field& field,
+        TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerReader&& nextLayerReader,
+        TExtraValues... extraValues)
+    {
+        auto* msgPtr = BaseImpl::toMsgPtr(msg);
+        auto& thisObj = BaseImpl::thisLayer();
+        auto es = thisObj.doReadField(msgPtr, field, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        if (!prepareScratch(readBuf_, Codec::maxDecodedLength(size))) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto dataIter = iter;
+        std::size_t decodedLen = 0U;
+        if (!Codec().decode(dataIter, size, readBuf_.data(), decodedLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        const std::uint8_t* readIter = readBuf_.data();
+        es = nextLayerReader.read(msg, readIter, decodedLen, extraValues...);
+        if (es == comms::ErrorStatus::NotEnoughData) {
+            BaseImpl::resetMsg(msg);
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (es != comms::ErrorStatus::ProtocolError) {
+            iter = dataIter;
+        }
+
+        return es;
+    }
+
+    /// @brief Customized write functionality, invoked by @ref write().
+    /// @details Invokes the write operation of the next layer into the
+    ///     scratch buffer, then encodes the written data into the output
+    ///     buffer.
+    /// @tparam TMsg Type of message object.
+    /// @tparam TIter Type of iterator used for writing.
+    /// @tparam TNextLayerWriter next layer writer object type.
+    /// @param[out] field Field object to update and write.
+    /// @param[in] msg Reference to message object, must be able to report
+    ///     its serialisation length.
+    /// @param[in, out] iter Output iterator.
+    /// @param[in] size Max number of bytes that can be written.
+    /// @param[in] nextLayerWriter Next layer writer object.
+    /// @return Status of the write operation.
+    /// @pre Iterator must be valid and can be dereferenced and incremented at
+    ///      least "size" times;
+    /// @post The iterator will be advanced by the number of bytes was actually
+    ///       written.
+    template <typename TMsg, typename TIter, typename TNextLayerWriter>
+    comms::ErrorStatus doWrite(
+        Field& field,
+        const TMsg& msg,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerWriter&& nextLayerWriter) const
+    {
+        using MsgType = typename std::decay<decltype(msg)>::type;
+        static_assert(details::ProtocolLayerHasFieldsImpl<MsgType>::Value || MsgType::hasLength(),
+            "TextEncodingLayer requires the message length to be known prior to write");
+
+        auto rawLen = BaseImpl::nextLayer().length(msg);
+        ScratchBuffer writeBuf;
+        if (!prepareScratch(writeBuf, rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        std::uint8_t* writeIter = writeBuf.data();
+        auto es = nextLayerWriter.write(msg, writeIter, rawLen);
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            std::uint8_t* updateIter = writeBuf.data();
+            es = BaseImpl::nextLayer().update(msg, updateIter, static_cast<std::size_t>(writeIter - writeBuf.data()));
+        }
+
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        rawLen = static_cast<std::size_t>(writeIter - writeBuf.data());
+        if (size < Codec::encodedLength(rawLen)) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        Codec().encode(writeBuf.data(), rawLen, iter);
+        auto& thisObj = BaseImpl::thisLayer();
+        return thisObj.doWriteField(&msg, field, iter, size - Codec::encodedLength(rawLen));
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details The data written by the @ref doWrite() is already final,
+    ///     the function just skips it without forwarding the update
+    ///     operation to the next layer.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(field);
+        static_cast<void>(nextLayerUpdater);
+        std::advance(iter, size);
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Customized update functionality, invoked by @ref update().
+    /// @details Similar to other @ref comms::protocol::TextEncodingLayer::doUpdate() "doUpdate()",
+    ///     but receiving reference to valid message object.
+    /// @param[in] msg Reference to valid message object.
+    /// @param[out] field Field object to update.
+    /// @param[in, out] iter Any random access iterator.
+    /// @param[in] size Number of bytes that have been written using write().
+    /// @param[in] nextLayerUpdater Next layer updater object.
+    /// @return Status of the update operation.
+    template <typename TMsg, typename TIter, typename TNextLayerUpdater>
+    comms::ErrorStatus doUpdate(
+        const TMsg& msg,
+        Field& field,
+        TIter& iter,
+        std::size_t size,
+        TNextLayerUpdater&& nextLayerUpdater) const
+    {
+        static_cast<void>(msg);
+        return doUpdate(field, iter, size, std::forward<TNextLayerUpdater>(nextLayerUpdater));
+    }
+
+private:
+    template <typename... TParams>
+    using DynamicStorageTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using FixedStorageTag = comms::details::tag::Tag2<>;
+
+    template <typename... TParams>
+    using StorageTag =
+        typename comms::util::LazyShallowConditional<
+            ParsedOptionsInternal::HasFixedSizeStorage
+        >::template Type<
+            FixedStorageTag,
+            DynamicStorageTag
+        >;
+
+    static constexpr std::size_t encodedFrameLength(std::size_t len)
+    {
+        return
+            (len == details::protocolLayerNoMaxFrameLength()) ?
+                details::protocolLayerNoMaxFrameLength() :
+                details::protocolLayerMaxFrameLengthSum(Field::maxLength(), Codec::encodedLength(len));
+    }
+
+    static bool prepareScratch(ScratchBuffer& buf, std::size_t len)
+    {
+        return prepareScratchInternal(buf, len, StorageTag<>());
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, DynamicStorageTag<TParams...>)
+    {
+        buf.resize(len);
+        return true;
+    }
+
+    template <typename... TParams>
+    static bool prepareScratchInternal(ScratchBuffer& buf, std::size_t len, FixedStorageTag<TParams...>)
+    {
+        if (buf.capacity() < len) {
+            return false;
+        }
+
+        buf.resize(len);
+        return true;
+    }
+
+    ScratchBuffer readBuf_;
+};
+
+namespace details
+{
+template <typename T>
+struct TextEncodingLayerCheckHelper
+{
+    static const bool Value = false;
+};
+
+template <typename TCodec, typename TNextLayer, typename... TOptions>
+struct TextEncodingLayerCheckHelper<TextEncodingLayer<TCodec, TNextLayer, TOptions...> >
+{
+    static const bool Value = true;
+};
+
+} // namespace details
+
+/// @brief Compile time check of whether the provided type is
+///     a variant of @ref TextEncodingLayer
+/// @related TextEncodingLayer
+template <typename T>
+constexpr bool isTextEncodingLayer()
+{
+    return details::TextEncodingLayerCheckHelper<T>::Value;
+}
+
+}  // namespace protocol
+
+}  // namespace comms
+
+COMMS_MSVC_WARNING_POP
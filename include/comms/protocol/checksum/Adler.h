@@ -0,0 +1,86 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::checksum::Adler32
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "comms/protocol/details/ModularSumsHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace checksum
+{
+
+/// @brief Adler-32 checksum calculator.
+/// @details Calculates two running sums modulo @b 65521 over the bytes,
+///     the first one starting from @b 1, the second one accumulating the first.
+///     The result is the second sum in the most significant half and the first
+///     sum in the least significant one (as defined by RFC 1950).
+///     The modulo reduction is performed once per block of 5552 bytes rather
+///     than per byte.
+/// @headerfile comms/protocol/checksum/Adler.h
+class Adler32
+{
+public:
+    /// @brief Type of the intermediate state used by the incremental calculation.
+    /// @details Has the same format as the checksum value.
+    using State = std::uint32_t;
+
+    /// @brief Operator that is invoked to calculate the checksum value
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to summarise.
+    /// @return The checksum value.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    std::uint32_t operator()(TIter& iter, std::size_t len) const
+    {
+        auto state = init();
+        update(state, iter, len);
+        return finalize(state);
+    }
+
+    /// @brief Get initial state of the incremental calculation.
+    static constexpr State init()
+    {
+        return 1U;
+    }
+
+    /// @brief Update the state of the incremental calculation with more bytes.
+    /// @param[in, out] state Intermediate state.
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    static void update(State& state, TIter& iter, std::size_t len)
+    {
+        std::uint32_t sum1 = state & 0xffffU;
+        std::uint32_t sum2 = state >> 16U;
+        comms::protocol::details::ModularSumsHelper<65521U, 5552U, 1U>::update(sum1, sum2, iter, len);
+        state = (sum2 << 16U) | sum1;
+    }
+
+    /// @brief Get the checksum value out of the state of the incremental calculation.
+    static constexpr std::uint32_t finalize(State state)
+    {
+        return state;
+    }
+};
+
+}  // namespace checksum
+
+}  // namespace protocol
+
+}  // namespace comms
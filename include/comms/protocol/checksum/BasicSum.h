@@ -10,7 +10,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+
+#include "comms/CompileControl.h"
 
 namespace comms
 {
@@ -31,24 +35,50 @@ template <typename TResult = std::uint8_t, TResult TInitValue = 0>
 class BasicSum
 {
 public:
+    /// @brief Type of the intermediate state used by the incremental calculation.
+    using State = TResult;
+
     /// @brief Operator that is invoked to calculate the checksum value
     /// @param[in, out] iter Input iterator,
     /// @param[in] len Number of bytes to summarise.
     /// @return The checksum value.
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
-    TResult operator()(TIter& iter, std::size_t len) const
+    COMMS_CONSTEXPR20 TResult operator()(TIter& iter, std::size_t len) const
+    {
+        auto state = init();
+        update(state, iter, len);
+        return finalize(state);
+    }
+
+    /// @brief Get initial state of the incremental calculation.
+    static constexpr State init()
+    {
+        return TInitValue;
+    }
+
+    /// @brief Update the state of the incremental calculation with more bytes.
+    /// @param[in, out] state Intermediate state.
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    static COMMS_CONSTEXPR20 void update(State& state, TIter& iter, std::size_t len)
     {
         using ByteType = typename std::make_unsigned<
             typename std::decay<decltype(*iter)>::type
         >::type;
 
-        TResult checksum = TInitValue;
         for (auto idx = 0U; idx < len; ++idx) {
-            checksum = static_cast<TResult>(checksum + static_cast<ByteType>(*iter));
+            state = static_cast<TResult>(state + static_cast<ByteType>(*iter));
             ++iter;
         }
-        return checksum;
+    }
+
+    /// @brief Get the checksum value out of the state of the incremental calculation.
+    static constexpr TResult finalize(State state)
+    {
+        return state;
     }
 };
 
@@ -269,6 +269,9 @@ class Crc
     static_assert(std::is_unsigned<TResult>::value,
         "The TResult type is expected to be unsigned integral one");
 public:
+    /// @brief Type of the intermediate state used by the incremental calculation.
+    using State = TResult;
+
     /// @brief Operator that is invoked to calculate the checksum value
     /// @param[in, out] iter Input iterator,
     /// @param[in] len Number of bytes to summarise.
@@ -276,11 +279,29 @@ public:
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
     TResult operator()(TIter& iter, std::size_t len) const
+    {
+        auto state = init();
+        update(state, iter, len);
+        return finalize(state);
+    }
+
+    /// @brief Get initial state of the incremental calculation.
+    static constexpr State init()
+    {
+        return TInit;
+    }
+
+    /// @brief Update the state of the incremental calculation with more bytes.
+    /// @param[in, out] state Intermediate state (remainder).
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    static void update(State& state, TIter& iter, std::size_t len)
     {
         static const std::size_t Width =
             sizeof(TResult) * std::numeric_limits<std::uint8_t>::digits;
 
-        TResult rem = TInit;
         auto& initTable = details::CrcInitTable<TResult, TPoly>::get();
 
         for (std::size_t byte = 0U; byte < len; ++byte)
@@ -290,12 +311,16 @@ public:
             >::type;
 
             auto val = static_cast<std::uint8_t>(static_cast<ByteType>(*iter));
-            comms::cast_assign(val) = reflect(val) ^ static_cast<decltype(val)>(rem >> (Width - 8));
-            comms::cast_assign(rem) = initTable[val] ^ static_cast<decltype(rem)>(rem << 8);
+            comms::cast_assign(val) = reflect(val) ^ static_cast<decltype(val)>(state >> (Width - 8));
+            comms::cast_assign(state) = initTable[val] ^ static_cast<State>(state << 8);
             ++iter;
         }
+    }
 
-        return (reflectRem(rem) ^ TFin);
+    /// @brief Get the checksum value out of the state of the incremental calculation.
+    static TResult finalize(State state)
+    {
+        return (reflectRem(state) ^ TFin);
     }
 
 private:
@@ -0,0 +1,178 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::checksum::Fletcher16
+///     and @ref comms::protocol::checksum::Fletcher32
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "comms/protocol/details/ModularSumsHelper.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace checksum
+{
+
+/// @brief Fletcher-16 checksum calculator.
+/// @details Calculates two running sums modulo @b 255 over the bytes, the
+///     second one accumulating the first. The result is the second sum in the
+///     most significant byte and the first sum in the least significant one.
+///     The modulo reduction is performed once per block of bytes rather
+///     than per byte.
+/// @headerfile comms/protocol/checksum/Fletcher.h
+class Fletcher16
+{
+public:
+    /// @brief Type of the intermediate state used by the incremental calculation.
+    using State = std::uint16_t;
+
+    /// @brief Operator that is invoked to calculate the checksum value
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to summarise.
+    /// @return The checksum value.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    std::uint16_t operator()(TIter& iter, std::size_t len) const
+    {
+        auto state = init();
+        update(state, iter, len);
+        return finalize(state);
+    }
+
+    /// @brief Get initial state of the incremental calculation.
+    static constexpr State init()
+    {
+        return 0U;
+    }
+
+    /// @brief Update the state of the incremental calculation with more bytes.
+    /// @param[in, out] state Intermediate state.
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    static void update(State& state, TIter& iter, std::size_t len)
+    {
+        std::uint32_t sum1 = state & 0xffU;
+        std::uint32_t sum2 = static_cast<std::uint32_t>(state >> 8U);
+        comms::protocol::details::ModularSumsHelper<255U, 5802U, 1U>::update(sum1, sum2, iter, len);
+        state = static_cast<State>((sum2 << 8U) | sum1);
+    }
+
+    /// @brief Get the checksum value out of the state of the incremental calculation.
+    static constexpr std::uint16_t finalize(State state)
+    {
+        return state;
+    }
+};
+
+/// @brief Fletcher-32 checksum calculator.
+/// @details Calculates two running sums modulo @b 65535 over the
+///     16 bit little endian words, the second one accumulating the first. The data
+///     of odd length is padded with zero byte. The result is the second sum in the
+///     most significant half and the first sum in the least significant one.
+///     The modulo reduction is performed once per block of words rather
+///     than per word.
+/// @headerfile comms/protocol/checksum/Fletcher.h
+class Fletcher32
+{
+public:
+    /// @brief Type of the intermediate state used by the incremental calculation.
+    /// @details Keeps the byte of the incomplete word when the incremental
+    ///     calculation is updated with the odd number of bytes.
+    struct State
+    {
+        std::uint32_t sum1_ = 0U; ///< First sum
+        std::uint32_t sum2_ = 0U; ///< Second sum
+        std::uint8_t pending_ = 0U; ///< Byte of the incomplete word
+        bool hasPending_ = false; ///< Whether @ref pending_ is valid
+    };
+
+    /// @brief Operator that is invoked to calculate the checksum value
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to summarise.
+    /// @return The checksum value.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    std::uint32_t operator()(TIter& iter, std::size_t len) const
+    {
+        auto state = init();
+        update(state, iter, len);
+        return finalize(state);
+    }
+
+    /// @brief Get initial state of the incremental calculation.
+    static State init()
+    {
+        return State();
+    }
+
+    /// @brief Update the state of the incremental calculation with more bytes.
+    /// @param[in, out] state Intermediate state.
+    /// @param[in, out] iter Input iterator,
+    /// @param[in] len Number of bytes to process.
+    /// @post The iterator is advanced by number of bytes read (len).
+    template <typename TIter>
+    static void update(State& state, TIter& iter, std::size_t len)
+    {
+        using ByteType = typename std::make_unsigned<
+            typename std::decay<decltype(*iter)>::type
+        >::type;
+
+        if (len == 0U) {
+            return;
+        }
+
+        if (state.hasPending_) {
+            addWord(state, state.pending_ | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(static_cast<ByteType>(*iter))) << 8U));
+            ++iter;
+            --len;
+        }
+
+        Helper::update(state.sum1_, state.sum2_, iter, len / 2U);
+        if ((len & 0x1U) != 0U) {
+            state.pending_ = static_cast<std::uint8_t>(static_cast<ByteType>(*iter));
+            state.hasPending_ = true;
+            ++iter;
+        }
+    }
+
+    /// @brief Get the checksum value out of the state of the incremental calculation.
+    static std::uint32_t finalize(State state)
+    {
+        if (state.hasPending_) {
+            addWord(state, state.pending_);
+        }
+
+        return (state.sum2_ << 16U) | state.sum1_;
+    }
+
+private:
+    using Helper = comms::protocol::details::ModularSumsHelper<65535U, 360U, 2U>;
+
+    static void addWord(State& state, std::uint32_t word)
+    {
+        state.sum1_ = (state.sum1_ + word) % 65535U;
+        state.sum2_ = (state.sum2_ + state.sum1_) % 65535U;
+        state.hasPending_ = false;
+    }
+};
+
+}  // namespace checksum
+
+}  // namespace protocol
+
+}  // namespace comms
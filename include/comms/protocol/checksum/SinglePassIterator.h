@@ -0,0 +1,476 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::checksum::SinglePassIterator
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace checksum
+{
+
+/// @brief Random access iterator adaptor, which feeds the bytes it is advanced over
+///     into the incremental checksum calculation.
+/// @details Used by @ref comms::protocol::ChecksumLayer when
+///     @ref comms::option::def::ChecksumLayerSinglePass option is used. The
+///     checksum is calculated while the wrapped layers read (or write) the data
+///     instead of iterating over the same bytes for the second time.
+///     The iterator doesn't depend on the checksum calculator, the calculation
+///     state is kept in the @ref Context object, implemented by
+///     @ref SinglePassContext for the specific calculator. As the result the same
+///     iterator type can be used with any checksum layer. Only the
+///     iterator constructed with the context (the owner) feeds the
+///     bytes into the calculation, and only the bytes beyond the furthest
+///     position reached so far are processed, i.e. moving
+///     backwards and re-iterating does not affect the calculated value.
+///     The bytes are not fed one by one, the context passes them to the
+///     calculator in contiguous spans of at least @ref Context::SpanLength
+///     bytes (while they are still in the cache) and the rest on
+///     @ref Context::flush().
+///     The copies of the owner iterator (including the ones returned by
+///     @b operator+() and @b operator-()) share the context, but never feed
+///     the calculation, because the bytes they advance over may still be
+///     incomplete. Assigning the copy back to the owner iterator is
+///     equivalent to advancing the owner to the new position.@n
+///     When the iterator is used for writing, the context also detects the
+///     overwriting of the already processed bytes by any of the copies
+///     (for example when @ref comms::protocol::MsgSizeLayer updates the written
+///     size value after the payload) and reports the calculated value as invalid.
+///     The calculated value is also reported as invalid when the owner iterator
+///     doesn't reach the end of the written data.@n
+///     When the @ref comms::option::def::ChecksumLayerSinglePass option is
+///     used together with polymorphic read / write of the message objects,
+///     the message interface must use this type in its
+///     @ref comms::option::app::ReadIterator "ReadIterator" and / or
+///     @ref comms::option::app::WriteIterator "WriteIterator" options, for example:
+///     @code
+///     using ReadIter = comms::protocol::checksum::SinglePassIterator<const std::uint8_t*>;
+///     using MyMessage = comms::Message<..., comms::option::app::ReadIterator<ReadIter> >;
+///     @endcode
+/// @tparam TIter Wrapped random access iterator.
+/// @headerfile comms/protocol/checksum/SinglePassIterator.h
+template <typename TIter>
+class SinglePassIterator
+{
+    using BaseTraits = std::iterator_traits<TIter>;
+    static_assert(std::is_same<typename BaseTraits::iterator_category, std::random_access_iterator_tag>::value,
+        "The wrapped iterator is expected to be random access one");
+
+public:
+    /// @brief Type of the wrapped iterator.
+    using BaseIterator = TIter;
+
+    /// @brief Iterator category.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// @brief Type of the value.
+    using value_type = typename BaseTraits::value_type;
+
+    /// @brief Type of the difference.
+    using difference_type = typename BaseTraits::difference_type;
+
+    /// @brief Type of the pointer.
+    using pointer = typename BaseTraits::pointer;
+
+    /// @brief Type of the reference.
+    using reference = typename BaseTraits::reference;
+
+    /// @brief Calculation context shared between all the copies of the iterator.
+    /// @details Tracks the processed data, the calculation itself is
+    ///     implemented by the derived @ref SinglePassContext.
+    class Context
+    {
+    public:
+        /// @brief Minimal number of bytes passed to the calculator at once
+        ///     (unless flushed).
+        static const std::size_t SpanLength = 512U;
+
+        /// @brief Check whether calculated value can be used as the checksum
+        ///     of the data up to the provided position.
+        /// @pre @ref flush() has been invoked.
+        bool isValid(TIter pos) const
+        {
+            COMMS_ASSERT(pos_ == end_);
+            return (!overwritten_) && (pos == end_);
+        }
+
+        /// @brief Process the bytes iterator has been advanced over.
+        /// @details The bytes are passed to the calculator when at least
+        ///     @ref SpanLength of them are pending.
+        /// @pre @b from precedes @b to
+        void consume(TIter from, TIter to)
+        {
+            COMMS_ASSERT(from < to);
+            if (!(end_ < to)) {
+                touch(from);
+                return;
+            }
+
+            if (from < pos_) {
+                touch(from);
+            }
+
+            end_ = to;
+            if (static_cast<difference_type>(SpanLength) <= (end_ - pos_)) {
+                flush();
+            }
+        }
+
+        /// @brief Inform the context that the bytes were accessed by the
+        ///     iterator which doesn't feed the calculation.
+        /// @details Only detects overwriting of the already processed bytes.
+        void touch(TIter from)
+        {
+            if (detectOverwrite_ && (from < pos_)) {
+                overwritten_ = true;
+            }
+        }
+
+        /// @brief Pass all the pending bytes to the calculator.
+        void flush()
+        {
+            if (!(pos_ < end_)) {
+                return;
+            }
+
+            update(pos_, static_cast<std::size_t>(end_ - pos_));
+            COMMS_ASSERT(pos_ == end_);
+        }
+
+    protected:
+        /// @brief Constructor
+        /// @param[in] iter Start position of the calculated data.
+        /// @param[in] detectOverwrite Report calculated value as invalid when
+        ///     the processed data gets overwritten, expected to be @b true for
+        ///     write operation.
+        Context(TIter iter, bool detectOverwrite) :
+            pos_(iter),
+            end_(iter),
+            detectOverwrite_(detectOverwrite)
+        {
+        }
+
+        /// @brief Destructor
+        ~Context() noexcept = default;
+
+        /// @brief Update the calculation with the provided bytes.
+        /// @details Expected to advance the iterator by @b len.
+        virtual void update(TIter& iter, std::size_t len) = 0;
+
+    private:
+        TIter pos_;
+        TIter end_;
+        bool detectOverwrite_ = false;
+        bool overwritten_ = false;
+    };
+
+    /// @brief Default constructor
+    SinglePassIterator() = default;
+
+    /// @brief Construct the iterator without any calculation context.
+    /// @details The constructed iterator doesn't calculate anything, just
+    ///     forwards all the operations to the wrapped iterator. Allows implicit
+    ///     conversion from the wrapped iterator (see @ref comms::readIteratorFor()
+    ///     and @ref comms::writeIteratorFor()).
+    SinglePassIterator(TIter iter) : iter_(iter) {}
+
+    /// @brief Construct the owner iterator feeding the data into the calculation context.
+    SinglePassIterator(TIter iter, Context& ctx) : iter_(iter), ctx_(&ctx), owner_(true) {}
+
+    /// @brief Construct the owner iterator feeding the data into the optional calculation context.
+    /// @details When @b ctx is @b nullptr, the constructed iterator doesn't calculate
+    ///     anything, just like the one constructed without any context.
+    SinglePassIterator(TIter iter, Context* ctx) : iter_(iter), ctx_(ctx), owner_(ctx != nullptr) {}
+
+    /// @brief Copy constructor
+    /// @details The copy shares the calculation context, but doesn't
+    ///     feed the calculation.
+    SinglePassIterator(const SinglePassIterator& other) :
+        iter_(other.iter_),
+        ctx_(other.ctx_)
+    {
+    }
+
+    /// @brief Copy assignment
+    /// @details When invoked on the owner iterator, it is equivalent to
+    ///     advancing the iterator to the new position.
+    SinglePassIterator& operator=(const SinglePassIterator& other)
+    {
+        if (owner_) {
+            COMMS_ASSERT((other.ctx_ == ctx_) || (other.ctx_ == nullptr));
+            return advance(other.iter_ - iter_);
+        }
+
+        iter_ = other.iter_;
+        ctx_ = other.ctx_;
+        return *this;
+    }
+
+    /// @brief Get the wrapped iterator.
+    TIter base() const
+    {
+        return iter_;
+    }
+
+    /// @brief Explicit conversion to the wrapped iterator.
+    explicit operator TIter() const
+    {
+        return iter_;
+    }
+
+    /// @brief Dereference operator
+    reference operator*() const
+    {
+        return *iter_;
+    }
+
+    /// @brief Member access operator
+    pointer operator->() const
+    {
+        return &(*iter_);
+    }
+
+    /// @brief Subscript operator
+    reference operator[](difference_type diff) const
+    {
+        return iter_[diff];
+    }
+
+    /// @brief Pre-increment operator
+    SinglePassIterator& operator++()
+    {
+        return advance(1);
+    }
+
+    /// @brief Post-increment operator
+    SinglePassIterator operator++(int)
+    {
+        auto copy = *this;
+        advance(1);
+        return copy;
+    }
+
+    /// @brief Pre-decrement operator
+    SinglePassIterator& operator--()
+    {
+        return advance(-1);
+    }
+
+    /// @brief Post-decrement operator
+    SinglePassIterator operator--(int)
+    {
+        auto copy = *this;
+        advance(-1);
+        return copy;
+    }
+
+    /// @brief Advance operator
+    SinglePassIterator& operator+=(difference_type diff)
+    {
+        return advance(diff);
+    }
+
+    /// @brief Step back operator
+    SinglePassIterator& operator-=(difference_type diff)
+    {
+        return advance(-diff);
+    }
+
+    /// @brief Get copy of the iterator advanced by the provided distance.
+    SinglePassIterator operator+(difference_type diff) const
+    {
+        auto copy = *this;
+        copy += diff;
+        return copy;
+    }
+
+    /// @brief Get copy of the iterator moved back by the provided distance.
+    SinglePassIterator operator-(difference_type diff) const
+    {
+        auto copy = *this;
+        copy -= diff;
+        return copy;
+    }
+
+    /// @brief Distance between iterators
+    difference_type operator-(const SinglePassIterator& other) const
+    {
+        return iter_ - other.iter_;
+    }
+
+    /// @brief Equality comparison
+    bool operator==(const SinglePassIterator& other) const
+    {
+        return iter_ == other.iter_;
+    }
+
+    /// @brief Inequality comparison
+    bool operator!=(const SinglePassIterator& other) const
+    {
+        return iter_ != other.iter_;
+    }
+
+    /// @brief Less than comparison
+    bool operator<(const SinglePassIterator& other) const
+    {
+        return iter_ < other.iter_;
+    }
+
+    /// @brief Greater than comparison
+    bool operator>(const SinglePassIterator& other) const
+    {
+        return iter_ > other.iter_;
+    }
+
+    /// @brief Less than or equal comparison
+    bool operator<=(const SinglePassIterator& other) const
+    {
+        return iter_ <= other.iter_;
+    }
+
+    /// @brief Greater than or equal comparison
+    bool operator>=(const SinglePassIterator& other) const
+    {
+        return iter_ >= other.iter_;
+    }
+
+private:
+    SinglePassIterator& advance(difference_type diff)
+    {
+        auto from = iter_;
+        iter_ += diff;
+        if ((ctx_ == nullptr) || (diff <= 0)) {
+            return *this;
+        }
+
+        if (owner_) {
+            ctx_->consume(from, iter_);
+        }
+        else {
+            ctx_->touch(from);
+        }
+        return *this;
+    }
+
+    TIter iter_ = TIter();
+    Context* ctx_ = nullptr;
+    bool owner_ = false;
+};
+
+/// @brief Get copy of the iterator advanced by the provided distance.
+/// @related SinglePassIterator
+template <typename TIter>
+SinglePassIterator<TIter> operator+(
+    typename SinglePassIterator<TIter>::difference_type diff,
+    const SinglePassIterator<TIter>& iter)
+{
+    return iter + diff;
+}
+
+/// @brief Checksum calculation context of the @ref SinglePassIterator.
+/// @tparam TIter Wrapped random access iterator.
+/// @tparam TCalc Checksum calculator, must provide incremental calculation
+///     interface in addition to the @b operator():
+///     @code
+///     using State = ...;
+///     State init() const;
+///     template <typename TIter> void update(State& state, TIter& iter, std::size_t len) const;
+///     ResultType finalize(State state) const;
+///     @endcode
+///     All the checksum calculators in the @ref comms::protocol::checksum namespace
+///     provide such interface.
+/// @headerfile comms/protocol/checksum/SinglePassIterator.h
+template <typename TIter, typename TCalc>
+class SinglePassContext : public SinglePassIterator<TIter>::Context
+{
+    using Base = typename SinglePassIterator<TIter>::Context;
+
+public:
+    /// @brief Type of the checksum calculation state.
+    using State = typename std::decay<decltype(TCalc().init())>::type;
+
+    /// @brief Constructor
+    /// @param[in] iter Start position of the calculated data.
+    /// @param[in] detectOverwrite Report calculated value as invalid when
+    ///     the processed data gets overwritten, expected to be @b true for
+    ///     write operation.
+    SinglePassContext(TIter iter, bool detectOverwrite) :
+        Base(iter, detectOverwrite),
+        state_(TCalc().init())
+    {
+    }
+
+    /// @brief Get the calculated checksum value.
+    /// @pre @ref Base::flush() "flush()" has been invoked.
+    auto getValue() const -> decltype(TCalc().finalize(TCalc().init()))
+    {
+        return TCalc().finalize(state_);
+    }
+
+protected:
+    virtual void update(TIter& iter, std::size_t len) override
+    {
+        TCalc().update(state_, iter, len);
+    }
+
+private:
+    State state_;
+};
+
+namespace details
+{
+
+template <typename TIter>
+struct SinglePassIteratorHelper
+{
+    using Type = SinglePassIterator<TIter>;
+    using BaseIterator = TIter;
+
+    static BaseIterator base(TIter iter)
+    {
+        return iter;
+    }
+};
+
+template <typename TIter>
+struct SinglePassIteratorHelper<SinglePassIterator<TIter> >
+{
+    using Type = SinglePassIterator<TIter>;
+    using BaseIterator = TIter;
+
+    static BaseIterator base(const Type& iter)
+    {
+        return iter.base();
+    }
+};
+
+} // namespace details
+
+/// @brief Type of the @ref SinglePassIterator wrapping the provided iterator type.
+/// @details If the provided iterator is already @ref SinglePassIterator,
+///     it is reused as-is.
+/// @related SinglePassIterator
+template <typename TIter>
+using SinglePassIteratorFor = typename details::SinglePassIteratorHelper<TIter>::Type;
+
+}  // namespace checksum
+
+}  // namespace protocol
+
+}  // namespace comms
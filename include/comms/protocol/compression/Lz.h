@@ -0,0 +1,281 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::compression::Lz
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace compression
+{
+
+/// @brief Fast dependency-free compression codec of the LZ77 family.
+/// @details The compressed data is a sequence of blocks, each block has the following format:
+///     @li Token byte. The high nibble is a number of the literal bytes (@b L),
+///         the low nibble is a length of the match minus 4 (@b M).
+///     @li Extension bytes of the literal count, present only when @b L is 15.
+///         Every byte is added to the count, the extension ends with the byte which is not 255.
+///     @li @b L literal bytes.
+///     @li Two bytes (little endian) backward offset of the match in the
+///         decompressed data. The last block ends after the literal bytes, i.e.
+///         doesn't have the offset and match.
+///     @li Extension bytes of the match length, present only when @b M is 15.
+///
+///     The compression uses a hash table of the recently seen 4 byte sequences
+///     located on the stack, no dynamic memory allocation is performed.
+/// @tparam THashBits Number of bits in the hash value, defines the size
+///     of the hash table (<b>4 * 2^THashBits</b> bytes).
+/// @headerfile comms/protocol/compression/Lz.h
+template <unsigned THashBits = 10U>
+class Lz
+{
+    static_assert((8U <= THashBits) && (THashBits <= 16U), "Unexpected number of hash bits");
+
+public:
+    /// @brief Compress data.
+    /// @param[in] src Data to compress.
+    /// @param[in] srcLen Number of bytes to compress.
+    /// @param[out] dst Output buffer.
+    /// @param[in] dstLen Capacity of the output buffer.
+    /// @return Number of bytes written to the output buffer, @b 0 in case the
+    ///     compressed data doesn't fit.
+    std::size_t compress(const std::uint8_t* src, std::size_t srcLen, std::uint8_t* dst, std::size_t dstLen) const
+    {
+        std::uint32_t table[HashSize];
+        std::fill_n(&table[0], HashSize, std::uint32_t(0U));
+
+        std::size_t dstPos = 0U;
+        std::size_t anchor = 0U;
+        std::size_t pos = 0U;
+        while ((pos + MinMatch) <= srcLen) {
+            auto seq = readSeq(src + pos);
+            auto& entry = table[hash(seq)];
+            auto candidate = static_cast<std::size_t>(entry);
+            entry = static_cast<std::uint32_t>(pos + 1U);
+
+            if ((candidate == 0U) ||
+                (MaxOffset < (pos - (candidate - 1U))) ||
+                (readSeq(src + (candidate - 1U)) != seq)) {
+                ++pos;
+                continue;
+            }
+
+            --candidate;
+            std::size_t matchLen = MinMatch;
+            while (((pos + matchLen) < srcLen) && (src[candidate + matchLen] == src[pos + matchLen])) {
+                ++matchLen;
+            }
+
+            if (!putBlock(dst, dstLen, dstPos, src + anchor, pos - anchor, pos - candidate, matchLen)) {
+                return 0U;
+            }
+
+            pos += matchLen;
+            anchor = pos;
+        }
+
+        if (!putBlock(dst, dstLen, dstPos, src + anchor, srcLen - anchor, 0U, 0U)) {
+            return 0U;
+        }
+
+        return dstPos;
+    }
+
+    /// @brief Decompress data.
+    /// @param[in, out] iter Input iterator.
+    /// @param[in] srcLen Number of compressed bytes.
+    /// @param[out] dst Output buffer.
+    /// @param[in] dstLen Expected number of decompressed bytes.
+    /// @return @b true in case all the @b srcLen bytes have been successfully
+    ///     decompressed into exactly @b dstLen bytes.
+    /// @post The iterator is advanced by number of bytes read.
+    template <typename TIter>
+    bool decompress(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t dstLen) const
+    {
+        std::size_t dstPos = 0U;
+        while (0U < srcLen) {
+            auto token = static_cast<std::uint8_t>(*iter);
+            ++iter;
+            --srcLen;
+
+            std::size_t litLen = static_cast<std::size_t>(token >> 4U);
+            if (!getLength(iter, srcLen, litLen) ||
+                (srcLen < litLen) ||
+                ((dstLen - dstPos) < litLen)) {
+                return false;
+            }
+
+            for (std::size_t idx = 0U; idx < litLen; ++idx) {
+                dst[dstPos] = static_cast<std::uint8_t>(*iter);
+                ++dstPos;
+                ++iter;
+            }
+            srcLen -= litLen;
+
+            if (srcLen == 0U) {
+                break;
+            }
+
+            if (srcLen < OffsetLen) {
+                return false;
+            }
+
+            std::size_t offset = static_cast<std::uint8_t>(*iter);
+            ++iter;
+            offset |= static_cast<std::size_t>(static_cast<std::uint8_t>(*iter)) << 8U;
+            ++iter;
+            srcLen -= OffsetLen;
+
+            std::size_t matchLen = static_cast<std::size_t>(token & 0xfU);
+            if (!getLength(iter, srcLen, matchLen)) {
+                return false;
+            }
+
+            matchLen += MinMatch;
+            if ((offset == 0U) || (dstPos < offset) || ((dstLen - dstPos) < matchLen)) {
+                return false;
+            }
+
+            // Byte by byte copy, the match may overlap the output
+            for (std::size_t idx = 0U; idx < matchLen; ++idx) {
+                dst[dstPos] = dst[dstPos - offset];
+                ++dstPos;
+            }
+        }
+
+        return dstPos == dstLen;
+    }
+
+private:
+    static const std::size_t HashSize = static_cast<std::size_t>(1U) << THashBits;
+    static const std::size_t MinMatch = 4U;
+    static const std::size_t MaxOffset = 0xffff;
+    static const std::size_t OffsetLen = 2U;
+    static const std::size_t NibbleMax = 0xf;
+    static const std::size_t ExtByteMax = 0xff;
+
+    static std::uint32_t readSeq(const std::uint8_t* src)
+    {
+        return
+            static_cast<std::uint32_t>(src[0]) |
+            (static_cast<std::uint32_t>(src[1]) << 8U) |
+            (static_cast<std::uint32_t>(src[2]) << 16U) |
+            (static_cast<std::uint32_t>(src[3]) << 24U);
+    }
+
+    static std::size_t hash(std::uint32_t seq)
+    {
+        return static_cast<std::size_t>((seq * 2654435761U) >> (32U - THashBits));
+    }
+
+    static std::uint8_t nibble(std::size_t len)
+    {
+        return static_cast<std::uint8_t>((len < NibbleMax) ? len : static_cast<std::size_t>(NibbleMax));
+    }
+
+    static bool putLength(std::uint8_t* dst, std::size_t dstLen, std::size_t& dstPos, std::size_t len)
+    {
+        if (len < NibbleMax) {
+            return true;
+        }
+
+        len -= NibbleMax;
+        while (true) {
+            if (dstLen <= dstPos) {
+                return false;
+            }
+
+            auto byte = (len < ExtByteMax) ? len : static_cast<std::size_t>(ExtByteMax);
+            dst[dstPos] = static_cast<std::uint8_t>(byte);
+            ++dstPos;
+            if (byte < ExtByteMax) {
+                return true;
+            }
+
+            len -= byte;
+        }
+    }
+
+    static bool putBlock(
+        std::uint8_t* dst,
+        std::size_t dstLen,
+        std::size_t& dstPos,
+        const std::uint8_t* lit,
+        std::size_t litLen,
+        std::size_t offset,
+        std::size_t matchLen)
+    {
+        if (dstLen <= dstPos) {
+            return false;
+        }
+
+        auto& token = dst[dstPos];
+        ++dstPos;
+        token = static_cast<std::uint8_t>(nibble(litLen) << 4U);
+        if ((!putLength(dst, dstLen, dstPos, litLen)) ||
+            ((dstLen - dstPos) < litLen)) {
+            return false;
+        }
+
+        std::copy_n(lit, litLen, dst + dstPos);
+        dstPos += litLen;
+
+        if (matchLen == 0U) {
+            return true;
+        }
+
+        if ((dstLen - dstPos) < OffsetLen) {
+            return false;
+        }
+
+        dst[dstPos] = static_cast<std::uint8_t>(offset);
+        dst[dstPos + 1U] = static_cast<std::uint8_t>(offset >> 8U);
+        dstPos += OffsetLen;
+
+        matchLen -= MinMatch;
+        token = static_cast<std::uint8_t>(token | nibble(matchLen));
+        return putLength(dst, dstLen, dstPos, matchLen);
+    }
+
+    template <typename TIter>
+    static bool getLength(TIter& iter, std::size_t& srcLen, std::size_t& len)
+    {
+        if (len < NibbleMax) {
+            return true;
+        }
+
+        while (true) {
+            if (srcLen == 0U) {
+                return false;
+            }
+
+            auto byte = static_cast<std::size_t>(static_cast<std::uint8_t>(*iter));
+            ++iter;
+            --srcLen;
+            len += byte;
+            if (byte < ExtByteMax) {
+                return true;
+            }
+        }
+    }
+};
+
+}  // namespace compression
+
+}  // namespace protocol
+
+}  // namespace comms
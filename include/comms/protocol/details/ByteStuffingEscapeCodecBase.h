@@ -0,0 +1,173 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "comms/protocol/details/ByteStuffingHelpers.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+// Common implementation of the codecs replacing the frame delimiter and
+// the escape byte with the two byte escape sequences.
+template <typename TDerived, std::uint8_t TDelim, std::uint8_t TEsc, std::uint8_t TEscDelim, std::uint8_t TEscEsc, bool TLeadingDelim>
+class ByteStuffingEscapeCodecBase
+{
+public:
+    static const std::uint8_t Delimiter = TDelim;
+
+    static constexpr std::size_t maxEncodedLength(std::size_t len)
+    {
+        return (TLeadingDelim ? 1U : 0U) + (len * 2U);
+    }
+
+    std::size_t encodedLength(const std::uint8_t* src, std::size_t srcLen) const
+    {
+        std::size_t result = (TLeadingDelim ? 1U : 0U) + srcLen;
+        auto* end = src + srcLen;
+        ByteStuffingAnyOfFinder finder(src, end, TDelim, TEsc);
+        while (true) {
+            src = finder.find(src);
+            if (src == end) {
+                break;
+            }
+
+            ++result;
+            ++src;
+        }
+
+        return result;
+    }
+
+    template <typename TIter>
+    void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const
+    {
+        if (TLeadingDelim) {
+            *iter = TDelim;
+            ++iter;
+        }
+
+        auto* end = src + srcLen;
+        ByteStuffingAnyOfFinder finder(src, end, TDelim, TEsc);
+        while (true) {
+            auto* special = finder.find(src);
+            iter = std::copy(src, special, iter);
+            if (special == end) {
+                break;
+            }
+
+            *iter = TEsc;
+            ++iter;
+            *iter = (*special == TDelim) ? TEscDelim : TEscEsc;
+            ++iter;
+            src = special + 1;
+        }
+    }
+
+    template <typename TIter>
+    bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const
+    {
+        return decodeInternal(iter, srcLen, dst, dstLen, ByteStuffingIterTag<TIter>());
+    }
+
+protected:
+    static bool unescape(std::uint8_t byte, std::uint8_t& result)
+    {
+        if (byte == TEscDelim) {
+            result = TDelim;
+            return true;
+        }
+
+        if (byte == TEscEsc) {
+            result = TEsc;
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    template <typename TIter, typename... TParams>
+    static bool decodeInternal(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen, ByteStuffingRawPtrTag<TParams...>)
+    {
+        auto* src = iter;
+        auto* end = src + srcLen;
+        auto* dstBeg = dst;
+        while (true) {
+            auto* esc = byteStuffingFind(src, end, TEsc);
+            auto runLen = static_cast<std::size_t>(esc - src);
+            std::copy_n(src, runLen, dst);
+            dst += runLen;
+            if (esc == end) {
+                break;
+            }
+
+            src = esc + 1;
+            if ((src == end) || (!TDerived::unescape(*src, *dst))) {
+                return false;
+            }
+
+            ++dst;
+            ++src;
+        }
+
+        iter = end;
+        dstLen = static_cast<std::size_t>(dst - dstBeg);
+        return true;
+    }
+
+    template <typename TIter, typename... TParams>
+    static bool decodeInternal(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen, ByteStuffingGenericIterTag<TParams...>)
+    {
+        dstLen = 0U;
+        while (0U < srcLen) {
+            auto byte = static_cast<std::uint8_t>(*iter);
+            ++iter;
+            --srcLen;
+
+            if (byte != TEsc) {
+                dst[dstLen] = byte;
+                ++dstLen;
+                continue;
+            }
+
+            if (srcLen == 0U) {
+                return false;
+            }
+
+            byte = static_cast<std::uint8_t>(*iter);
+            ++iter;
+            --srcLen;
+            if (!TDerived::unescape(byte, dst[dstLen])) {
+                return false;
+            }
+
+            ++dstLen;
+        }
+
+        return true;
+    }
+};
+
+template <typename TDerived, std::uint8_t TDelim, std::uint8_t TEsc, std::uint8_t TEscDelim, std::uint8_t TEscEsc, bool TLeadingDelim>
+const std::uint8_t ByteStuffingEscapeCodecBase<TDerived, TDelim, TEsc, TEscDelim, TEscEsc, TLeadingDelim>::Delimiter;
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
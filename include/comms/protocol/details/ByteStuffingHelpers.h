@@ -0,0 +1,122 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/details/tag.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename TIter>
+constexpr bool byteStuffingIsRawPtr()
+{
+    return
+        std::is_pointer<TIter>::value &&
+        std::is_same<typename std::decay<decltype(*std::declval<TIter>())>::type, std::uint8_t>::value;
+}
+
+template <typename...>
+struct ByteStuffingIterTagHelper
+{
+    template <typename... TParams>
+    using RawPtrTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using GenericIterTag = comms::details::tag::Tag2<>;
+
+    template <typename TIter>
+    using Type =
+        typename comms::util::LazyShallowConditional<
+            byteStuffingIsRawPtr<typename std::decay<TIter>::type>()
+        >::template Type<
+            RawPtrTag,
+            GenericIterTag
+        >;
+};
+
+template <typename TIter>
+using ByteStuffingIterTag = typename ByteStuffingIterTagHelper<>::template Type<TIter>;
+
+template <typename... TParams>
+using ByteStuffingRawPtrTag = typename ByteStuffingIterTagHelper<>::template RawPtrTag<TParams...>;
+
+template <typename... TParams>
+using ByteStuffingGenericIterTag = typename ByteStuffingIterTagHelper<>::template GenericIterTag<TParams...>;
+
+// Returns "to" if not found, uses memchr(), which is vectorised by the
+// standard library implementations.
+inline const std::uint8_t* byteStuffingFind(const std::uint8_t* from, const std::uint8_t* to, std::uint8_t value)
+{
+    if (from == to) {
+        return to;
+    }
+
+    auto* found = std::memchr(from, value, static_cast<std::size_t>(to - from));
+    if (found == nullptr) {
+        return to;
+    }
+
+    return static_cast<const std::uint8_t*>(found);
+}
+
+// Finds the occurrences of any of the two special values. Keeps the next
+// position of each value, so every byte is scanned by memchr() at most
+// once per value even when the special values are frequent.
+class ByteStuffingAnyOfFinder
+{
+public:
+    ByteStuffingAnyOfFinder(const std::uint8_t* from, const std::uint8_t* to, std::uint8_t first, std::uint8_t second) :
+        to_(to),
+        nextFirst_(byteStuffingFind(from, to, first)),
+        nextSecond_(byteStuffingFind(from, to, second)),
+        first_(first),
+        second_(second)
+    {
+    }
+
+    // Returns "to" if none found
+    const std::uint8_t* find(const std::uint8_t* from)
+    {
+        if (nextFirst_ < from) {
+            nextFirst_ = byteStuffingFind(from, to_, first_);
+        }
+
+        if (nextSecond_ < from) {
+            nextSecond_ = byteStuffingFind(from, to_, second_);
+        }
+
+        return std::min(nextFirst_, nextSecond_);
+    }
+
+private:
+    const std::uint8_t* to_ = nullptr;
+    const std::uint8_t* nextFirst_ = nullptr;
+    const std::uint8_t* nextSecond_ = nullptr;
+    std::uint8_t first_ = 0U;
+    std::uint8_t second_ = 0U;
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
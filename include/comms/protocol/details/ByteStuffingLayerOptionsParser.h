@@ -0,0 +1,77 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "comms/options.h"
+#include "comms/util/StaticVector.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename... TOptions>
+class ByteStuffingLayerOptionsParser;
+
+template <>
+class ByteStuffingLayerOptionsParser<>
+{
+public:
+    static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasFixedSizeStorage = false;
+
+    using ExtendingClass = void;
+    using ScratchBuffer = std::vector<std::uint8_t>;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class ByteStuffingLayerOptionsParser<comms::option::app::FixedSizeStorage<TSize>, TOptions...> :
+        public ByteStuffingLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasFixedSizeStorage = true;
+    using ScratchBuffer = comms::util::StaticVector<std::uint8_t, TSize>;
+};
+
+template <typename T, typename... TOptions>
+class ByteStuffingLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public ByteStuffingLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <typename... TOptions>
+class ByteStuffingLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public ByteStuffingLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class ByteStuffingLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public ByteStuffingLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
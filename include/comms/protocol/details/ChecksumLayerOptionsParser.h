@@ -27,6 +27,7 @@ class ChecksumLayerOptionsParser<>
 {
 public:
     static constexpr bool HasVerifyBeforeRead = false;
+    static constexpr bool HasSinglePass = false;
     static constexpr bool HasExtendingClass = false;
 
     using ExtendingClass = void;
@@ -50,6 +51,14 @@ public:
     using SuppressForVerifyBeforeRead = comms::option::app::EmptyOption;    
 };
 
+template <typename... TOptions>
+class ChecksumLayerOptionsParser<comms::option::def::ChecksumLayerSinglePass, TOptions...> :
+        public ChecksumLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasSinglePass = true;
+};
+
 template <typename T, typename... TOptions>
 class ChecksumLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
         public ChecksumLayerOptionsParser<TOptions...>
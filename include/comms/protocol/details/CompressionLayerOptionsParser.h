@@ -0,0 +1,97 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "comms/options.h"
+#include "comms/util/StaticVector.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename... TOptions>
+class CompressionLayerOptionsParser;
+
+template <>
+class CompressionLayerOptionsParser<>
+{
+public:
+    static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasFixedSizeStorage = false;
+    static constexpr bool HasMaxSize = false;
+    static constexpr std::size_t MinSize = 32U;
+    static constexpr std::size_t MaxSize = 0U;
+
+    using ExtendingClass = void;
+    using ScratchBuffer = std::vector<std::uint8_t>;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::app::CompressionLayerMinSize<TSize>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr std::size_t MinSize = TSize;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::app::CompressionLayerMaxSize<TSize>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasMaxSize = true;
+    static constexpr std::size_t MaxSize = TSize;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::app::FixedSizeStorage<TSize>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasFixedSizeStorage = true;
+    using ScratchBuffer = comms::util::StaticVector<std::uint8_t, TSize>;
+};
+
+template <typename T, typename... TOptions>
+class CompressionLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public CompressionLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <typename... TOptions>
+class CompressionLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public CompressionLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class CompressionLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public CompressionLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,98 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "comms/options.h"
+#include "comms/util/StaticVector.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename... TOptions>
+class FragmentationLayerOptionsParser;
+
+template <>
+class FragmentationLayerOptionsParser<>
+{
+public:
+    static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasFixedSizeStorage = false;
+    static constexpr bool HasMaxSize = false;
+    static constexpr std::size_t MaxInFlight = 1U;
+    static constexpr std::size_t MaxSize = 0U;
+
+    using ExtendingClass = void;
+    using ScratchBuffer = std::vector<std::uint8_t>;
+};
+
+template <std::size_t TCount, typename... TOptions>
+class FragmentationLayerOptionsParser<comms::option::app::FragmentationLayerMaxInFlight<TCount>, TOptions...> :
+        public FragmentationLayerOptionsParser<TOptions...>
+{
+    static_assert(0U < TCount, "Number of in-flight reassemblies must be greater than 0");
+public:
+    static constexpr std::size_t MaxInFlight = TCount;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class FragmentationLayerOptionsParser<comms::option::app::FragmentationLayerMaxSize<TSize>, TOptions...> :
+        public FragmentationLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasMaxSize = true;
+    static constexpr std::size_t MaxSize = TSize;
+};
+
+template <std::size_t TSize, typename... TOptions>
+class FragmentationLayerOptionsParser<comms::option::app::FixedSizeStorage<TSize>, TOptions...> :
+        public FragmentationLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasFixedSizeStorage = true;
+    using ScratchBuffer = comms::util::StaticVector<std::uint8_t, TSize>;
+};
+
+template <typename T, typename... TOptions>
+class FragmentationLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public FragmentationLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <typename... TOptions>
+class FragmentationLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public FragmentationLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class FragmentationLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public FragmentationLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
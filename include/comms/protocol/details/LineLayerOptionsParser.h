@@ -0,0 +1,71 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <tuple>
+
+#include "comms/options.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename... TOptions>
+class LineLayerOptionsParser;
+
+template <>
+class LineLayerOptionsParser<>
+{
+public:
+    static constexpr bool HasExtendingClass = false;
+    static constexpr bool HasCrLf = false;
+
+    using ExtendingClass = void;
+};
+
+template <typename... TOptions>
+class LineLayerOptionsParser<comms::option::app::LineLayerCrLf, TOptions...> :
+        public LineLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasCrLf = true;
+};
+
+template <typename T, typename... TOptions>
+class LineLayerOptionsParser<comms::option::def::ExtendingClass<T>, TOptions...> :
+        public LineLayerOptionsParser<TOptions...>
+{
+public:
+    static constexpr bool HasExtendingClass = true;
+    using ExtendingClass = T;
+};
+
+template <typename... TOptions>
+class LineLayerOptionsParser<
+    comms::option::app::EmptyOption,
+    TOptions...> : public LineLayerOptionsParser<TOptions...>
+{
+};
+
+template <typename... TBundledOptions, typename... TOptions>
+class LineLayerOptionsParser<
+    std::tuple<TBundledOptions...>,
+    TOptions...> : public LineLayerOptionsParser<TBundledOptions..., TOptions...>
+{
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
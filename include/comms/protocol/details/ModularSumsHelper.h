@@ -0,0 +1,148 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "comms/details/tag.h"
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename TIter>
+constexpr bool modularSumsIsRawPtr()
+{
+    return
+        std::is_pointer<TIter>::value &&
+        std::is_integral<typename std::decay<decltype(*std::declval<TIter>())>::type>::value &&
+        (sizeof(typename std::decay<decltype(*std::declval<TIter>())>::type) == 1U);
+}
+
+// Running sums of the Fletcher / Adler family of checksums, where
+// sum1 accumulates the values and sum2 accumulates sum1. The values are
+// either bytes (TValueSize == 1) or little endian 16 bit words (TValueSize == 2).
+// The modulo reduction is performed once per TBlock values, the block
+// length must guarantee no overflow of 32 bit sums starting below TMod.
+// For the contiguous input the values are processed in chunks, where
+// the contribution of the chunk to sum2 is calculated independently of
+// sum1, which allows vectorisation of the loop by the compiler.
+template <std::uint32_t TMod, std::size_t TBlock, std::size_t TValueSize>
+class ModularSumsHelper
+{
+    static_assert((TValueSize == 1U) || (TValueSize == 2U), "Unsupported value size");
+
+public:
+    template <typename TIter>
+    static void update(std::uint32_t& sum1, std::uint32_t& sum2, TIter& iter, std::size_t count)
+    {
+        while (0U < count) {
+            auto blockCount = std::min(count, TBlock);
+            updateBlock(sum1, sum2, iter, blockCount, IterTag<TIter>());
+            sum1 %= TMod;
+            sum2 %= TMod;
+            count -= blockCount;
+        }
+    }
+
+private:
+    template <typename... TParams>
+    using RawPtrTag = comms::details::tag::Tag1<>;
+
+    template <typename... TParams>
+    using GenericIterTag = comms::details::tag::Tag2<>;
+
+    template <typename TIter>
+    using IterTag =
+        typename comms::util::LazyShallowConditional<
+            modularSumsIsRawPtr<typename std::decay<TIter>::type>()
+        >::template Type<
+            RawPtrTag,
+            GenericIterTag
+        >;
+
+    static const std::size_t ChunkCount = (TValueSize == 1U) ? 64U : 8U;
+
+    static std::uint32_t valueAt(const std::uint8_t* ptr)
+    {
+        return (TValueSize == 1U) ?
+            static_cast<std::uint32_t>(ptr[0]) :
+            static_cast<std::uint32_t>(ptr[0] | (static_cast<std::uint32_t>(ptr[1]) << 8U));
+    }
+
+    // The products of the bytes and the weights fit 16 bits, which allows
+    // the vectorised loop to use 16 bit multiplication, available on
+    // all the vector units (unlike the 32 bit one).
+    static std::uint32_t weighted(std::uint32_t value, std::size_t weight)
+    {
+        return (TValueSize == 1U) ?
+            static_cast<std::uint32_t>(static_cast<std::uint16_t>(static_cast<std::uint16_t>(value) * static_cast<std::uint16_t>(weight))) :
+            value * static_cast<std::uint32_t>(weight);
+    }
+
+    template <typename TIter, typename... TParams>
+    static void updateBlock(std::uint32_t& sum1, std::uint32_t& sum2, TIter& iter, std::size_t count, RawPtrTag<TParams...>)
+    {
+        auto* ptr = reinterpret_cast<const std::uint8_t*>(iter);
+        auto* end = ptr + (count * TValueSize);
+        while ((ChunkCount * TValueSize) <= static_cast<std::size_t>(end - ptr)) {
+            std::uint32_t chunkSum = 0U;
+            std::uint32_t chunkWeighted = 0U;
+            for (std::size_t idx = 0U; idx < ChunkCount; ++idx) {
+                auto value = valueAt(ptr + (idx * TValueSize));
+                chunkSum += value;
+                chunkWeighted += weighted(value, ChunkCount - idx);
+            }
+
+            sum2 += (static_cast<std::uint32_t>(ChunkCount) * sum1) + chunkWeighted;
+            sum1 += chunkSum;
+            ptr += ChunkCount * TValueSize;
+        }
+
+        for (; ptr != end; ptr += TValueSize) {
+            sum1 += valueAt(ptr);
+            sum2 += sum1;
+        }
+
+        iter += count * TValueSize;
+    }
+
+    template <typename TIter, typename... TParams>
+    static void updateBlock(std::uint32_t& sum1, std::uint32_t& sum2, TIter& iter, std::size_t count, GenericIterTag<TParams...>)
+    {
+        using ByteType = typename std::make_unsigned<
+            typename std::decay<decltype(*iter)>::type
+        >::type;
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            std::uint32_t value = 0U;
+            for (std::size_t byteIdx = 0U; byteIdx < TValueSize; ++byteIdx) {
+                value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(static_cast<ByteType>(*iter))) << (byteIdx * 8U);
+                ++iter;
+            }
+
+            sum1 += value;
+            sum2 += sum1;
+        }
+    }
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
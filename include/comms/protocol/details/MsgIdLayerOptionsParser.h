@@ -31,6 +31,7 @@ class MsgIdLayerOptionsParser<>
 public:
     static const bool HasExtendingClass = false;
     static const bool HasMsgFactory = false;
+    static const bool HasRecycleMessages = false;
 
     using ExtendingClass = void;
     using FactoryOptions = std::tuple<>;
@@ -79,6 +80,14 @@ public:
 };
 
 
+template <typename... TOptions>
+class MsgIdLayerOptionsParser<comms::option::app::MsgIdLayerRecycleMessages, TOptions...> :
+        public MsgIdLayerOptionsParser<TOptions...>
+{
+public:
+    static const bool HasRecycleMessages = true;
+};
+
 template <typename... TOptions>
 class MsgIdLayerOptionsParser<
     comms::option::app::EmptyOption,
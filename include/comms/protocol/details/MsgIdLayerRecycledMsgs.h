@@ -0,0 +1,142 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+template <typename TMsgPtr, typename TId, std::size_t TSize>
+class MsgIdLayerRecycledMsgs
+{
+    static_assert(0U < TSize, "The number of slots must be greater than 0");
+
+public:
+    TMsgPtr take(TId id, unsigned idx)
+    {
+        auto* slot = findSlot(id, idx);
+        if (slot == nullptr) {
+            return TMsgPtr();
+        }
+
+        return std::move(slot->msg_);
+    }
+
+    void put(TId id, unsigned idx, TMsgPtr&& msg)
+    {
+        auto* slot = acquireSlot(id, idx);
+        if (slot == nullptr) {
+            msg.reset();
+            return;
+        }
+
+        slot->msg_ = std::move(msg);
+        slot->issued_ = nullptr;
+    }
+
+    void markIssued(TId id, unsigned idx, const void* msg)
+    {
+        // The object issued earlier may have been destructed by the caller
+        // and its memory reused for the new one of a different type.
+        for (auto i = 0U; i < count_; ++i) {
+            if (slots_[i].issued_ == msg) {
+                slots_[i].issued_ = nullptr;
+            }
+        }
+
+        auto* slot = acquireSlot(id, idx);
+        if (slot != nullptr) {
+            slot->issued_ = msg;
+        }
+    }
+
+    void recycle(TMsgPtr&& msg)
+    {
+        if (!msg) {
+            return;
+        }
+
+        for (auto i = 0U; i < count_; ++i) {
+            auto& slot = slots_[i];
+            if (slot.issued_ != msg.get()) {
+                continue;
+            }
+
+            slot.issued_ = nullptr;
+            if (!slot.msg_) {
+                slot.msg_ = std::move(msg);
+                return;
+            }
+
+            break;
+        }
+
+        // Not produced by the layer or superseded by the newer object of the same type
+        msg.reset();
+    }
+
+    void clear()
+    {
+        for (auto i = 0U; i < count_; ++i) {
+            slots_[i].msg_.reset();
+            slots_[i].issued_ = nullptr;
+        }
+    }
+
+private:
+    struct Slot
+    {
+        TId id_ = TId();
+        unsigned idx_ = 0U;
+        TMsgPtr msg_;
+        const void* issued_ = nullptr;
+    };
+
+    Slot* findSlot(TId id, unsigned idx)
+    {
+        for (auto i = 0U; i < count_; ++i) {
+            auto& slot = slots_[i];
+            if ((slot.id_ == id) && (slot.idx_ == idx)) {
+                return &slot;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Slot* acquireSlot(TId id, unsigned idx)
+    {
+        auto* slot = findSlot(id, idx);
+        if ((slot != nullptr) || (TSize <= count_)) {
+            return slot;
+        }
+
+        slot = &slots_[count_];
+        slot->id_ = id;
+        slot->idx_ = idx;
+        ++count_;
+        return slot;
+    }
+
+    Slot slots_[TSize];
+    std::size_t count_ = 0U;
+};
+
+} // namespace details
+
+} // namespace protocol
+
+} // namespace comms
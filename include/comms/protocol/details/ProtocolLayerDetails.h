@@ -7,7 +7,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
 #include "comms/details/detect.h"
+#include "comms/util/Tuple.h"
 
 namespace comms
 {
@@ -224,6 +231,80 @@ constexpr bool isMsgPayloadRetriever()
     return IsMsgPayloadRetrieverHelper<T>::Value;
 }
 
+constexpr std::size_t protocolLayerNoMaxFrameLength()
+{
+    return std::numeric_limits<std::size_t>::max();
+}
+
+constexpr std::size_t protocolLayerMaxFrameLengthSum(std::size_t first, std::size_t second)
+{
+    return 
+        ((protocolLayerNoMaxFrameLength() - first) < second) ? 
+            protocolLayerNoMaxFrameLength() : 
+            (first + second);
+}
+
+// Maximal value of the field, which still fits into its serialisation length.
+template <typename TField, bool TIntegral = std::is_integral<typename TField::ValueType>::value>
+struct ProtocolLayerFieldMaxValueHelper
+{
+    static const std::size_t Value = std::numeric_limits<std::size_t>::max();
+};
+
+template <typename TField>
+struct ProtocolLayerFieldMaxValueHelper<TField, true>
+{
+    using ValueType = typename TField::ValueType;
+    static const std::size_t MaxSize = std::numeric_limits<std::size_t>::max();
+
+    // Fixed length fields use all the bits of every byte, the variable
+    // length ones use 7 bits of every byte (base-128 encoding).
+    static const std::size_t SerBits =
+        TField::maxLength() * ((TField::minLength() == TField::maxLength()) ? 8U : 7U);
+
+    static const std::size_t SerMax =
+        (std::numeric_limits<std::size_t>::digits <= SerBits) ? MaxSize : ((std::size_t(1U) << SerBits) - 1U);
+
+    static const std::size_t TypeMax =
+        (static_cast<std::uintmax_t>(MaxSize) < static_cast<std::uintmax_t>(std::numeric_limits<ValueType>::max())) ?
+            MaxSize : static_cast<std::size_t>(std::numeric_limits<ValueType>::max());
+
+    static const std::size_t Value = (SerMax < TypeMax) ? SerMax : TypeMax;
+};
+
+template <typename...>
+struct ProtocolLayerMsgMaxLengthCalcHelper
+{
+    template <typename TMsg>
+    constexpr std::size_t operator()(std::size_t soFar) const
+    {
+        return 
+            (!TMsg::doFieldsHaveStrictMaxLength()) ? protocolLayerNoMaxFrameLength() :
+            (soFar < TMsg::doMaxLength()) ? TMsg::doMaxLength() :
+            soFar;
+    }
+};
+
+template <typename TMessages>
+struct ProtocolLayerMsgMaxLengthHelper
+{
+    static constexpr std::size_t value()
+    {
+        return protocolLayerNoMaxFrameLength();
+    }
+};
+
+template <typename... TMessages>
+struct ProtocolLayerMsgMaxLengthHelper<std::tuple<TMessages...> >
+{
+    static constexpr std::size_t value()
+    {
+        return 
+            comms::util::tupleTypeAccumulate<std::tuple<TMessages...> >(
+                std::size_t(0), ProtocolLayerMsgMaxLengthCalcHelper<>());
+    }
+};
+
 } // namespace details
 
 } // namespace protocol
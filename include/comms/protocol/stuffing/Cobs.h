@@ -0,0 +1,163 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::stuffing::Cobs
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "comms/protocol/details/ByteStuffingHelpers.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace stuffing
+{
+
+/// @brief Consistent Overhead Byte Stuffing (COBS) codec.
+/// @details The frame is terminated by the zero byte. The encoded data
+///     is a sequence of blocks, each starting with the code byte @b N (1 - 255)
+///     followed by <b>N - 1</b> non-zero data bytes. The code byte less than
+///     255 implies the zero byte after the block unless it's the last one.
+///     The overhead doesn't exceed one byte per 254 bytes of the data.
+/// @headerfile comms/protocol/stuffing/Cobs.h
+class Cobs
+{
+public:
+    /// @brief Frame delimiter
+    static const std::uint8_t Delimiter = 0U;
+
+    /// @brief Compile time evaluation of the maximal length of the encoded data
+    ///     (not including the frame delimiter).
+    /// @param[in] len Length of the data to encode.
+    static constexpr std::size_t maxEncodedLength(std::size_t len)
+    {
+        return len + (len / MaxRun) + 1U;
+    }
+
+    /// @brief Exact length of the encoded data (not including the frame delimiter).
+    /// @param[in] src Data to encode.
+    /// @param[in] srcLen Number of bytes to encode.
+    std::size_t encodedLength(const std::uint8_t* src, std::size_t srcLen) const
+    {
+        std::size_t result = 0U;
+        auto* end = src + srcLen;
+        while (true) {
+            auto* blockEnd = maxBlockEnd(src, end);
+            auto* zero = comms::protocol::details::byteStuffingFind(src, blockEnd, 0U);
+            result += 1U + static_cast<std::size_t>(zero - src);
+            if (zero != blockEnd) {
+                src = zero + 1;
+                continue;
+            }
+
+            src = blockEnd;
+            if (src == end) {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    /// @brief Encode data (not including the frame delimiter).
+    /// @param[in] src Data to encode.
+    /// @param[in] srcLen Number of bytes to encode.
+    /// @param[in, out] iter Output iterator.
+    /// @pre The output buffer can accommodate @ref encodedLength() bytes.
+    template <typename TIter>
+    void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const
+    {
+        auto* end = src + srcLen;
+        while (true) {
+            auto* blockEnd = maxBlockEnd(src, end);
+            auto* zero = comms::protocol::details::byteStuffingFind(src, blockEnd, 0U);
+            *iter = static_cast<std::uint8_t>((zero - src) + 1);
+            ++iter;
+            iter = std::copy(src, zero, iter);
+            if (zero != blockEnd) {
+                src = zero + 1;
+                continue;
+            }
+
+            src = blockEnd;
+            if (src == end) {
+                break;
+            }
+        }
+    }
+
+    /// @brief Decode data.
+    /// @param[in, out] iter Input iterator.
+    /// @param[in] srcLen Number of encoded bytes (not including the frame delimiter).
+    /// @param[out] dst Output buffer, must be able to accommodate at least @b srcLen bytes.
+    /// @param[out] dstLen Number of decoded bytes.
+    /// @return @b true in case all the @b srcLen bytes have been successfully decoded.
+    /// @post The iterator is advanced by number of bytes read.
+    template <typename TIter>
+    bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const
+    {
+        dstLen = 0U;
+        while (0U < srcLen) {
+            auto code = static_cast<std::uint8_t>(*iter);
+            ++iter;
+            --srcLen;
+
+            auto runLen = static_cast<std::size_t>(code) - 1U;
+            if ((code == 0U) || (srcLen < runLen)) {
+                return false;
+            }
+
+            copyRun(iter, runLen, dst + dstLen, comms::protocol::details::ByteStuffingIterTag<TIter>());
+            dstLen += runLen;
+            srcLen -= runLen;
+            if ((code != 0xFF) && (0U < srcLen)) {
+                dst[dstLen] = 0U;
+                ++dstLen;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    static const std::size_t MaxRun = 254U;
+
+    static const std::uint8_t* maxBlockEnd(const std::uint8_t* src, const std::uint8_t* end)
+    {
+        return (static_cast<std::size_t>(end - src) < MaxRun) ? end : (src + MaxRun);
+    }
+
+    template <typename TIter, typename... TParams>
+    static void copyRun(TIter& iter, std::size_t len, std::uint8_t* dst, comms::protocol::details::ByteStuffingRawPtrTag<TParams...>)
+    {
+        std::copy_n(iter, len, dst);
+        iter += len;
+    }
+
+    template <typename TIter, typename... TParams>
+    static void copyRun(TIter& iter, std::size_t len, std::uint8_t* dst, comms::protocol::details::ByteStuffingGenericIterTag<TParams...>)
+    {
+        for (auto idx = 0U; idx < len; ++idx) {
+            dst[idx] = static_cast<std::uint8_t>(*iter);
+            ++iter;
+        }
+    }
+};
+
+} // namespace stuffing
+
+} // namespace protocol
+
+} // namespace comms
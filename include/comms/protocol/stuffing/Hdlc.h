@@ -0,0 +1,54 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::stuffing::Hdlc
+
+#pragma once
+
+#include <cstdint>
+
+#include "comms/protocol/details/ByteStuffingEscapeCodecBase.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace stuffing
+{
+
+/// @brief HDLC-like (RFC 1662, used by PPP) byte stuffing codec.
+/// @details The frame starts and ends with the @b flag (0x7E) byte. The
+///     @b flag and @b escape (0x7D) bytes in the data are replaced with
+///     @b escape followed by the original byte XOR-ed with 0x20. When decoding,
+///     any byte following the @b escape is XOR-ed with 0x20, i.e. the data
+///     produced by the peers escaping additional (control) characters is
+///     accepted as well.
+/// @headerfile comms/protocol/stuffing/Hdlc.h
+class Hdlc : public
+    comms::protocol::details::ByteStuffingEscapeCodecBase<Hdlc, 0x7E, 0x7D, 0x5E, 0x5D, true>
+{
+    using Base = comms::protocol::details::ByteStuffingEscapeCodecBase<Hdlc, 0x7E, 0x7D, 0x5E, 0x5D, true>;
+    friend Base;
+
+protected:
+    /// @cond SKIP_DOC
+    static bool unescape(std::uint8_t byte, std::uint8_t& result)
+    {
+        result = static_cast<std::uint8_t>(byte ^ 0x20);
+        return true;
+    }
+    /// @endcond
+};
+
+} // namespace stuffing
+
+} // namespace protocol
+
+} // namespace comms
@@ -0,0 +1,43 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::stuffing::Slip
+
+#pragma once
+
+#include <cstdint>
+
+#include "comms/protocol/details/ByteStuffingEscapeCodecBase.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace stuffing
+{
+
+/// @brief SLIP (RFC 1055) byte stuffing codec.
+/// @details The frame is terminated by the @b END (0xC0) byte. The @b END
+///     byte in the data is replaced with @b ESC (0xDB) followed by 0xDC,
+///     and the @b ESC byte is replaced with @b ESC followed by 0xDD.
+///     Any other byte following @b ESC is reported as malformed data.
+/// @headerfile comms/protocol/stuffing/Slip.h
+class Slip : public
+    comms::protocol::details::ByteStuffingEscapeCodecBase<Slip, 0xC0, 0xDB, 0xDC, 0xDD, false>
+{
+    using Base = comms::protocol::details::ByteStuffingEscapeCodecBase<Slip, 0xC0, 0xDB, 0xDC, 0xDD, false>;
+    friend Base;
+};
+
+} // namespace stuffing
+
+} // namespace protocol
+
+} // namespace comms
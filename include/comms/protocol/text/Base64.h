@@ -0,0 +1,178 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::text::Base64
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "comms/protocol/details/TextCodecTables.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace text
+{
+
+/// @brief Base64 text codec.
+/// @details Uses the standard alphabet defined by RFC 4648 with the
+///     @b '=' padding of the last group. Every three bytes are encoded
+///     as four characters. The validity of the characters is checked
+///     once per decoded buffer rather than per character.
+/// @headerfile comms/protocol/text/Base64.h
+class Base64
+{
+public:
+    /// @brief Compile time evaluation of the length of the encoded data.
+    /// @param[in] len Length of the data to encode.
+    static constexpr std::size_t encodedLength(std::size_t len)
+    {
+        return ((len + 2U) / 3U) * 4U;
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the decoded data.
+    /// @param[in] len Length of the encoded data.
+    static constexpr std::size_t maxDecodedLength(std::size_t len)
+    {
+        return (len / 4U) * 3U;
+    }
+
+    /// @brief Encode data.
+    /// @param[in] src Data to encode.
+    /// @param[in] srcLen Number of bytes to encode.
+    /// @param[in, out] iter Output iterator.
+    /// @pre The output buffer can accommodate @ref encodedLength() bytes.
+    template <typename TIter>
+    void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const
+    {
+        auto* end = src + ((srcLen / 3U) * 3U);
+        for (; src != end; src += 3) {
+            auto group =
+                (static_cast<unsigned>(src[0]) << 16U) |
+                (static_cast<unsigned>(src[1]) << 8U) |
+                static_cast<unsigned>(src[2]);
+            writeChars(group, 4U, iter);
+        }
+
+        auto remLen = srcLen % 3U;
+        if (remLen == 0U) {
+            return;
+        }
+
+        auto group = static_cast<unsigned>(src[0]) << 16U;
+        if (1U < remLen) {
+            group |= static_cast<unsigned>(src[1]) << 8U;
+        }
+
+        writeChars(group, remLen + 1U, iter);
+        for (auto idx = remLen; idx < 3U; ++idx) {
+            *iter = static_cast<std::uint8_t>('=');
+            ++iter;
+        }
+    }
+
+    /// @brief Decode data.
+    /// @param[in, out] iter Input iterator.
+    /// @param[in] srcLen Number of encoded characters, must be a multiple of @b 4.
+    /// @param[out] dst Output buffer, must be able to accommodate at least
+    ///     @ref maxDecodedLength() bytes.
+    /// @param[out] dstLen Number of decoded bytes.
+    /// @return @b true in case all the @b srcLen characters have been successfully decoded.
+    /// @post The iterator is advanced by number of characters read.
+    template <typename TIter>
+    bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const
+    {
+        dstLen = 0U;
+        if ((srcLen % 4U) != 0U) {
+            return false;
+        }
+
+        if (srcLen == 0U) {
+            return true;
+        }
+
+        using Tables = comms::protocol::details::TextCodecTables<>;
+        auto groupsCount = (srcLen / 4U) - 1U;
+        std::uint8_t invalid = 0U;
+        for (std::size_t idx = 0U; idx < groupsCount; ++idx) {
+            std::uint8_t values[4] = {0U};
+            for (auto& val : values) {
+                val = Tables::Base64Decode[static_cast<std::uint8_t>(*iter)];
+                ++iter;
+                invalid |= val;
+            }
+
+            writeBytes(values, 3U, dst);
+            dst += 3;
+        }
+
+        // Last group may be padded
+        std::uint8_t chars[4] = {0U};
+        for (auto& ch : chars) {
+            ch = static_cast<std::uint8_t>(*iter);
+            ++iter;
+        }
+
+        std::size_t lastLen = 3U;
+        if (chars[3] == static_cast<std::uint8_t>('=')) {
+            chars[3] = static_cast<std::uint8_t>('A');
+            --lastLen;
+            if (chars[2] == static_cast<std::uint8_t>('=')) {
+                chars[2] = static_cast<std::uint8_t>('A');
+                --lastLen;
+            }
+        }
+
+        std::uint8_t values[4] = {0U};
+        for (auto idx = 0U; idx < 4U; ++idx) {
+            values[idx] = Tables::Base64Decode[chars[idx]];
+            invalid |= values[idx];
+        }
+
+        writeBytes(values, lastLen, dst);
+        dstLen = (groupsCount * 3U) + lastLen;
+        return (invalid & 0x80U) == 0U;
+    }
+
+private:
+    template <typename TIter>
+    static void writeChars(unsigned group, std::size_t count, TIter& iter)
+    {
+        static const char Alphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        for (auto idx = 0U; idx < count; ++idx) {
+            *iter = static_cast<std::uint8_t>(Alphabet[(group >> (18U - (idx * 6U))) & 0x3fU]);
+            ++iter;
+        }
+    }
+
+    static void writeBytes(const std::uint8_t (&values)[4], std::size_t count, std::uint8_t* dst)
+    {
+        auto group =
+            (static_cast<unsigned>(values[0]) << 18U) |
+            (static_cast<unsigned>(values[1]) << 12U) |
+            (static_cast<unsigned>(values[2]) << 6U) |
+            static_cast<unsigned>(values[3]);
+
+        for (auto idx = 0U; idx < count; ++idx) {
+            dst[idx] = static_cast<std::uint8_t>(group >> (16U - (idx * 8U)));
+        }
+    }
+};
+
+} // namespace text
+
+} // namespace protocol
+
+} // namespace comms
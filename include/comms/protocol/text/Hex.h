@@ -0,0 +1,133 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::protocol::text::Hex
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace text
+{
+
+/// @brief Hexadecimal text codec.
+/// @details Every byte is encoded as two hexadecimal digits, the most
+///     significant nibble first. The decoding accepts both upper and lower case
+///     digits. The validity of the characters is checked once per decoded buffer
+///     rather than per character.
+/// @tparam TUpperCase Use upper case digits when encoding.
+/// @headerfile comms/protocol/text/Hex.h
+template <bool TUpperCase = true>
+class Hex
+{
+public:
+    /// @brief Compile time evaluation of the length of the encoded data.
+    /// @param[in] len Length of the data to encode.
+    static constexpr std::size_t encodedLength(std::size_t len)
+    {
+        return len * 2U;
+    }
+
+    /// @brief Compile time evaluation of the maximal length of the decoded data.
+    /// @param[in] len Length of the encoded data.
+    static constexpr std::size_t maxDecodedLength(std::size_t len)
+    {
+        return len / 2U;
+    }
+
+    /// @brief Encode data.
+    /// @param[in] src Data to encode.
+    /// @param[in] srcLen Number of bytes to encode.
+    /// @param[in, out] iter Output iterator.
+    /// @pre The output buffer can accommodate @ref encodedLength() bytes.
+    template <typename TIter>
+    void encode(const std::uint8_t* src, std::size_t srcLen, TIter& iter) const
+    {
+        auto* end = src + srcLen;
+
+        // Local copy, the written bytes may alias the referenced iterator
+        auto outIter = iter;
+        for (; src != end; ++src) {
+            *outIter = digit(static_cast<unsigned>(*src >> 4U));
+            ++outIter;
+            *outIter = digit(static_cast<unsigned>(*src & 0xfU));
+            ++outIter;
+        }
+        iter = outIter;
+    }
+
+    /// @brief Decode data.
+    /// @param[in, out] iter Input iterator.
+    /// @param[in] srcLen Number of encoded characters, must be even.
+    /// @param[out] dst Output buffer, must be able to accommodate at least
+    ///     @ref maxDecodedLength() bytes.
+    /// @param[out] dstLen Number of decoded bytes.
+    /// @return @b true in case all the @b srcLen characters have been successfully decoded.
+    /// @post The iterator is advanced by number of characters read.
+    template <typename TIter>
+    bool decode(TIter& iter, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen) const
+    {
+        if ((srcLen & 0x1U) != 0U) {
+            return false;
+        }
+
+        dstLen = srcLen / 2U;
+        std::uint8_t invalid = 0U;
+
+        // Local copy, the written bytes may alias the referenced iterator
+        auto inIter = iter;
+        for (std::size_t idx = 0U; idx < dstLen; ++idx) {
+            auto high = value(static_cast<std::uint8_t>(*inIter));
+            ++inIter;
+            auto low = value(static_cast<std::uint8_t>(*inIter));
+            ++inIter;
+            invalid |= high | low;
+            dst[idx] = static_cast<std::uint8_t>((high << 4U) | (low & 0xfU));
+        }
+        iter = inIter;
+
+        return (invalid & 0x80U) == 0U;
+    }
+
+private:
+    // The character is calculated rather than looked up in the table,
+    // which allows the compiler to vectorise the loops.
+    static std::uint8_t digit(unsigned nibble)
+    {
+        static const int AlphaOffset = (TUpperCase ? 'A' : 'a') - '9' - 1;
+        auto alphaMask = -static_cast<int>(9U < nibble);
+        return static_cast<std::uint8_t>(static_cast<int>(nibble) + '0' + (alphaMask & AlphaOffset));
+    }
+
+    // Returns the nibble value with 0x80 bit set for the invalid character
+    static std::uint8_t value(std::uint8_t ch)
+    {
+        auto digitVal = static_cast<std::uint8_t>(ch - '0');
+        auto alphaVal = static_cast<std::uint8_t>((ch | 0x20U) - 'a');
+        auto digitMask = static_cast<std::uint8_t>((digitVal < 10U) ? 0xffU : 0U);
+        auto alphaMask = static_cast<std::uint8_t>((alphaVal < 6U) ? 0xffU : 0U);
+        return
+            static_cast<std::uint8_t>(
+                (digitVal & digitMask) |
+                ((alphaVal + 10U) & alphaMask) |
+                (~(digitMask | alphaMask) & 0x80U));
+    }
+};
+
+} // namespace text
+
+} // namespace protocol
+
+} // namespace comms
@@ -16,8 +16,23 @@
 #include "protocol/SyncPrefixLayer.h"
 #include "protocol/ChecksumLayer.h"
 #include "protocol/ChecksumPrefixLayer.h"
+#include "protocol/BatchLayer.h"
+#include "protocol/ByteStuffingLayer.h"
+#include "protocol/CompressionLayer.h"
+#include "protocol/FragmentationLayer.h"
+#include "protocol/LineLayer.h"
+#include "protocol/TextEncodingLayer.h"
 #include "protocol/TransportValueLayer.h"
 
+#include "protocol/checksum/Adler.h"
 #include "protocol/checksum/BasicSum.h"
 #include "protocol/checksum/BasicXor.h"
 #include "protocol/checksum/Crc.h"
+#include "protocol/checksum/Fletcher.h"
+#include "protocol/checksum/SinglePassIterator.h"
+#include "protocol/compression/Lz.h"
+#include "protocol/stuffing/Cobs.h"
+#include "protocol/stuffing/Hdlc.h"
+#include "protocol/stuffing/Slip.h"
+#include "protocol/text/Base64.h"
+#include "protocol/text/Hex.h"
@@ -206,6 +206,9 @@ struct StaticBinSearch {};
 /// @brief Tag class used to indicate linear switch dispatch
 struct LinearSwitch {};
 
+/// @brief Tag class used to indicate flat jump table dispatch
+struct JumpTable {};
+
 } // namespace dispatch
 
 }  // namespace traits
@@ -0,0 +1,804 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains comms::util::ColumnarVector class.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "comms/Assert.h"
+#include "comms/util/Tuple.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+namespace details
+{
+
+template <typename TMembers>
+struct ColumnarVectorColumns;
+
+template <typename... TMembers>
+struct ColumnarVectorColumns<std::tuple<TMembers...> >
+{
+    using Type = std::tuple<std::vector<typename TMembers::ValueType>...>;
+};
+
+template <typename TColumns>
+class ColumnarVectorGetHelper
+{
+public:
+    ColumnarVectorGetHelper(const TColumns& columns, std::size_t idx) :
+        columns_(columns),
+        idx_(idx)
+    {
+    }
+
+    template <std::size_t TIdx, typename TMember>
+    void operator()(TMember& member) const
+    {
+        member.value() = std::get<TIdx>(columns_)[idx_];
+    }
+
+private:
+    const TColumns& columns_;
+    std::size_t idx_ = 0U;
+};
+
+template <typename TColumns>
+class ColumnarVectorSetHelper
+{
+public:
+    ColumnarVectorSetHelper(TColumns& columns, std::size_t idx) :
+        columns_(columns),
+        idx_(idx)
+    {
+    }
+
+    template <std::size_t TIdx, typename TMember>
+    void operator()(const TMember& member) const
+    {
+        std::get<TIdx>(columns_)[idx_] = member.value();
+    }
+
+private:
+    TColumns& columns_;
+    std::size_t idx_ = 0U;
+};
+
+template <typename TColumns>
+class ColumnarVectorPushBackHelper
+{
+public:
+    explicit ColumnarVectorPushBackHelper(TColumns& columns) :
+        columns_(columns)
+    {
+    }
+
+    template <std::size_t TIdx, typename TMember>
+    void operator()(const TMember& member) const
+    {
+        std::get<TIdx>(columns_).push_back(member.value());
+    }
+
+private:
+    TColumns& columns_;
+};
+
+template <typename TColumns>
+class ColumnarVectorResizeHelper
+{
+public:
+    ColumnarVectorResizeHelper(TColumns& columns, std::size_t count) :
+        columns_(columns),
+        count_(count)
+    {
+    }
+
+    template <std::size_t TIdx, typename TMember>
+    void operator()(const TMember& member) const
+    {
+        std::get<TIdx>(columns_).resize(count_, member.value());
+    }
+
+private:
+    TColumns& columns_;
+    std::size_t count_ = 0U;
+};
+
+class ColumnarVectorReserveHelper
+{
+public:
+    explicit ColumnarVectorReserveHelper(std::size_t count) :
+        count_(count)
+    {
+    }
+
+    template <typename TColumn>
+    void operator()(TColumn& column) const
+    {
+        column.reserve(count_);
+    }
+
+private:
+    std::size_t count_ = 0U;
+};
+
+class ColumnarVectorClearHelper
+{
+public:
+    template <typename TColumn>
+    void operator()(TColumn& column) const
+    {
+        column.clear();
+    }
+};
+
+class ColumnarVectorPopBackHelper
+{
+public:
+    template <typename TColumn>
+    void operator()(TColumn& column) const
+    {
+        column.pop_back();
+    }
+};
+
+template <typename TColumns>
+class ColumnarVectorCompareHelper
+{
+public:
+    ColumnarVectorCompareHelper(
+        const TColumns& columns1,
+        std::size_t idx1,
+        const TColumns& columns2,
+        std::size_t idx2) :
+        columns1_(columns1),
+        columns2_(columns2),
+        idx1_(idx1),
+        idx2_(idx2)
+    {
+    }
+
+    template <std::size_t TIdx, typename TColumn>
+    void operator()(const TColumn& column1)
+    {
+        if (result_ != 0) {
+            return;
+        }
+
+        auto& column2 = std::get<TIdx>(columns2_);
+        if (column1[idx1_] < column2[idx2_]) {
+            result_ = -1;
+            return;
+        }
+
+        if (column2[idx2_] < column1[idx1_]) {
+            result_ = 1;
+        }
+    }
+
+    int result() const
+    {
+        return result_;
+    }
+
+private:
+    const TColumns& columns1_;
+    const TColumns& columns2_;
+    std::size_t idx1_ = 0U;
+    std::size_t idx2_ = 0U;
+    int result_ = 0;
+};
+
+}  // namespace details
+
+/// @brief Proxy object providing access to a single element of
+///     @ref ColumnarVector.
+/// @details Returned by the element access functions and iterators of
+///     @ref ColumnarVector. Refers to the element by the index, i.e.
+///     remains valid as long as the index is valid.
+/// @tparam TVec Type of the vector, @b const qualified for read-only access.
+/// @headerfile "comms/util/ColumnarVector.h"
+template <typename TVec>
+class ColumnarVectorReference
+{
+    using VecType = typename std::remove_const<TVec>::type;
+public:
+    /// @brief Type of the element
+    using value_type = typename VecType::value_type;
+
+    /// @brief Type used for indices
+    using size_type = typename VecType::size_type;
+
+    /// @brief Constructor
+    ColumnarVectorReference(TVec& vec, size_type idx) :
+        vec_(&vec),
+        idx_(idx)
+    {
+    }
+
+    /// @brief Copy constructor
+    ColumnarVectorReference(const ColumnarVectorReference&) = default;
+
+    /// @brief Assign the value of the referenced element.
+    ColumnarVectorReference& operator=(const value_type& val)
+    {
+        vec_->set(idx_, val);
+        return *this;
+    }
+
+    /// @brief Assign the value of another referenced element.
+    /// @details Copies the value, not the reference.
+    ColumnarVectorReference& operator=(const ColumnarVectorReference& other)
+    {
+        vec_->set(idx_, other.value());
+        return *this;
+    }
+
+    /// @brief Access the value of the member of the referenced element.
+    /// @details Refers directly to the value stored in the column.
+    /// @tparam TIdx Index of the member in the bundle.
+    template <std::size_t TIdx>
+    auto member() const -> decltype(std::declval<TVec&>().template column<TIdx>()[0])
+    {
+        return vec_->template column<TIdx>()[idx_];
+    }
+
+    /// @brief Retrieve the referenced element.
+    /// @details Constructs the element out of the column values.
+    value_type value() const
+    {
+        return vec_->get(idx_);
+    }
+
+    /// @brief Same as @ref value()
+    operator value_type() const
+    {
+        return value();
+    }
+
+    /// @brief Get the vector the element belongs to.
+    TVec& vector() const
+    {
+        return *vec_;
+    }
+
+    /// @brief Get index of the referenced element.
+    size_type index() const
+    {
+        return idx_;
+    }
+
+private:
+    TVec* vec_ = nullptr;
+    size_type idx_ = 0U;
+};
+
+/// @brief Equality comparison of the referenced elements.
+/// @details Compares the member values stored in the columns.
+/// @related ColumnarVectorReference
+template <typename TVec1, typename TVec2>
+bool operator==(const ColumnarVectorReference<TVec1>& ref1, const ColumnarVectorReference<TVec2>& ref2)
+{
+    return std::remove_const<TVec1>::type::compare(ref1.vector(), ref1.index(), ref2.vector(), ref2.index()) == 0;
+}
+
+/// @brief Inequality comparison of the referenced elements.
+/// @related ColumnarVectorReference
+template <typename TVec1, typename TVec2>
+bool operator!=(const ColumnarVectorReference<TVec1>& ref1, const ColumnarVectorReference<TVec2>& ref2)
+{
+    return !(ref1 == ref2);
+}
+
+/// @brief Lexicographical comparison of the referenced elements.
+/// @details Compares the member values stored in the columns.
+/// @related ColumnarVectorReference
+template <typename TVec1, typename TVec2>
+bool operator<(const ColumnarVectorReference<TVec1>& ref1, const ColumnarVectorReference<TVec2>& ref2)
+{
+    return std::remove_const<TVec1>::type::compare(ref1.vector(), ref1.index(), ref2.vector(), ref2.index()) < 0;
+}
+
+/// @brief Random access iterator of @ref ColumnarVector.
+/// @details Dereferencing returns @ref ColumnarVectorReference proxy object
+///     by value, similar to iterators of @b std::vector<bool>.
+/// @tparam TVec Type of the vector, @b const qualified for read-only access.
+/// @headerfile "comms/util/ColumnarVector.h"
+template <typename TVec>
+class ColumnarVectorIterator
+{
+    using VecType = typename std::remove_const<TVec>::type;
+public:
+    /// @brief Iterator category
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// @brief Type of the element
+    using value_type = typename VecType::value_type;
+
+    /// @brief Type of the difference between iterators
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Type of the proxy object returned when dereferenced
+    using reference = ColumnarVectorReference<TVec>;
+
+    /// @brief Pointer type (not supported)
+    using pointer = void;
+
+    /// @brief Type used for indices
+    using size_type = typename VecType::size_type;
+
+    /// @brief Default constructor
+    ColumnarVectorIterator() = default;
+
+    /// @brief Constructor
+    ColumnarVectorIterator(TVec& vec, size_type idx) :
+        vec_(&vec),
+        idx_(idx)
+    {
+    }
+
+    /// @brief Conversion from non-const iterator.
+    template <
+        typename TOther,
+        typename = typename std::enable_if<
+            std::is_const<TVec>::value &&
+            std::is_same<TOther, VecType>::value
+        >::type
+    >
+    ColumnarVectorIterator(const ColumnarVectorIterator<TOther>& other) :
+        vec_(other.vec_),
+        idx_(other.idx_)
+    {
+    }
+
+    /// @brief Dereference operator
+    reference operator*() const
+    {
+        COMMS_ASSERT(vec_ != nullptr);
+        return reference(*vec_, idx_);
+    }
+
+    /// @brief Subscript operator
+    reference operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    /// @brief Pre-increment
+    ColumnarVectorIterator& operator++()
+    {
+        ++idx_;
+        return *this;
+    }
+
+    /// @brief Post-increment
+    ColumnarVectorIterator operator++(int)
+    {
+        auto copy = *this;
+        ++idx_;
+        return copy;
+    }
+
+    /// @brief Pre-decrement
+    ColumnarVectorIterator& operator--()
+    {
+        --idx_;
+        return *this;
+    }
+
+    /// @brief Post-decrement
+    ColumnarVectorIterator operator--(int)
+    {
+        auto copy = *this;
+        --idx_;
+        return copy;
+    }
+
+    /// @brief Advance the iterator
+    ColumnarVectorIterator& operator+=(difference_type n)
+    {
+        idx_ = static_cast<size_type>(static_cast<difference_type>(idx_) + n);
+        return *this;
+    }
+
+    /// @brief Move the iterator backwards
+    ColumnarVectorIterator& operator-=(difference_type n)
+    {
+        return *this += -n;
+    }
+
+    /// @brief Get advanced iterator
+    ColumnarVectorIterator operator+(difference_type n) const
+    {
+        auto copy = *this;
+        copy += n;
+        return copy;
+    }
+
+    /// @brief Get moved back iterator
+    ColumnarVectorIterator operator-(difference_type n) const
+    {
+        auto copy = *this;
+        copy -= n;
+        return copy;
+    }
+
+    /// @brief Distance between iterators
+    difference_type operator-(const ColumnarVectorIterator& other) const
+    {
+        return static_cast<difference_type>(idx_) - static_cast<difference_type>(other.idx_);
+    }
+
+    /// @brief Equality comparison
+    bool operator==(const ColumnarVectorIterator& other) const
+    {
+        return (vec_ == other.vec_) && (idx_ == other.idx_);
+    }
+
+    /// @brief Inequality comparison
+    bool operator!=(const ColumnarVectorIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Order comparison
+    bool operator<(const ColumnarVectorIterator& other) const
+    {
+        return idx_ < other.idx_;
+    }
+
+    /// @brief Order comparison
+    bool operator>(const ColumnarVectorIterator& other) const
+    {
+        return other < *this;
+    }
+
+    /// @brief Order comparison
+    bool operator<=(const ColumnarVectorIterator& other) const
+    {
+        return !(other < *this);
+    }
+
+    /// @brief Order comparison
+    bool operator>=(const ColumnarVectorIterator& other) const
+    {
+        return !(*this < other);
+    }
+
+private:
+    template <typename>
+    friend class ColumnarVectorIterator;
+
+    TVec* vec_ = nullptr;
+    size_type idx_ = 0U;
+};
+
+/// @brief Get advanced iterator
+/// @related ColumnarVectorIterator
+template <typename TVec>
+ColumnarVectorIterator<TVec> operator+(
+    typename ColumnarVectorIterator<TVec>::difference_type n,
+    const ColumnarVectorIterator<TVec>& iter)
+{
+    return iter + n;
+}
+
+/// @brief Sequence of @ref comms::field::Bundle fields stored as
+///     "struct of arrays".
+/// @details Instead of storing the bundle fields one after another, keeps
+///     values of every bundle member in a separate contiguous @b std::vector
+///     (column). It allows processing of a single member of all the elements
+///     (filtering, aggregation, etc...) in a cache friendly and
+///     vectorisation friendly manner. @n
+///     The interface is similar to the one of @b std::vector, but the
+///     element access functions and iterators return
+///     @ref ColumnarVectorReference proxy objects instead of references
+///     (similar to @b std::vector<bool>). As the result the
+///     <b>for (auto& elem : vec)</b> loop doesn't compile, use either
+///     <b>for (auto elem : vec)</b> or direct access to the columns.
+/// @tparam TBundle Type of the element, expected to be a variant of
+///     @ref comms::field::Bundle.
+/// @headerfile "comms/util/ColumnarVector.h"
+template <typename TBundle>
+class ColumnarVector
+{
+    using Members = typename TBundle::ValueType;
+    static_assert(0U < std::tuple_size<Members>::value, "The bundle must have at least one member");
+
+public:
+    /// @brief Type of the element
+    using value_type = TBundle;
+
+    /// @brief Same as @ref value_type
+    using ValueType = value_type;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Same as @ref size_type
+    using SizeType = size_type;
+
+    /// @brief Type of the difference between iterators
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Proxy reference to the element
+    using reference = ColumnarVectorReference<ColumnarVector>;
+
+    /// @brief Proxy reference to the const element
+    using const_reference = ColumnarVectorReference<const ColumnarVector>;
+
+    /// @brief Type of the iterator
+    using iterator = ColumnarVectorIterator<ColumnarVector>;
+
+    /// @brief Type of the const iterator
+    using const_iterator = ColumnarVectorIterator<const ColumnarVector>;
+
+    /// @brief Tuple of all the columns
+    /// @details Every column is a @b std::vector of the @b ValueType of
+    ///     the relevant bundle member.
+    using Columns = typename details::ColumnarVectorColumns<Members>::Type;
+
+    /// @brief Type of the column for the bundle member with specified index.
+    template <std::size_t TIdx>
+    using ColumnType = typename std::tuple_element<TIdx, Columns>::type;
+
+    /// @brief Default constructor
+    ColumnarVector() = default;
+
+    /// @brief Constructor of the vector with @b count default elements.
+    explicit ColumnarVector(size_type count)
+    {
+        resize(count);
+    }
+
+    /// @brief Copy constructor
+    ColumnarVector(const ColumnarVector&) = default;
+
+    /// @brief Move constructor
+    ColumnarVector(ColumnarVector&&) = default;
+
+    /// @brief Destructor
+    ~ColumnarVector() noexcept = default;
+
+    /// @brief Copy assignment
+    ColumnarVector& operator=(const ColumnarVector&) = default;
+
+    /// @brief Move assignment
+    ColumnarVector& operator=(ColumnarVector&&) = default;
+
+    /// @brief Access to the column of the bundle member with specified index.
+    /// @details The values can be updated directly, but the size of the
+    ///     column must not be modified.
+    template <std::size_t TIdx>
+    ColumnType<TIdx>& column()
+    {
+        return std::get<TIdx>(columns_);
+    }
+
+    /// @brief Access to the column of the bundle member with specified index.
+    template <std::size_t TIdx>
+    const ColumnType<TIdx>& column() const
+    {
+        return std::get<TIdx>(columns_);
+    }
+
+    /// @brief Access to all the columns.
+    const Columns& columns() const
+    {
+        return columns_;
+    }
+
+    /// @brief Retrieve the element.
+    /// @details Constructs the bundle out of the column values.
+    value_type get(size_type idx) const
+    {
+        value_type elem;
+        get(idx, elem);
+        return elem;
+    }
+
+    /// @brief Retrieve the element into the existing bundle object.
+    void get(size_type idx, value_type& elem) const
+    {
+        COMMS_ASSERT(idx < size());
+        comms::util::tupleForEachWithTemplateParamIdx(
+            elem.value(), details::ColumnarVectorGetHelper<Columns>(columns_, idx));
+    }
+
+    /// @brief Update the element.
+    /// @details Stores the member values of the bundle into the columns.
+    void set(size_type idx, const value_type& elem)
+    {
+        COMMS_ASSERT(idx < size());
+        comms::util::tupleForEachWithTemplateParamIdx(
+            elem.value(), details::ColumnarVectorSetHelper<Columns>(columns_, idx));
+    }
+
+    /// @brief Access the element (without bounds check).
+    reference operator[](size_type idx)
+    {
+        COMMS_ASSERT(idx < size());
+        return reference(*this, idx);
+    }
+
+    /// @brief Access the element (without bounds check).
+    const_reference operator[](size_type idx) const
+    {
+        COMMS_ASSERT(idx < size());
+        return const_reference(*this, idx);
+    }
+
+    /// @brief Access the first element.
+    reference front()
+    {
+        return (*this)[0];
+    }
+
+    /// @brief Access the first element.
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+
+    /// @brief Access the last element.
+    reference back()
+    {
+        return (*this)[size() - 1U];
+    }
+
+    /// @brief Access the last element.
+    const_reference back() const
+    {
+        return (*this)[size() - 1U];
+    }
+
+    /// @brief Iterator to the first element.
+    iterator begin()
+    {
+        return iterator(*this, 0U);
+    }
+
+    /// @brief Iterator to the first element.
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    /// @brief Iterator to the first element.
+    const_iterator cbegin() const
+    {
+        return const_iterator(*this, 0U);
+    }
+
+    /// @brief Iterator to the element following the last one.
+    iterator end()
+    {
+        return iterator(*this, size());
+    }
+
+    /// @brief Iterator to the element following the last one.
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    /// @brief Iterator to the element following the last one.
+    const_iterator cend() const
+    {
+        return const_iterator(*this, size());
+    }
+
+    /// @brief Check whether the vector is empty.
+    bool empty() const
+    {
+        return std::get<0>(columns_).empty();
+    }
+
+    /// @brief Number of the elements.
+    size_type size() const
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    /// @brief Maximal number of the elements.
+    size_type max_size() const
+    {
+        return std::get<0>(columns_).max_size();
+    }
+
+    /// @brief Reserve space in all the columns.
+    void reserve(size_type count)
+    {
+        comms::util::tupleForEach(columns_, details::ColumnarVectorReserveHelper(count));
+    }
+
+    /// @brief Remove all the elements.
+    void clear()
+    {
+        comms::util::tupleForEach(columns_, details::ColumnarVectorClearHelper());
+    }
+
+    /// @brief Resize the vector.
+    /// @details The added elements get the values of the default constructed bundle.
+    void resize(size_type count)
+    {
+        value_type elem;
+        comms::util::tupleForEachWithTemplateParamIdx(
+            elem.value(), details::ColumnarVectorResizeHelper<Columns>(columns_, count));
+    }
+
+    /// @brief Add element to the end.
+    void push_back(const value_type& elem)
+    {
+        comms::util::tupleForEachWithTemplateParamIdx(
+            elem.value(), details::ColumnarVectorPushBackHelper<Columns>(columns_));
+    }
+
+    /// @brief Add default constructed element to the end.
+    reference emplace_back()
+    {
+        push_back(value_type());
+        return back();
+    }
+
+    /// @brief Remove the last element.
+    void pop_back()
+    {
+        COMMS_ASSERT(!empty());
+        comms::util::tupleForEach(columns_, details::ColumnarVectorPopBackHelper());
+    }
+
+    /// @brief Compare two elements.
+    /// @details Performs lexicographical comparison of the member values.
+    /// @return Negative value when the first element is less than the second one,
+    ///     positive when it is greater, @b 0 when equal.
+    static int compare(
+        const ColumnarVector& vec1,
+        size_type idx1,
+        const ColumnarVector& vec2,
+        size_type idx2)
+    {
+        details::ColumnarVectorCompareHelper<Columns> helper(vec1.columns_, idx1, vec2.columns_, idx2);
+        comms::util::tupleForEachWithTemplateParamIdx(vec1.columns_, helper);
+        return helper.result();
+    }
+
+private:
+    Columns columns_;
+};
+
+/// @brief Equality comparison between the vectors.
+/// @related ColumnarVector
+template <typename TBundle>
+bool operator==(const ColumnarVector<TBundle>& vec1, const ColumnarVector<TBundle>& vec2)
+{
+    return vec1.columns() == vec2.columns();
+}
+
+/// @brief Inequality comparison between the vectors.
+/// @related ColumnarVector
+template <typename TBundle>
+bool operator!=(const ColumnarVector<TBundle>& vec1, const ColumnarVector<TBundle>& vec2)
+{
+    return !(vec1 == vec2);
+}
+
+}  // namespace util
+
+}  // namespace comms
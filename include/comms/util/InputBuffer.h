@@ -0,0 +1,315 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains comms::util::InputBuffer class.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Buffer that accumulates the received input data until it is processed.
+/// @details Owns the storage area split into three regions: already consumed data
+///     at the front, the data that is still waiting to be processed, and free
+///     space at the back, which is used to receive new data:
+///     @code
+///     comms::util::InputBuffer<> buf;
+///     ...
+///     auto* writePtr = buf.prepare(1024); // Free space for at least 1024 bytes
+///     auto count = socket.read(writePtr, 1024); // Read directly into the buffer
+///     buf.commit(count); // Make the received bytes available for processing
+///     comms::processAllWithDispatch(buf, frame, handler); // Process and consume
+///     @endcode
+///     Consuming the data doesn't move the remaining bytes. The remaining bytes are
+///     moved to the front of the storage area (compaction) only when either all
+///     the data has been consumed (no move is needed), the consumed region reaches
+///     the compaction threshold and is larger than the remaining data (the move is
+///     cheap compared to the consumed amount), or the free space at the back is not
+///     enough for the new data. The storage area grows geometrically
+///     and the growth also drops the consumed region. The storage area is
+///     not initialised, only the received data is ever copied into it.
+/// @tparam T Type of the single element, expected to be a byte-sized integral type.
+/// @headerfile "comms/util/InputBuffer.h"
+template <typename T = std::uint8_t>
+class InputBuffer
+{
+    static_assert(std::is_integral<T>::value && (sizeof(T) == 1U),
+        "InputBuffer is expected to store bytes");
+
+public:
+    /// @brief Type of the single element
+    using value_type = T;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Const pointer to the element
+    using const_pointer = const T*;
+
+    /// @brief Pointer to the element
+    using pointer = T*;
+
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+
+    /// @brief Default compaction threshold
+    static constexpr size_type defaultCompactThreshold()
+    {
+        return 4096U;
+    }
+
+    /// @brief Constructor
+    /// @param[in] initialCapacity Initial size of the storage area.
+    /// @param[in] compactThreshold Minimal size of the consumed region
+    ///     for the compaction to be performed on @ref consume().
+    explicit InputBuffer(
+        size_type initialCapacity = 0U,
+        size_type compactThreshold = defaultCompactThreshold()) :
+        storage_(allocate(initialCapacity)),
+        capacity_(initialCapacity),
+        compactThreshold_(compactThreshold)
+    {
+    }
+
+    /// @brief Copy constructor
+    /// @details Copies only the elements waiting to be processed.
+    InputBuffer(const InputBuffer& other) :
+        storage_(allocate(other.size())),
+        capacity_(other.size()),
+        writePos_(other.size()),
+        compactThreshold_(other.compactThreshold_)
+    {
+        std::copy(other.begin(), other.end(), storage_.get());
+    }
+
+    /// @brief Move constructor
+    InputBuffer(InputBuffer&& other) noexcept :
+        storage_(std::move(other.storage_)),
+        capacity_(other.capacity_),
+        readPos_(other.readPos_),
+        writePos_(other.writePos_),
+        compactThreshold_(other.compactThreshold_)
+    {
+        other.capacity_ = 0U;
+        other.clear();
+    }
+
+    /// @brief Destructor
+    ~InputBuffer() noexcept = default;
+
+    /// @brief Copy assignment
+    /// @details Copies only the elements waiting to be processed.
+    InputBuffer& operator=(const InputBuffer& other)
+    {
+        if (this != &other) {
+            clear();
+            compactThreshold_ = other.compactThreshold_;
+            append(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment
+    InputBuffer& operator=(InputBuffer&& other) noexcept
+    {
+        if (this != &other) {
+            storage_ = std::move(other.storage_);
+            capacity_ = other.capacity_;
+            readPos_ = other.readPos_;
+            writePos_ = other.writePos_;
+            compactThreshold_ = other.compactThreshold_;
+            other.capacity_ = 0U;
+            other.clear();
+        }
+        return *this;
+    }
+
+    /// @brief Pointer to the first element waiting to be processed.
+    const_pointer data() const
+    {
+        return storage_.get() + readPos_;
+    }
+
+    /// @brief Same as @ref data()
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    /// @brief Pointer to the element following the last one waiting to be processed.
+    const_iterator end() const
+    {
+        return storage_.get() + writePos_;
+    }
+
+    /// @brief Number of elements waiting to be processed.
+    size_type size() const
+    {
+        return writePos_ - readPos_;
+    }
+
+    /// @brief Check whether there are no elements waiting to be processed.
+    bool empty() const
+    {
+        return readPos_ == writePos_;
+    }
+
+    /// @brief Size of the storage area.
+    size_type capacity() const
+    {
+        return capacity_;
+    }
+
+    /// @brief Size of the consumed region which hasn't been reclaimed yet.
+    size_type consumedSize() const
+    {
+        return readPos_;
+    }
+
+    /// @brief Get the compaction threshold.
+    size_type compactThreshold() const
+    {
+        return compactThreshold_;
+    }
+
+    /// @brief Set the compaction threshold.
+    void setCompactThreshold(size_type value)
+    {
+        compactThreshold_ = value;
+    }
+
+    /// @brief Prepare free space for the new data.
+    /// @details Compacts or grows the storage area when the free space at
+    ///     the back is insufficient. Invalidates all the previously
+    ///     returned pointers.
+    /// @param[in] len Required number of free elements.
+    /// @return Pointer to the free space where at least @b len elements can be written.
+    /// @post The written elements become available for processing only after
+    ///     @ref commit().
+    pointer prepare(size_type len)
+    {
+        if ((capacity_ - writePos_) < len) {
+            reserveInternal(len);
+        }
+
+        return storage_.get() + writePos_;
+    }
+
+    /// @brief Make the elements written into the space returned by the
+    ///     @ref prepare() available for processing.
+    /// @param[in] len Number of written elements, must not exceed the
+    ///     length passed to the preceding @ref prepare().
+    void commit(size_type len)
+    {
+        COMMS_ASSERT(len <= (capacity_ - writePos_));
+        writePos_ += len;
+    }
+
+    /// @brief Copy the new data into the buffer.
+    /// @details Equivalent to @ref prepare() followed by @ref commit().
+    template <typename TIter>
+    void append(TIter from, TIter to)
+    {
+        auto len = static_cast<size_type>(std::distance(from, to));
+        auto* ptr = prepare(len);
+        std::copy(from, to, ptr);
+        commit(len);
+    }
+
+    /// @brief Mark elements at the front as processed.
+    /// @details May compact the storage area according to the policy
+    ///     described in the class documentation.
+    /// @param[in] len Number of processed elements.
+    void consume(size_type len)
+    {
+        COMMS_ASSERT(len <= size());
+        readPos_ += std::min(len, size());
+        if (readPos_ == writePos_) {
+            readPos_ = 0U;
+            writePos_ = 0U;
+            return;
+        }
+
+        if ((compactThreshold_ <= readPos_) && (size() < readPos_)) {
+            compact();
+        }
+    }
+
+    /// @brief Move the elements waiting to be processed to the front of
+    ///     the storage area.
+    void compact()
+    {
+        if (readPos_ == 0U) {
+            return;
+        }
+
+        auto remSize = size();
+        std::copy(begin(), end(), storage_.get());
+        readPos_ = 0U;
+        writePos_ = remSize;
+    }
+
+    /// @brief Drop all the elements.
+    void clear()
+    {
+        readPos_ = 0U;
+        writePos_ = 0U;
+    }
+
+private:
+    using StoragePtr = std::unique_ptr<T[]>;
+
+    static StoragePtr allocate(size_type len)
+    {
+        if (len == 0U) {
+            return StoragePtr();
+        }
+
+        // Default initialisation, the elements are not zeroed
+        return StoragePtr(new T[len]);
+    }
+
+    void reserveInternal(size_type len)
+    {
+        auto required = size() + len;
+        if (required <= capacity_) {
+            compact();
+            return;
+        }
+
+        auto newCapacity = std::max(capacity_ * 2U, required);
+        auto newStorage = allocate(newCapacity);
+        std::copy(begin(), end(), newStorage.get());
+        writePos_ = size();
+        readPos_ = 0U;
+        storage_ = std::move(newStorage);
+        capacity_ = newCapacity;
+    }
+
+    StoragePtr storage_;
+    size_type capacity_ = 0U;
+    size_type readPos_ = 0U;
+    size_type writePos_ = 0U;
+    size_type compactThreshold_ = 0U;
+};
+
+}  // namespace util
+
+}  // namespace comms
@@ -0,0 +1,245 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains comms::util::InternTable class.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+namespace details
+{
+
+template <typename...>
+class InternTableHelper
+{
+public:
+    static constexpr std::size_t slotsCount(std::size_t capacity, std::size_t result = 1U)
+    {
+        return (capacity * 2U) <= result ? result : slotsCount(capacity, result * 2U);
+    }
+
+    static std::size_t hash(const char* str, std::size_t len)
+    {
+        // FNV-1a
+        std::uint64_t value = 14695981039346656037ULL;
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            value ^= static_cast<std::uint8_t>(str[idx]);
+            value *= 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(value);
+    }
+};
+
+}  // namespace details
+
+/// @brief Bounded table of interned strings.
+/// @details Keeps a single copy of every distinct string value added to it
+///     and provides a pointer to it, which remains valid during the lifetime of the
+///     table. As the result two strings from the same table are equal if and only if
+///     their pointers are equal. @n
+///     The table is implemented as open addressing hash table with
+///     atomic slots. The lookup of the existing values is lock-free and doesn't
+///     allocate memory, only the first insertion of a new value allocates.
+///     The strings are never removed from the table. @n
+///     The table is expected to be accessed via its @ref instance(), the tag
+///     parameter allows having several independent tables of the same capacity.
+/// @tparam TCapacity Maximal number of strings the table can hold.
+/// @tparam TTag Tag type to distinguish independent tables.
+/// @headerfile "comms/util/InternTable.h"
+template <std::size_t TCapacity, typename TTag = void>
+class InternTable
+{
+    static_assert(0U < TCapacity, "The capacity must be greater than 0");
+
+public:
+    /// @brief Default constructor
+    InternTable()
+    {
+        for (auto& slot : slots_) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Copy constructor is deleted
+    InternTable(const InternTable&) = delete;
+
+    /// @brief Copy assignment is deleted
+    InternTable& operator=(const InternTable&) = delete;
+
+    /// @brief Destructor
+    /// @details Invalidates all the interned values.
+    ~InternTable() noexcept
+    {
+        for (auto& slot : slots_) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Access the global instance of the table.
+    static InternTable& instance()
+    {
+        static InternTable Table;
+        return Table;
+    }
+
+    /// @brief Maximal number of strings the table can hold.
+    static constexpr std::size_t capacity()
+    {
+        return TCapacity;
+    }
+
+    /// @brief Number of strings currently held by the table.
+    std::size_t size() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Intern the string value.
+    /// @details Returns the pointer to the existing copy of the string if
+    ///     such exists, otherwise adds a new copy.
+    /// @param[in] str Pointer to the first character.
+    /// @param[in] len Number of characters.
+    /// @return Pointer to the zero terminated interned copy of the string,
+    ///     @b nullptr if the table is full and doesn't contain the value.
+    const char* intern(const char* str, std::size_t len)
+    {
+        if (len == 0U) {
+            return &empty_;
+        }
+
+        auto hashValue = details::InternTableHelper<>::hash(str, len);
+        Entry* newEntry = nullptr;
+        auto idx = hashValue & SlotsMask;
+        for (std::size_t probe = 0U; probe < SlotsCount; ++probe) {
+            auto& slot = slots_[idx];
+            auto* entry = slot.load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                if (newEntry == nullptr) {
+                    if (!reserve()) {
+                        return nullptr;
+                    }
+
+                    newEntry = new Entry(hashValue, str, len);
+                }
+
+                if (slot.compare_exchange_strong(entry, newEntry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return newEntry->str_.c_str();
+                }
+
+                // Other thread has occupied the slot
+                COMMS_ASSERT(entry != nullptr);
+            }
+
+            if (matches(*entry, hashValue, str, len)) {
+                discard(newEntry);
+                return entry->str_.c_str();
+            }
+
+            idx = (idx + 1U) & SlotsMask;
+        }
+
+        discard(newEntry);
+        return nullptr;
+    }
+
+    /// @brief Find the interned string value.
+    /// @param[in] str Pointer to the first character.
+    /// @param[in] len Number of characters.
+    /// @return Pointer to the zero terminated interned copy of the string,
+    ///     @b nullptr if the table doesn't contain the value.
+    const char* find(const char* str, std::size_t len) const
+    {
+        if (len == 0U) {
+            return &empty_;
+        }
+
+        auto hashValue = details::InternTableHelper<>::hash(str, len);
+        auto idx = hashValue & SlotsMask;
+        for (std::size_t probe = 0U; probe < SlotsCount; ++probe) {
+            auto* entry = slots_[idx].load(std::memory_order_acquire);
+            if (entry == nullptr) {
+                break;
+            }
+
+            if (matches(*entry, hashValue, str, len)) {
+                return entry->str_.c_str();
+            }
+
+            idx = (idx + 1U) & SlotsMask;
+        }
+
+        return nullptr;
+    }
+
+private:
+    struct Entry
+    {
+        Entry(std::size_t hashValue, const char* str, std::size_t len) :
+            hash_(hashValue),
+            str_(str, len)
+        {
+        }
+
+        std::size_t hash_ = 0U;
+        std::string str_;
+    };
+
+    // Keep the load factor at most 0.5 to have short probe sequences
+    static const std::size_t SlotsCount = details::InternTableHelper<>::slotsCount(TCapacity);
+    static const std::size_t SlotsMask = SlotsCount - 1U;
+
+    static bool matches(const Entry& entry, std::size_t hashValue, const char* str, std::size_t len)
+    {
+        return
+            (entry.hash_ == hashValue) &&
+            (entry.str_.size() == len) &&
+            (std::memcmp(entry.str_.data(), str, len) == 0);
+    }
+
+    bool reserve()
+    {
+        auto count = count_.fetch_add(1U, std::memory_order_relaxed);
+        if (count < TCapacity) {
+            return true;
+        }
+
+        count_.fetch_sub(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    void discard(Entry* entry)
+    {
+        if (entry == nullptr) {
+            return;
+        }
+
+        delete entry;
+        count_.fetch_sub(1U, std::memory_order_relaxed);
+    }
+
+    std::atomic<Entry*> slots_[SlotsCount];
+    std::atomic<std::size_t> count_{0U};
+    char empty_ = '\0';
+};
+
+}  // namespace util
+
+}  // namespace comms
@@ -0,0 +1,406 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains comms::util::InternedString class.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "comms/Assert.h"
+#include "comms/util/InternTable.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Immutable string value stored in the @ref InternTable.
+/// @details The object is a handle to the interned value, copying it
+///     doesn't allocate memory and the equality comparison of two interned values
+///     is a pointer comparison. Assigning a value which is already in the table
+///     doesn't allocate memory either. @n
+///     When the table is full and doesn't contain the assigned value, the
+///     value is copied into the separately allocated private buffer instead, such
+///     object reports @b false from @ref isInterned() and is compared by the
+///     contents. Keeping this buffer out of line keeps the object itself
+///     as small as a pointer and size pair plus one more pointer. @n
+///     Can be used as the storage type of @ref comms::field::String field,
+///     see @ref comms::option::app::InternedStringStorage.
+/// @tparam TTable Type of the intern table, expected to be a variant of
+///     @ref InternTable.
+/// @tparam TTrimAtZero Truncate the assigned values at the first zero
+///     character before interning them. Used by the fixed size strings
+///     padded with zeroes to avoid interning the padded values.
+/// @headerfile "comms/util/InternedString.h"
+template <typename TTable = InternTable<4096U>, bool TTrimAtZero = false>
+class InternedString
+{
+public:
+    /// @brief Type of the intern table
+    using Table = TTable;
+
+    /// @brief Type of the single character
+    using value_type = char;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Type of the difference between iterators
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Const pointer to the character
+    using const_pointer = const char*;
+
+    /// @brief Const reference to the character
+    using const_reference = const char&;
+
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+
+    /// @brief Type of the iterator (same as @ref const_iterator)
+    using iterator = const_iterator;
+
+    /// @brief Default constructor, creates empty string
+    InternedString() = default;
+
+    /// @brief Constructor
+    /// @param[in] str Pointer to the first character.
+    /// @param[in] len Number of characters.
+    InternedString(const char* str, size_type len)
+    {
+        assignInternal(str, len);
+    }
+
+    /// @brief Constructor from zero terminated string
+    InternedString(const char* str)
+    {
+        assignInternal(str, std::strlen(str));
+    }
+
+    /// @brief Constructor from std::string
+    InternedString(const std::string& str)
+    {
+        assignInternal(str.data(), str.size());
+    }
+
+    /// @brief Copy constructor
+    /// @details Allocates memory only when the copied value is not interned.
+    InternedString(const InternedString& other) :
+        str_(other.str_),
+        size_(other.size_)
+    {
+        if (other.own_) {
+            assignOwned(other.str_, other.size_);
+        }
+    }
+
+    /// @brief Move constructor
+    /// @details The moved-from object becomes empty.
+    InternedString(InternedString&& other) :
+        str_(other.str_),
+        size_(other.size_),
+        own_(std::move(other.own_))
+    {
+        other.clear();
+    }
+
+    /// @brief Destructor
+    ~InternedString() noexcept = default;
+
+    /// @brief Copy assignment
+    /// @details Allocates memory only when the copied value is not interned.
+    InternedString& operator=(const InternedString& other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (other.own_) {
+            assignOwned(other.str_, other.size_);
+            return *this;
+        }
+
+        str_ = other.str_;
+        size_ = other.size_;
+        own_.reset();
+        return *this;
+    }
+
+    /// @brief Move assignment
+    /// @details The moved-from object becomes empty.
+    InternedString& operator=(InternedString&& other)
+    {
+        if (this != &other) {
+            str_ = other.str_;
+            size_ = other.size_;
+            own_ = std::move(other.own_);
+            other.clear();
+        }
+        return *this;
+    }
+
+    /// @brief Assign new value.
+    /// @param[in] from Pointer to the first character.
+    /// @param[in] to Pointer to the character following the last one.
+    void assign(const_pointer from, const_pointer to)
+    {
+        COMMS_ASSERT(from <= to);
+        assignInternal(from, static_cast<size_type>(to - from));
+    }
+
+    /// @brief Clear the value.
+    void clear()
+    {
+        str_ = nullptr;
+        size_ = 0U;
+        own_.reset();
+    }
+
+    /// @brief Remove characters from the end.
+    /// @details Doesn't add the truncated value to the intern table. If the
+    ///     table already contains it, the object refers to the interned
+    ///     value, otherwise the value is copied into the private buffer.
+    void remove_suffix(size_type count)
+    {
+        COMMS_ASSERT(count <= size_);
+        if (count == 0U) {
+            return;
+        }
+
+        auto newSize = size_ - count;
+        if (newSize == 0U) {
+            clear();
+            return;
+        }
+
+        auto* interned = Table::instance().find(str_, newSize);
+        if (interned != nullptr) {
+            str_ = interned;
+            size_ = newSize;
+            own_.reset();
+            return;
+        }
+
+        if (!own_) {
+            assignOwned(str_, newSize);
+            return;
+        }
+
+        own_[newSize] = '\0';
+        size_ = newSize;
+    }
+
+    /// @brief Check whether the value is stored in the intern table.
+    /// @details The empty value is always considered to be interned.
+    bool isInterned() const
+    {
+        return !own_;
+    }
+
+    /// @brief Pointer to the zero terminated characters.
+    const_pointer c_str() const
+    {
+        if (str_ != nullptr) {
+            return str_;
+        }
+
+        return "";
+    }
+
+    /// @brief Same as @ref c_str()
+    const_pointer data() const
+    {
+        return c_str();
+    }
+
+    /// @brief Number of characters.
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /// @brief Same as @ref size()
+    size_type length() const
+    {
+        return size_;
+    }
+
+    /// @brief Maximal number of characters.
+    static constexpr size_type max_size()
+    {
+        return std::numeric_limits<size_type>::max() - 1U;
+    }
+
+    /// @brief Check whether the string is empty.
+    bool empty() const
+    {
+        return size_ == 0U;
+    }
+
+    /// @brief Iterator to the first character.
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    /// @brief Same as @ref begin()
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    /// @brief Iterator to the character following the last one.
+    const_iterator end() const
+    {
+        return data() + size_;
+    }
+
+    /// @brief Same as @ref end()
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    /// @brief Access the character (without bounds check).
+    const_reference operator[](size_type idx) const
+    {
+        COMMS_ASSERT(idx < size_);
+        return data()[idx];
+    }
+
+    /// @brief Access the first character.
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+
+    /// @brief Access the last character.
+    const_reference back() const
+    {
+        return (*this)[size_ - 1U];
+    }
+
+    /// @brief Get the copy of the value as std::string.
+    std::string str() const
+    {
+        return std::string(data(), size_);
+    }
+
+    /// @brief Lexicographical comparison of the values.
+    /// @return Negative value if this string is less than the other one,
+    ///     positive if greater, @b 0 when equal.
+    int compare(const InternedString& other) const
+    {
+        if ((str_ != nullptr) && (str_ == other.str_)) {
+            return 0;
+        }
+
+        auto minSize = std::min(size_, other.size_);
+        auto result = std::memcmp(data(), other.data(), minSize);
+        if (result != 0) {
+            return result;
+        }
+
+        if (size_ < other.size_) {
+            return -1;
+        }
+
+        if (other.size_ < size_) {
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /// @brief Equality comparison of the values.
+    /// @details Pointer comparison when both values are interned.
+    bool equals(const InternedString& other) const
+    {
+        if (isInterned() && other.isInterned()) {
+            return str_ == other.str_;
+        }
+
+        return
+            (size_ == other.size_) &&
+            (std::memcmp(data(), other.data(), size_) == 0);
+    }
+
+private:
+    void assignInternal(const char* str, size_type len)
+    {
+        if (TTrimAtZero) {
+            len = static_cast<size_type>(std::find(str, str + len, '\0') - str);
+        }
+
+        if (len == 0U) {
+            clear();
+            return;
+        }
+
+        auto* interned = Table::instance().intern(str, len);
+        if (interned == nullptr) {
+            assignOwned(str, len);
+            return;
+        }
+
+        str_ = interned;
+        size_ = len;
+        own_.reset();
+    }
+
+    void assignOwned(const char* str, size_type len)
+    {
+        // The source may be the currently owned buffer
+        std::unique_ptr<char[]> buf(new char[len + 1U]);
+        std::copy_n(str, len, buf.get());
+        buf[len] = '\0';
+        own_ = std::move(buf);
+        str_ = own_.get();
+        size_ = len;
+    }
+
+    const char* str_ = nullptr;
+    size_type size_ = 0U;
+    std::unique_ptr<char[]> own_;
+};
+
+/// @brief Equality comparison between the strings.
+/// @related InternedString
+template <typename TTable, bool TTrimAtZero>
+bool operator==(const InternedString<TTable, TTrimAtZero>& str1, const InternedString<TTable, TTrimAtZero>& str2)
+{
+    return str1.equals(str2);
+}
+
+/// @brief Inequality comparison between the strings.
+/// @related InternedString
+template <typename TTable, bool TTrimAtZero>
+bool operator!=(const InternedString<TTable, TTrimAtZero>& str1, const InternedString<TTable, TTrimAtZero>& str2)
+{
+    return !str1.equals(str2);
+}
+
+/// @brief Lexicographical comparison between the strings.
+/// @related InternedString
+template <typename TTable, bool TTrimAtZero>
+bool operator<(const InternedString<TTable, TTrimAtZero>& str1, const InternedString<TTable, TTrimAtZero>& str2)
+{
+    return str1.compare(str2) < 0;
+}
+
+}  // namespace util
+
+}  // namespace comms
@@ -0,0 +1,289 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Contains definition of @ref comms::util::PackedTuple
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "comms/util/type_traits.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+namespace details
+{
+
+template <std::size_t TOffset, typename... TElems>
+struct PackedTupleLayout;
+
+template <std::size_t TOffset>
+struct PackedTupleLayout<TOffset>
+{
+    static const std::size_t Size = TOffset;
+    static const std::size_t Alignment = 1U;
+    static const bool Aligned = true;
+    static const bool TriviallyCopyable = true;
+};
+
+template <std::size_t TOffset, typename T, typename... TRest>
+struct PackedTupleLayout<TOffset, T, TRest...>
+{
+    using Next = PackedTupleLayout<TOffset + sizeof(T), TRest...>;
+    static const std::size_t Size = Next::Size;
+    static const std::size_t Alignment =
+        (Next::Alignment < alignof(T)) ? alignof(T) : Next::Alignment;
+    static const bool Aligned = ((TOffset % alignof(T)) == 0U) && Next::Aligned;
+    static const bool TriviallyCopyable =
+        comms::util::IsTriviallyCopyableBoolType<T>::value && Next::TriviallyCopyable;
+};
+
+template <std::size_t TIdx, typename... TElems>
+struct PackedTupleOffset;
+
+template <typename T, typename... TRest>
+struct PackedTupleOffset<0U, T, TRest...>
+{
+    static const std::size_t Value = 0U;
+};
+
+template <std::size_t TIdx, typename T, typename... TRest>
+struct PackedTupleOffset<TIdx, T, TRest...>
+{
+    static const std::size_t Value = sizeof(T) + PackedTupleOffset<TIdx - 1U, TRest...>::Value;
+};
+
+} // namespace details
+
+/// @brief Check whether the provided types can be stored in
+///     @ref comms::util::PackedTuple.
+/// @details The types are expected to be trivially copyable, and the offset
+///     of every element in the packed storage (sum of the sizes of the preceding
+///     elements) must be properly aligned for its type.
+template <typename... TElems>
+constexpr bool isPackable()
+{
+    return
+        details::PackedTupleLayout<0U, TElems...>::Aligned &&
+        details::PackedTupleLayout<0U, TElems...>::TriviallyCopyable;
+}
+
+/// @brief Tuple-like storage, which keeps its elements one after another
+///     in the declaration order without any padding between them.
+/// @details Unlike @b std::tuple, whose layout is implementation defined, the
+///     memory occupied by the elements is the same as of the packed struct
+///     of the same members, i.e. its first @ref packedSize() bytes can be
+///     copied with a single @b memcpy(). The elements are accessed by the
+///     @ref comms::util::tupleGet() function (@b std::get() cannot be used) or by the
+///     @ref get() member function. The @b std::tuple_size and @b std::tuple_element
+///     are specialised, and all the tuple manipulation functions in the
+///     @ref comms::util namespace (such as @ref comms::util::tupleForEach()) support it.
+/// @tparam TElems Types of the elements, expected to be trivially copyable and
+///     to have properly aligned offsets in the packed storage
+///     (see @ref comms::util::isPackable()).
+/// @headerfile comms/util/PackedTuple.h
+template <typename... TElems>
+class PackedTuple
+{
+    using Layout = details::PackedTupleLayout<0U, TElems...>;
+    static_assert(0U < sizeof...(TElems), "At least one element is expected");
+    static_assert(isPackable<TElems...>(), "The elements cannot be packed");
+
+public:
+    /// @brief Type of the element with the provided index
+    template <std::size_t TIdx>
+    using ElementType = typename std::tuple_element<TIdx, std::tuple<TElems...> >::type;
+
+    /// @brief Default constructor
+    /// @details Default constructs every element.
+    PackedTuple()
+    {
+        defaultConstructFrom<0U>();
+    }
+
+    /// @brief Construct from the values of every element.
+    explicit PackedTuple(const TElems&... elems)
+    {
+        copyConstructFrom<0U>(elems...);
+    }
+
+    /// @brief Copy constructor
+    PackedTuple(const PackedTuple&) = default;
+
+    /// @brief Destructor
+    ~PackedTuple() noexcept = default;
+
+    /// @brief Copy assignment
+    PackedTuple& operator=(const PackedTuple&) = default;
+
+    /// @brief Number of bytes occupied by the elements.
+    static constexpr std::size_t packedSize()
+    {
+        return Layout::Size;
+    }
+
+    /// @brief Access the element with the provided index.
+    template <std::size_t TIdx>
+    ElementType<TIdx>& get()
+    {
+        return *reinterpret_cast<ElementType<TIdx>*>(elemPtr<TIdx>());
+    }
+
+    /// @brief Access the element with the provided index (const version).
+    template <std::size_t TIdx>
+    const ElementType<TIdx>& get() const
+    {
+        return *reinterpret_cast<const ElementType<TIdx>*>(elemPtr<TIdx>());
+    }
+
+    /// @brief Access the raw bytes of the elements.
+    std::uint8_t* data()
+    {
+        return &data_[0];
+    }
+
+    /// @brief Access the raw bytes of the elements (const version).
+    const std::uint8_t* data() const
+    {
+        return &data_[0];
+    }
+
+    /// @brief Equality comparison
+    bool operator==(const PackedTuple& other) const
+    {
+        return equalFrom<0U>(other);
+    }
+
+    /// @brief Inequality comparison
+    bool operator!=(const PackedTuple& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Less than comparison (lexicographical).
+    bool operator<(const PackedTuple& other) const
+    {
+        return lessFrom<0U>(other);
+    }
+
+private:
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx == sizeof...(TElems)>::type defaultConstructFrom()
+    {
+    }
+
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx < sizeof...(TElems)>::type defaultConstructFrom()
+    {
+        new (elemPtr<TIdx>()) ElementType<TIdx>();
+        defaultConstructFrom<TIdx + 1U>();
+    }
+
+    template <std::size_t TIdx>
+    void copyConstructFrom()
+    {
+    }
+
+    template <std::size_t TIdx, typename T, typename... TRest>
+    void copyConstructFrom(const T& elem, const TRest&... rest)
+    {
+        new (elemPtr<TIdx>()) T(elem);
+        copyConstructFrom<TIdx + 1U>(rest...);
+    }
+
+    template <std::size_t TIdx>
+    std::uint8_t* elemPtr()
+    {
+        return &data_[details::PackedTupleOffset<TIdx, TElems...>::Value];
+    }
+
+    template <std::size_t TIdx>
+    const std::uint8_t* elemPtr() const
+    {
+        return &data_[details::PackedTupleOffset<TIdx, TElems...>::Value];
+    }
+
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx == sizeof...(TElems), bool>::type equalFrom(const PackedTuple&) const
+    {
+        return true;
+    }
+
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx < sizeof...(TElems), bool>::type equalFrom(const PackedTuple& other) const
+    {
+        return (get<TIdx>() == other.get<TIdx>()) && equalFrom<TIdx + 1U>(other);
+    }
+
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx == sizeof...(TElems), bool>::type lessFrom(const PackedTuple&) const
+    {
+        return false;
+    }
+
+    template <std::size_t TIdx>
+    typename std::enable_if<TIdx < sizeof...(TElems), bool>::type lessFrom(const PackedTuple& other) const
+    {
+        return
+            (get<TIdx>() < other.get<TIdx>()) ||
+            ((!(other.get<TIdx>() < get<TIdx>())) && lessFrom<TIdx + 1U>(other));
+    }
+
+    alignas(Layout::Alignment) std::uint8_t data_[Layout::Size];
+};
+
+/// @brief Check whether provided type is a variant of
+///     @ref comms::util::PackedTuple.
+/// @tparam TType Type to check.
+template <typename TType>
+struct IsPackedTuple
+{
+    /// @brief By default Value has value false. Will be true for any
+    ///     variant of @ref comms::util::PackedTuple.
+    static constexpr bool Value = false;
+};
+
+/// @cond SKIP_DOC
+template <typename... TElems>
+struct IsPackedTuple<PackedTuple<TElems...> >
+{
+    static constexpr bool Value = true;
+};
+/// @endcond
+
+} // namespace util
+
+} // namespace comms
+
+namespace std
+{
+
+/// @cond SKIP_DOC
+template <typename... TElems>
+struct tuple_size<comms::util::PackedTuple<TElems...> > :
+    public std::integral_constant<std::size_t, sizeof...(TElems)>
+{
+};
+
+template <std::size_t TIdx, typename... TElems>
+struct tuple_element<TIdx, comms::util::PackedTuple<TElems...> >
+{
+    using type = typename std::tuple_element<TIdx, std::tuple<TElems...> >::type;
+};
+/// @endcond
+
+} // namespace std
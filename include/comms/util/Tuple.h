@@ -17,6 +17,7 @@
 #include "comms/CompileControl.h"
 #include "comms/util/type_traits.h"
 #include "comms/util/AlignedStorage.h"
+#include "comms/util/PackedTuple.h"
 #include "comms/Assert.h"
 
 COMMS_GNU_WARNING_PUSH
@@ -58,6 +59,39 @@ constexpr bool isTuple()
 
 //----------------------------------------
 
+/// @brief Access element of the tuple.
+/// @details Same as @b std::get(), but also supports @ref comms::util::PackedTuple.
+///     Used by all the tuple manipulation functions in this namespace.
+/// @tparam TIdx Index of the element.
+/// @param[in] tuple Reference (l- or r-value) to tuple object.
+template <std::size_t TIdx, typename TTuple>
+constexpr auto tupleGet(TTuple&& tuple) -> decltype(std::get<TIdx>(std::forward<TTuple>(tuple)))
+{
+    return std::get<TIdx>(std::forward<TTuple>(tuple));
+}
+
+/// @cond SKIP_DOC
+template <std::size_t TIdx, typename... TElems>
+typename std::tuple_element<TIdx, PackedTuple<TElems...> >::type& tupleGet(PackedTuple<TElems...>& tuple)
+{
+    return tuple.template get<TIdx>();
+}
+
+template <std::size_t TIdx, typename... TElems>
+const typename std::tuple_element<TIdx, PackedTuple<TElems...> >::type& tupleGet(const PackedTuple<TElems...>& tuple)
+{
+    return tuple.template get<TIdx>();
+}
+
+template <std::size_t TIdx, typename... TElems>
+typename std::tuple_element<TIdx, PackedTuple<TElems...> >::type&& tupleGet(PackedTuple<TElems...>&& tuple)
+{
+    return std::move(tuple.template get<TIdx>());
+}
+/// @endcond
+
+//----------------------------------------
+
 namespace details
 {
 
@@ -193,18 +227,18 @@ template <bool THasElems>
 struct TupleForEachHelper
 {
     template <std::size_t TOff, std::size_t TRem, typename TTuple, typename TFunc>
-    static void exec(TTuple&& tuple, TFunc&& func)
+    static COMMS_CONSTEXPR20 void exec(TTuple&& tuple, TFunc&& func)
     {
         using Tuple = typename std::decay<TTuple>::type;
-        static_assert(IsTuple<Tuple>::Value, "TTuple must be std::tuple");
-        static constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
-        static constexpr std::size_t OffsetedRem = TRem + TOff;
+        static_assert(IsTuple<Tuple>::Value || IsPackedTuple<Tuple>::Value, "TTuple must be std::tuple or comms::util::PackedTuple");
+        constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
+        constexpr std::size_t OffsetedRem = TRem + TOff;
         static_assert(OffsetedRem <= TupleSize, "Incorrect parameters");
 
-        static constexpr std::size_t Idx = TupleSize - OffsetedRem;
-        static constexpr std::size_t NextRem = TRem - 1;
-        static constexpr bool HasElemsToProcess = (NextRem != 0U);
-        func(std::get<Idx>(std::forward<TTuple>(tuple)));
+        constexpr std::size_t Idx = TupleSize - OffsetedRem;
+        constexpr std::size_t NextRem = TRem - 1;
+        constexpr bool HasElemsToProcess = (NextRem != 0U);
+        func(tupleGet<Idx>(std::forward<TTuple>(tuple)));
         TupleForEachHelper<HasElemsToProcess>::template exec<TOff, NextRem>(
             std::forward<TTuple>(tuple),
             std::forward<TFunc>(func));
@@ -215,7 +249,7 @@ template <>
 struct TupleForEachHelper<false>
 {
     template <std::size_t TOff, std::size_t TRem, typename TTuple, typename TFunc>
-    static void exec(TTuple&& tuple, TFunc&& func)
+    static COMMS_CONSTEXPR20 void exec(TTuple&& tuple, TFunc&& func)
     {
         static_cast<void>(tuple);
         static_cast<void>(func);
@@ -236,11 +270,11 @@ struct TupleForEachHelper<false>
 /// @param[in] tuple Reference (l- or r-value) to tuple object.
 /// @param[in] func Functor object.
 template <typename TTuple, typename TFunc>
-void tupleForEach(TTuple&& tuple, TFunc&& func)
+COMMS_CONSTEXPR20 void tupleForEach(TTuple&& tuple, TFunc&& func)
 {
     using Tuple = typename std::decay<TTuple>::type;
-    static constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
-    static constexpr bool HasTupleElems = (TupleSize != 0U);
+    constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
+    constexpr bool HasTupleElems = (TupleSize != 0U);
 
     details::TupleForEachHelper<HasTupleElems>::template exec<0, TupleSize>(
         std::forward<TTuple>(tuple),
@@ -280,14 +314,14 @@ void tupleForEachUntil(TTuple&& tuple, TFunc&& func)
 /// @param[in] func Functor object.
 /// @pre TIdx must be less than number of elements in the tuple.
 template <std::size_t TIdx, typename TTuple, typename TFunc>
-void tupleForEachFrom(TTuple&& tuple, TFunc&& func)
+COMMS_CONSTEXPR20 void tupleForEachFrom(TTuple&& tuple, TFunc&& func)
 {
     using Tuple = typename std::decay<TTuple>::type;
-    static constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
+    constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
     static_assert(TIdx <= TupleSize,
         "The index is too big.");
-    static constexpr std::size_t RemCount = TupleSize - TIdx;
-    static constexpr bool HasTupleElems = (RemCount != 0U);
+    constexpr std::size_t RemCount = TupleSize - TIdx;
+    constexpr bool HasTupleElems = (RemCount != 0U);
 
     details::TupleForEachHelper<HasTupleElems>::template exec<0, RemCount>(
         std::forward<TTuple>(tuple),
@@ -403,7 +437,7 @@ struct TupleForEachWithIdxHelper
     static void exec(TTuple&& tuple, TFunc&& func)
     {
         using Tuple = typename std::decay<TTuple>::type;
-        static_assert(IsTuple<Tuple>::Value, "TTuple must be std::tuple");
+        static_assert(IsTuple<Tuple>::Value || IsPackedTuple<Tuple>::Value, "TTuple must be std::tuple or comms::util::PackedTuple");
         static constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
         static_assert(TRem <= TupleSize, "Incorrect TRem");
 
@@ -411,7 +445,7 @@ struct TupleForEachWithIdxHelper
         static constexpr std::size_t NextRem = TRem - 1;
         static constexpr bool NextHasElems = (NextRem != 0U);
 
-        func(std::get<Idx>(std::forward<TTuple>(tuple)), Idx);
+        func(tupleGet<Idx>(std::forward<TTuple>(tuple)), Idx);
         TupleForEachWithIdxHelper<NextHasElems>::template exec<NextRem>(
             std::forward<TTuple>(tuple),
             std::forward<TFunc>(func));
@@ -467,7 +501,7 @@ struct TupleForEachWithTemplateParamIdxHelper
     static void exec(TTuple&& tuple, TFunc&& func)
     {
         using Tuple = typename std::decay<TTuple>::type;
-        static_assert(IsTuple<Tuple>::Value, "TTuple must be std::tuple");
+        static_assert(IsTuple<Tuple>::Value || IsPackedTuple<Tuple>::Value, "TTuple must be std::tuple or comms::util::PackedTuple");
         static constexpr std::size_t TupleSize = std::tuple_size<Tuple>::value;
         static_assert(TRem <= TupleSize, "Incorrect TRem");
 
@@ -477,9 +511,9 @@ struct TupleForEachWithTemplateParamIdxHelper
 
 #if COMMS_IS_MSVC
         // VS compiler
-        func.operator()<Idx>(std::get<Idx>(std::forward<TTuple>(tuple)));
+        func.operator()<Idx>(tupleGet<Idx>(std::forward<TTuple>(tuple)));
 #else // #if COMMS_IS_MSVC
-        func.template operator()<Idx>(std::get<Idx>(std::forward<TTuple>(tuple)));
+        func.template operator()<Idx>(tupleGet<Idx>(std::forward<TTuple>(tuple)));
 #endif // #if COMMS_IS_MSVC
         TupleForEachWithTemplateParamIdxHelper<NextHasElems>::template exec<NextRem>(
             std::forward<TTuple>(tuple),
@@ -541,13 +575,13 @@ struct TupleAccumulateHelper
     static constexpr TValue exec(TTuple&& tuple, const TValue& value, TFunc&& func)
     {
         using Tuple = typename std::decay<TTuple>::type;
-        static_assert(IsTuple<Tuple>::Value, "TTuple must be std::tuple");
+        static_assert(IsTuple<Tuple>::Value || IsPackedTuple<Tuple>::Value, "TTuple must be std::tuple or comms::util::PackedTuple");
         static_assert((TOff + TRem) <= std::tuple_size<Tuple>::value, "Incorrect params");
 
         return 
             TupleAccumulateHelper<(1U < TRem)>::template exec<TOff + 1, TRem - 1U>(
                 std::forward<TTuple>(tuple),
-                func(value, std::get<TOff>(std::forward<TTuple>(tuple))),
+                func(value, tupleGet<TOff>(std::forward<TTuple>(tuple))),
                 std::forward<TFunc>(func));
     }
 };
@@ -180,7 +180,7 @@ using AccessByteType =
     >;
 
 template <typename T, typename TIter>
-void writeBigUnsigned(T value, std::size_t size, TIter& iter)
+COMMS_CONSTEXPR20 void writeBigUnsigned(T value, std::size_t size, TIter& iter)
 {
     using ValueType = typename std::decay<T>::type;
     static_assert(std::is_unsigned<ValueType>::value, "T type must be unsigned");
@@ -189,7 +189,7 @@ void writeBigUnsigned(T value, std::size_t size, TIter& iter)
     using ByteType = AccessByteType<TIter>;
     static_assert(!std::is_void<ByteType>::value, "Invalid byte type");
     using UnsignedByteType = typename std::make_unsigned<ByteType>::type;
-    static const std::size_t BinDigits =
+    const std::size_t BinDigits =
         std::numeric_limits<UnsignedByteType>::digits;
     static_assert(BinDigits % 8 == 0, "Byte size assumption is not valid");
 
@@ -204,7 +204,7 @@ void writeBigUnsigned(T value, std::size_t size, TIter& iter)
 }
 
 template <typename T, typename TIter>
-void writeLittleUnsigned(T value, std::size_t size, TIter& iter)
+COMMS_CONSTEXPR20 void writeLittleUnsigned(T value, std::size_t size, TIter& iter)
 {
     using ValueType = typename std::decay<T>::type;
     static_assert(std::is_integral<ValueType>::value, "T must be integral type");
@@ -213,7 +213,7 @@ void writeLittleUnsigned(T value, std::size_t size, TIter& iter)
     using ByteType = AccessByteType<TIter>;
     static_assert(!std::is_void<ByteType>::value, "Invalid byte type");
     using UnsignedByteType = typename std::make_unsigned<ByteType>::type;
-    static const std::size_t BinDigits =
+    const std::size_t BinDigits =
         std::numeric_limits<UnsignedByteType>::digits;
     static_assert(BinDigits % 8 == 0, "Byte size assumption is not valid");
 
@@ -235,7 +235,7 @@ template <>
 struct WriteUnsignedFuncWrapper<traits::endian::Big>
 {
     template <typename T, typename TIter>
-    static void write(T value, std::size_t size, TIter& iter)
+    static COMMS_CONSTEXPR20 void write(T value, std::size_t size, TIter& iter)
     {
         writeBigUnsigned(value, size, iter);
     }
@@ -245,14 +245,14 @@ template <>
 struct WriteUnsignedFuncWrapper<traits::endian::Little>
 {
     template <typename T, typename TIter>
-    static void write(T value, std::size_t size, TIter& iter)
+    static COMMS_CONSTEXPR20 void write(T value, std::size_t size, TIter& iter)
     {
         writeLittleUnsigned(value, size, iter);
     }
 };
 
 template <typename TEndian, typename T, typename TIter>
-void write(T value, std::size_t size, TIter& iter)
+COMMS_CONSTEXPR20 void write(T value, std::size_t size, TIter& iter)
 {
     using ValueType = typename std::decay<T>::type;
     static_assert(std::is_integral<ValueType>::value, "T must be integral type");
@@ -324,14 +324,14 @@ class WriteHelper
     }
 
     template <typename TEndian, typename T, typename TIter, typename... TParams>
-    static void writeInternal(T value, std::size_t size, TIter& iter, RegularTag<TParams...>)
+    static COMMS_CONSTEXPR20 void writeInternal(T value, std::size_t size, TIter& iter, RegularTag<TParams...>)
     {
         details::write<TEndian>(value, size, iter);
     }        
 
 public:
     template <typename TEndian, typename T, typename TIter>
-    static void write(T value, std::size_t size, TIter& iter)
+    static COMMS_CONSTEXPR20 void write(T value, std::size_t size, TIter& iter)
     {
         using ValueType = typename std::decay<T>::type;
         using AccessOptimisedValueType = details::AccessOptimisedValueType<ValueType>;
@@ -519,8 +519,45 @@ public:
     }    
 };
 
+template <typename TEndian>
+struct AccessHostEndianCheckHelper
+{
+    static const bool Value = false;
+};
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+template <>
+struct AccessHostEndianCheckHelper<traits::endian::Little>
+{
+    static const bool Value = true;
+};
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+template <>
+struct AccessHostEndianCheckHelper<traits::endian::Big>
+{
+    static const bool Value = true;
+};
+#elif defined(_MSC_VER)
+// All the platforms supported by MSVC are little endian
+template <>
+struct AccessHostEndianCheckHelper<traits::endian::Little>
+{
+    static const bool Value = true;
+};
+#endif
+
 }  // namespace details
 
+/// @brief Compile time check whether the provided endian is the one of the
+///     host (platform the code is compiled for).
+/// @details Reports @b false when the host endian cannot be detected at compile time.
+/// @tparam TEndian Endian type, either @ref traits::endian::Big or @ref traits::endian::Little.
+template <typename TEndian>
+constexpr bool isHostEndian()
+{
+    return details::AccessHostEndianCheckHelper<TEndian>::Value;
+}
+
 /// @brief Write part of integral value into the output area using big
 ///     endian notation.
 /// @tparam TSize Number of bytes to write.
@@ -531,7 +568,7 @@ public:
 ///      and incremented at least TSize times.
 /// @post The iterator is advanced.
 template <std::size_t TSize, typename T, typename TIter>
-void writeBig(T value, TIter& iter)
+COMMS_CONSTEXPR20 void writeBig(T value, TIter& iter)
 {
     details::WriteHelper<>::template write<traits::endian::Big>(value, TSize, iter);
 }
@@ -546,7 +583,7 @@ void writeBig(T value, TIter& iter)
 ///      and incremented at least TSize times.
 /// @post The iterator is advanced.
 template <typename T, typename TIter>
-void writeBig(T value, std::size_t size, TIter& iter)
+COMMS_CONSTEXPR20 void writeBig(T value, std::size_t size, TIter& iter)
 {
     details::WriteHelper<>::template write<traits::endian::Big>(value, size, iter);
 }
@@ -559,7 +596,7 @@ void writeBig(T value, std::size_t size, TIter& iter)
 ///      and incremented at least sizeof(T) times.
 /// @post The iterator is advanced.
 template <typename T, typename TIter>
-void writeBig(T value, TIter& iter)
+COMMS_CONSTEXPR20 void writeBig(T value, TIter& iter)
 {
     using ValueType = typename std::decay<T>::type;
     writeBig<sizeof(ValueType)>(static_cast<ValueType>(value), iter);
@@ -621,7 +658,7 @@ T readBig(TIter& iter, std::size_t size)
 ///      and incremented at least TSize times.
 /// @post The iterator is advanced.
 template <std::size_t TSize, typename T, typename TIter>
-void writeLittle(T value, TIter& iter)
+COMMS_CONSTEXPR20 void writeLittle(T value, TIter& iter)
 {
     details::WriteHelper<>::template write<traits::endian::Little>(value, TSize, iter);
 }
@@ -636,7 +673,7 @@ void writeLittle(T value, TIter& iter)
 ///      and incremented at least TSize times.
 /// @post The iterator is advanced.
 template <typename T, typename TIter>
-void writeLittle(T value, std::size_t size, TIter& iter)
+COMMS_CONSTEXPR20 void writeLittle(T value, std::size_t size, TIter& iter)
 {
     details::WriteHelper<>::template write<traits::endian::Little>(value, size, iter);
 }
@@ -649,7 +686,7 @@ void writeLittle(T value, std::size_t size, TIter& iter)
 ///      and incremented at least sizeof(T) times.
 /// @post The iterator is advanced.
 template <typename T, typename TIter>
-void writeLittle(T value, TIter& iter)
+COMMS_CONSTEXPR20 void writeLittle(T value, TIter& iter)
 {
     using ValueType = typename std::decay<T>::type;
     writeLittle<sizeof(ValueType)>(static_cast<ValueType>(value), iter);
@@ -703,7 +740,7 @@ T readLittle(TIter& iter, std::size_t size)
 
 /// @brief Same as writeBig<T, TIter>()
 template <typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     TIter& iter,
     const traits::endian::Big& endian)
@@ -714,7 +751,7 @@ void writeData(
 
 /// @brief Same as writeBig<TSize, T, TIter>()
 template <std::size_t TSize, typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     TIter& iter,
     const traits::endian::Big& endian)
@@ -725,7 +762,7 @@ void writeData(
 
 /// @brief Same as writeBig<T, TIter>()
 template <typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     std::size_t size,
     TIter& iter,
@@ -737,7 +774,7 @@ void writeData(
 
 /// @brief Same as writeLittle<T, TIter>()
 template <typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     TIter& iter,
     const traits::endian::Little& endian)
@@ -748,7 +785,7 @@ void writeData(
 
 /// @brief Same as writeLittle<TSize, T, TIter>()
 template <std::size_t TSize, typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     TIter& iter,
     const traits::endian::Little& endian)
@@ -759,7 +796,7 @@ void writeData(
 
 /// @brief Same as writeLittle<T, TIter>()
 template <typename T, typename TIter>
-void writeData(
+COMMS_CONSTEXPR20 void writeData(
     T value,
     std::size_t size, 
     TIter& iter,
@@ -16,7 +16,11 @@
 #include <type_traits>
 #include <array>
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <limits>
+#include <tuple>
+#include <utility>
 
 #include "comms/CompileControl.h"
 #include "comms/Assert.h"
@@ -658,6 +662,511 @@ private:
 namespace details
 {
 
+class SharedCtrlBlock
+{
+public:
+    using ReleaseFunc = void (*)(SharedCtrlBlock*);
+
+    explicit SharedCtrlBlock(ReleaseFunc func) : release_(func) {}
+
+    SharedCtrlBlock(const SharedCtrlBlock&) = delete;
+    SharedCtrlBlock& operator=(const SharedCtrlBlock&) = delete;
+
+    void addRef()
+    {
+        count_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    void removeRef()
+    {
+        if (count_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+            release_(this);
+        }
+    }
+
+    unsigned useCount() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+protected:
+    ~SharedCtrlBlock() noexcept = default;
+
+private:
+    std::atomic<unsigned> count_{1U};
+    ReleaseFunc release_ = nullptr;
+};
+
+template <typename TObj>
+class DynMemorySharedNode : public SharedCtrlBlock
+{
+public:
+    template <typename... TArgs>
+    explicit DynMemorySharedNode(TArgs&&... args) :
+        SharedCtrlBlock(&DynMemorySharedNode::release),
+        obj_(std::forward<TArgs>(args)...)
+    {
+    }
+
+    TObj& obj()
+    {
+        return obj_;
+    }
+
+protected:
+    ~DynMemorySharedNode() noexcept = default;
+
+private:
+    static void release(SharedCtrlBlock* ctrl)
+    {
+        delete static_cast<DynMemorySharedNode*>(ctrl);
+    }
+
+    TObj obj_;
+};
+
+template <typename TObj>
+class InPlaceSharedNode : public SharedCtrlBlock
+{
+public:
+    template <typename... TArgs>
+    explicit InPlaceSharedNode(std::atomic<bool>& allocated, TArgs&&... args) :
+        SharedCtrlBlock(&InPlaceSharedNode::release),
+        allocated_(allocated),
+        obj_(std::forward<TArgs>(args)...)
+    {
+    }
+
+    TObj& obj()
+    {
+        return obj_;
+    }
+
+protected:
+    ~InPlaceSharedNode() noexcept = default;
+
+private:
+    static void release(SharedCtrlBlock* ctrl)
+    {
+        auto* node = static_cast<InPlaceSharedNode*>(ctrl);
+        auto& allocated = node->allocated_;
+        node->~InPlaceSharedNode();
+        allocated.store(false, std::memory_order_release);
+    }
+
+    std::atomic<bool>& allocated_;
+    TObj obj_;
+};
+
+template <typename TAllTypes>
+struct InPlaceSharedNodes;
+
+template <typename... TTypes>
+struct InPlaceSharedNodes<std::tuple<TTypes...> >
+{
+    using Type = std::tuple<InPlaceSharedNode<TTypes>...>;
+};
+
+} // namespace details
+
+/// @brief Smart pointer to the object allocated by one of the "shared" allocators,
+///     such as @ref DynMemoryShared or @ref InPlaceSingleShared.
+/// @details The reference counter is embedded in the same allocation as the
+///     object itself and it is updated atomically, which allows passing copies
+///     of the pointer to multiple consumers (possibly running on different threads)
+///     without copying the object. The object is destructed (and its storage released)
+///     when the last copy of the pointer is destructed or reset. The correct
+///     destructor of the allocated object is invoked even when @b T doesn't
+///     have virtual destructor.
+/// @tparam T Type of the object the pointer is pointing to.
+template <typename T>
+class SharedPtr
+{
+    template <typename U>
+    friend class SharedPtr;
+
+public:
+    /// @brief Type of the object the pointer is pointing to.
+    using element_type = T;
+
+    /// @brief Default constructor, creates empty pointer.
+    SharedPtr() = default;
+
+    /// @brief Construct empty pointer.
+    SharedPtr(std::nullptr_t) {}
+
+    /// @brief Constructor used by the allocators.
+    /// @details Takes ownership of the existing reference.
+    SharedPtr(T* obj, details::SharedCtrlBlock* ctrl) :
+        obj_(obj),
+        ctrl_(ctrl)
+    {
+    }
+
+    /// @brief Copy constructor, increments reference count.
+    SharedPtr(const SharedPtr& other) :
+        obj_(other.obj_),
+        ctrl_(other.ctrl_)
+    {
+        addRef();
+    }
+
+    /// @brief Move constructor.
+    SharedPtr(SharedPtr&& other) noexcept :
+        obj_(other.obj_),
+        ctrl_(other.ctrl_)
+    {
+        other.obj_ = nullptr;
+        other.ctrl_ = nullptr;
+    }
+
+    /// @brief Converting copy constructor.
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    SharedPtr(const SharedPtr<U>& other) :
+        obj_(other.obj_),
+        ctrl_(other.ctrl_)
+    {
+        addRef();
+    }
+
+    /// @brief Converting move constructor.
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    SharedPtr(SharedPtr<U>&& other) noexcept :
+        obj_(other.obj_),
+        ctrl_(other.ctrl_)
+    {
+        other.obj_ = nullptr;
+        other.ctrl_ = nullptr;
+    }
+
+    /// @brief Destructor, decrements reference count.
+    ~SharedPtr() noexcept
+    {
+        reset();
+    }
+
+    /// @brief Copy assignment.
+    SharedPtr& operator=(const SharedPtr& other)
+    {
+        SharedPtr(other).swap(*this);
+        return *this;
+    }
+
+    /// @brief Move assignment.
+    SharedPtr& operator=(SharedPtr&& other) noexcept
+    {
+        SharedPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /// @brief Converting move assignment.
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    SharedPtr& operator=(SharedPtr<U>&& other) noexcept
+    {
+        SharedPtr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    /// @brief Release the reference, the pointer becomes empty.
+    void reset() noexcept
+    {
+        auto* ctrl = ctrl_;
+        obj_ = nullptr;
+        ctrl_ = nullptr;
+        if (ctrl != nullptr) {
+            ctrl->removeRef();
+        }
+    }
+
+    /// @brief Swap with other pointer.
+    void swap(SharedPtr& other) noexcept
+    {
+        std::swap(obj_, other.obj_);
+        std::swap(ctrl_, other.ctrl_);
+    }
+
+    /// @brief Get raw pointer to the object.
+    T* get() const
+    {
+        return obj_;
+    }
+
+    /// @brief Dereference operator.
+    T& operator*() const
+    {
+        COMMS_ASSERT(obj_ != nullptr);
+        return *obj_;
+    }
+
+    /// @brief Member access operator.
+    T* operator->() const
+    {
+        COMMS_ASSERT(obj_ != nullptr);
+        return obj_;
+    }
+
+    /// @brief Check the pointer is not empty.
+    explicit operator bool() const
+    {
+        return obj_ != nullptr;
+    }
+
+    /// @brief Number of pointers sharing the same object, @b 0 when empty.
+    unsigned useCount() const
+    {
+        if (ctrl_ == nullptr) {
+            return 0U;
+        }
+
+        return ctrl_->useCount();
+    }
+
+private:
+    void addRef()
+    {
+        if (ctrl_ != nullptr) {
+            ctrl_->addRef();
+        }
+    }
+
+    T* obj_ = nullptr;
+    details::SharedCtrlBlock* ctrl_ = nullptr;
+};
+
+/// @brief Equality comparison of the @ref SharedPtr objects.
+/// @related SharedPtr
+template <typename T, typename U>
+bool operator==(const SharedPtr<T>& p1, const SharedPtr<U>& p2)
+{
+    return p1.get() == p2.get();
+}
+
+/// @brief Inequality comparison of the @ref SharedPtr objects.
+/// @related SharedPtr
+template <typename T, typename U>
+bool operator!=(const SharedPtr<T>& p1, const SharedPtr<U>& p2)
+{
+    return p1.get() != p2.get();
+}
+
+/// @brief Dynamic memory allocator producing reference counted objects.
+/// @details Similar to @ref DynMemory, but the allocated object is held by
+///     the @ref SharedPtr. The reference counter is allocated together with
+///     the object itself (single allocation). Doesn't require
+///     @b TInterface to have virtual destructor.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+template <typename TInterface>
+class DynMemoryShared
+{
+public:
+    /// @brief Smart pointer (@ref SharedPtr) to the allocated object
+    using Ptr = SharedPtr<TInterface>;
+
+    /// @brief Allocation function
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from TInterface.
+    /// @tparam TArgs types of arguments to be passed to the constructor.
+    /// @param[in] args Extra arguments to be passed to allocated object's constructor.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj, typename... TArgs>
+    static Ptr alloc(TArgs&&... args)
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+        auto* node = new details::DynMemorySharedNode<TObj>(std::forward<TArgs>(args)...);
+        return Ptr(&node->obj(), node);
+    }
+
+    /// @brief Inquiry whether allocation is possible
+    /// @return Always @b true.
+    static constexpr bool canAllocate()
+    {
+        return true;
+    }
+};
+
+/// @brief Dynamic memory allocator producing reference counted message objects
+///     without virtual destructor.
+/// @details Same as @ref DynMemoryShared, but exposes allocation function with
+///     the same signature as @ref DynMemoryNoVirtualDestructor.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+/// @tparam TId Type of message ID
+template <typename TInterface, typename TId>
+class DynMemorySharedNoVirtualDestructor : public DynMemoryShared<TInterface>
+{
+    using Base = DynMemoryShared<TInterface>;
+public:
+    /// @brief Smart pointer (@ref SharedPtr) to the allocated object
+    using Ptr = typename Base::Ptr;
+
+    /// @brief Allocation function
+    /// @details The @b id and @b idx parameters are not required to
+    ///     destruct the object properly and are ignored.
+    template <typename TObj, typename... TArgs>
+    static Ptr alloc(TId id, unsigned idx, TArgs&&... args)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        return Base::template alloc<TObj>(std::forward<TArgs>(args)...);
+    }
+};
+
+/// @brief In-place single object allocator producing reference counted objects.
+/// @details Similar to @ref InPlaceSingle, but the allocated object is held
+///     by the @ref SharedPtr. The reference counter is located in the same
+///     storage area as the object itself. New object can be allocated only after
+///     all the pointers to the previous one have been destructed, which
+///     can happen on different thread. Doesn't require @b TInterface
+///     to have virtual destructor.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+/// @tparam TAllTypes All the possible types that can be allocated with this
+///     allocator bundled in @b std::tuple.
+template <typename TInterface, typename TAllTypes>
+class InPlaceSingleShared
+{
+public:
+    /// @brief Smart pointer (@ref SharedPtr) to the allocated object
+    using Ptr = SharedPtr<TInterface>;
+
+    /// @brief Default constructor
+    InPlaceSingleShared() = default;
+
+    /// @brief Copy constructor
+    /// @details The allocated object (if exists) is not copied.
+    InPlaceSingleShared(const InPlaceSingleShared&) {}
+
+    /// @brief Destructor
+    ~InPlaceSingleShared()
+    {
+        // Not supposed to be destructed while elemenent is still allocated
+        COMMS_ASSERT(!allocated());
+    }
+
+    /// @brief Copy assignment
+    /// @details The allocated object (if exists) is not copied.
+    InPlaceSingleShared& operator=(const InPlaceSingleShared&)
+    {
+        return *this;
+    }
+
+    /// @copydoc InPlaceSingle::alloc
+    template <typename TObj, typename... TArgs>
+    Ptr alloc(TArgs&&... args)
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+
+        static_assert(comms::util::IsInTuple<TAllTypes>::template Type<TObj>::value,
+            "TObj must be in provided tuple of supported types");
+
+        using Node = details::InPlaceSharedNode<TObj>;
+        static_assert(sizeof(Node) <= sizeof(place_), "Object is too big");
+
+        if (allocated_.exchange(true, std::memory_order_acquire)) {
+            return Ptr();
+        }
+
+        auto* node = new (&place_) Node(allocated_, std::forward<TArgs>(args)...);
+        return Ptr(&node->obj(), node);
+    }
+
+    /// @brief Inquire whether the object is already allocated.
+    bool allocated() const
+    {
+        return allocated_.load(std::memory_order_acquire);
+    }
+
+    /// @brief Inquiry whether allocation is possible.
+    bool canAllocate() const
+    {
+        return !allocated();
+    }
+
+private:
+    using AlignedStorage =
+        typename TupleAsAlignedUnion<
+            typename details::InPlaceSharedNodes<TAllTypes>::Type
+        >::Type;
+
+    AlignedStorage place_;
+    std::atomic<bool> allocated_{false};
+};
+
+/// @brief In-place single object allocator producing reference counted
+///     message objects without virtual destructor.
+/// @details Same as @ref InPlaceSingleShared, but exposes allocation function with
+///     the same signature as @ref InPlaceSingleNoVirtualDestructor.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+/// @tparam TAllTypes All the possible types that can be allocated with this
+///     allocator bundled in @b std::tuple.
+/// @tparam TId Type of message ID
+template <typename TInterface, typename TAllTypes, typename TId>
+class InPlaceSingleSharedNoVirtualDestructor : public InPlaceSingleShared<TInterface, TAllTypes>
+{
+    using Base = InPlaceSingleShared<TInterface, TAllTypes>;
+public:
+    /// @brief Smart pointer (@ref SharedPtr) to the allocated object
+    using Ptr = typename Base::Ptr;
+
+    /// @brief Allocation function
+    /// @details The @b id and @b idx parameters are not required to
+    ///     destruct the object properly and are ignored.
+    template <typename TObj, typename... TArgs>
+    Ptr alloc(TId id, unsigned idx, TArgs&&... args)
+    {
+        static_cast<void>(id);
+        static_cast<void>(idx);
+        return Base::template alloc<TObj>(std::forward<TArgs>(args)...);
+    }
+};
+
+/// @brief In-place object pool allocator producing reference counted objects.
+/// @details Similar to @ref InPlacePool, but uses @ref InPlaceSingleShared
+///     for every element of the pool.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+/// @tparam TSize Number of objects this allocator is allowed to allocate.
+/// @tparam TAllTypes All the possible types that can be allocated with this
+///     allocator bundled in @b std::tuple.
+template <typename TInterface, std::size_t TSize, typename TAllTypes = std::tuple<TInterface> >
+class InPlacePoolShared
+{
+    using PoolElem = InPlaceSingleShared<TInterface, TAllTypes>;
+    using Pool = std::array<PoolElem, TSize>;
+public:
+
+    /// @brief Smart pointer (@ref SharedPtr) to the allocated object.
+    using Ptr = typename PoolElem::Ptr;
+
+    /// @copydoc InPlaceSingle::alloc
+    template <typename TObj, typename... TArgs>
+    Ptr alloc(TArgs&&... args)
+    {
+        for (auto& elem : pool_) {
+            if (!elem.canAllocate()) {
+                continue;
+            }
+
+            auto ptr = elem.template alloc<TObj>(std::forward<TArgs>(args)...);
+            if (ptr) {
+                return ptr;
+            }
+        }
+
+        return Ptr();
+    }
+
+private:
+    Pool pool_;
+};
+
+namespace details
+{
+
 template <typename...>
 struct InPlaceSingleDeepCondWrap
 {
@@ -712,6 +1221,53 @@ struct DynMemoryNoVirtualDestructorDeepCondWrap
 };
 
 
+template <typename...>
+struct InPlaceSingleSharedDeepCondWrap
+{
+    template <typename TInterface, typename TAllTypes, typename...>
+    using Type = comms::util::alloc::InPlaceSingleShared<TInterface, TAllTypes>;
+};
+
+template <typename...>
+struct InPlaceSingleSharedNoVirtualDestructorDeepCondWrap
+{
+    template <
+        typename TInterface,
+        typename TAllocMessages,
+        typename TOrigMessages,
+        typename TId,
+        typename...>
+    using Type = 
+        comms::util::alloc::InPlaceSingleSharedNoVirtualDestructor<
+            TInterface, 
+            TAllocMessages,
+            TId
+        >;
+};
+
+template <typename...>
+struct DynMemorySharedDeepCondWrap
+{
+    template <typename TInterface, typename...>
+    using Type = comms::util::alloc::DynMemoryShared<TInterface>;
+};
+
+template <typename...>
+struct DynMemorySharedNoVirtualDestructorDeepCondWrap
+{
+    template <
+        typename TInterface, 
+        typename TAllMessages, 
+        typename TId, 
+        typename...
+    >
+    using Type = 
+        comms::util::alloc::DynMemorySharedNoVirtualDestructor<
+            TInterface,
+            TId
+        >;
+};
+
 } // namespace details
 
 }  // namespace alloc
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <type_traits>
+#include "comms/CompileControl.h"
 #include "comms/util/details/type_traits.h"
 
 namespace comms
@@ -22,6 +23,16 @@ namespace util
 template <typename...>
 struct EmptyStruct {};
 
+#if COMMS_IS_GCC && (__GNUC__ < 5)
+// The standard library of GCC v4.x doesn't provide std::is_trivially_copyable
+template <typename T>
+using IsTriviallyCopyableBoolType = 
+    std::integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)>;
+#else // #if COMMS_IS_GCC && (__GNUC__ < 5)
+template <typename T>
+using IsTriviallyCopyableBoolType = std::is_trivially_copyable<T>;
+#endif // #if COMMS_IS_GCC && (__GNUC__ < 5)
+
 /// @brief Replacement to std::conditional
 template <bool TCond>
 struct Conditional
@@ -123,6 +134,18 @@ public:
     using Type = std::integral_constant<bool, T::hasReadNoStatus()>;
 };
 
+template <typename...>
+class FieldCheckFixedLengthReadNoStatus
+{
+public:
+    template <typename T>
+    using Type = 
+        std::integral_constant<
+            bool, 
+            (T::minLength() == T::maxLength()) && (0U < T::minLength()) && T::hasReadNoStatus()
+        >;
+};
+
 template <typename...>
 class FieldCheckWriteNoStatus
 {
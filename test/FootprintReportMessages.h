@@ -0,0 +1,75 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Types reported by the comms.FootprintReport target
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+
+#include "comms/comms.h"
+
+namespace footprint_report
+{
+
+using Field = comms::Field<comms::option::BigEndian>;
+
+using Message =
+    comms::Message<
+        comms::option::BigEndian,
+        comms::option::MsgIdType<std::uint8_t>
+    >;
+
+class Message1Fields
+{
+public:
+    using field1 = comms::field::IntValue<Field, std::uint16_t>;
+
+    using field2 =
+        comms::field::Optional<
+            comms::field::IntValue<Field, std::uint32_t>
+        >;
+
+    using field3 =
+        comms::field::String<
+            Field,
+            comms::option::SequenceSizeFieldPrefix<comms::field::IntValue<Field, std::uint8_t> >
+        >;
+
+    using field4 =
+        comms::field::Bundle<
+            Field,
+            std::tuple<
+                comms::field::IntValue<Field, std::uint8_t>,
+                comms::field::IntValue<Field, std::uint16_t>
+            >
+        >;
+
+    using All = std::tuple<field1, field2, field3, field4>;
+};
+
+class Message1 : public
+    comms::MessageBase<
+        Message,
+        comms::option::StaticNumIdImpl<1>,
+        comms::option::FieldsImpl<Message1Fields::All>,
+        comms::option::MsgType<Message1>
+    >
+{
+    using Base =
+        comms::MessageBase<
+            Message,
+            comms::option::StaticNumIdImpl<1>,
+            comms::option::FieldsImpl<Message1Fields::All>,
+            comms::option::MsgType<Message1>
+        >;
+public:
+    COMMS_MSG_FIELDS_NAMES(field1, field2, field3, field4);
+};
+
+} // namespace footprint_report
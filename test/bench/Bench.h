@@ -0,0 +1,87 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Minimal timing harness used by the benchmarks, reports the best
+// average time per operation out of several runs.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace bench
+{
+
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "m"(value) : "memory");
+#else
+    static const void* volatile Sink = nullptr;
+    Sink = &value;
+#endif
+}
+
+template <typename TFunc>
+double nsPerOp(std::size_t iterations, TFunc&& func, unsigned runs = 5U)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up
+    for (std::size_t idx = 0U; idx < (iterations / 10U); ++idx) {
+        func(idx);
+    }
+
+    double best = 0.0;
+    for (auto run = 0U; run < runs; ++run) {
+        auto start = Clock::now();
+        for (std::size_t idx = 0U; idx < iterations; ++idx) {
+            func(idx);
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        auto avg = static_cast<double>(elapsed) / static_cast<double>(iterations);
+        if ((run == 0U) || (avg < best)) {
+            best = avg;
+        }
+    }
+
+    return best;
+}
+
+inline void report(const char* name, double value)
+{
+    std::printf("%-56s %10.2f ns/op\n", name, value);
+}
+
+// Deterministic pseudo-random sequence, doesn't depend on the standard library implementation
+class Random
+{
+public:
+    explicit Random(std::uint32_t seed = 12345U) : state_(seed) {}
+
+    std::uint32_t next()
+    {
+        state_ = (state_ * 1103515245U) + 12345U;
+        return state_ >> 8U;
+    }
+
+    std::size_t next(std::size_t limit)
+    {
+        return static_cast<std::size_t>(next()) % limit;
+    }
+
+private:
+    std::uint32_t state_ = 0U;
+};
+
+} // namespace bench
@@ -0,0 +1,167 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares encoding and decoding of 1KiB payloads by the byte stuffing
+// codecs (comms::protocol::stuffing) over raw pointers (memchr() and word
+// at a time scanning with bulk copies of the runs) with the generic
+// iterator path and with the naive byte by byte loop commonly written by
+// hand. The payloads are random bytes (about 1 special byte in 128) and
+// text without any special bytes.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "comms/comms.h"
+#include "comms/protocol/stuffing/Cobs.h"
+#include "comms/protocol/stuffing/Hdlc.h"
+#include "comms/protocol/stuffing/Slip.h"
+#include "Bench.h"
+
+namespace
+{
+
+const std::size_t PayloadSize = 1024U;
+const std::size_t Iterations = 200000U;
+
+std::vector<std::uint8_t> makeRandomPayload()
+{
+    bench::Random rand;
+    std::vector<std::uint8_t> payload(PayloadSize);
+    for (auto& byte : payload) {
+        byte = static_cast<std::uint8_t>(rand.next(256U));
+    }
+    return payload;
+}
+
+std::vector<std::uint8_t> makeTextPayload()
+{
+    bench::Random rand;
+    std::vector<std::uint8_t> payload(PayloadSize);
+    for (auto& byte : payload) {
+        byte = static_cast<std::uint8_t>('a' + rand.next(26U));
+    }
+    return payload;
+}
+
+// Hand written SLIP decoding
+bool naiveSlipDecode(const std::uint8_t* src, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen)
+{
+    dstLen = 0U;
+    for (std::size_t idx = 0U; idx < srcLen; ++idx) {
+        auto byte = src[idx];
+        if (byte == 0xDB) {
+            ++idx;
+            if (idx == srcLen) {
+                return false;
+            }
+
+            if (src[idx] == 0xDC) {
+                byte = 0xC0;
+            }
+            else if (src[idx] == 0xDD) {
+                byte = 0xDB;
+            }
+            else {
+                return false;
+            }
+        }
+
+        dst[dstLen] = byte;
+        ++dstLen;
+    }
+
+    return true;
+}
+
+template <typename TCodec>
+void runCodec(const char* desc, const std::vector<std::uint8_t>& payload)
+{
+    TCodec codec;
+    std::vector<std::uint8_t> encoded(TCodec::maxEncodedLength(payload.size()));
+    auto encodeTime =
+        bench::nsPerOp(
+            Iterations,
+            [&codec, &payload, &encoded](std::size_t)
+            {
+                auto* writeIter = encoded.data();
+                codec.encode(payload.data(), payload.size(), writeIter);
+                bench::doNotOptimize(encoded[0]);
+            });
+
+    encoded.resize(codec.encodedLength(payload.data(), payload.size()));
+    std::vector<std::uint8_t> decoded(payload.size());
+    auto decodePtrTime =
+        bench::nsPerOp(
+            Iterations,
+            [&codec, &encoded, &decoded](std::size_t)
+            {
+                const auto* readIter = encoded.data();
+                std::size_t len = 0U;
+                auto result = codec.decode(readIter, encoded.size(), decoded.data(), len);
+                bench::doNotOptimize(result);
+                bench::doNotOptimize(decoded[0]);
+            });
+
+    auto decodeIterTime =
+        bench::nsPerOp(
+            Iterations,
+            [&codec, &encoded, &decoded](std::size_t)
+            {
+                auto readIter = encoded.cbegin();
+                std::size_t len = 0U;
+                auto result = codec.decode(readIter, encoded.size(), decoded.data(), len);
+                bench::doNotOptimize(result);
+                bench::doNotOptimize(decoded[0]);
+            });
+
+    std::printf("  %s (%u bytes encoded):\n", desc, static_cast<unsigned>(encoded.size()));
+    bench::report("    encode", encodeTime);
+    bench::report("    decode from pointer", decodePtrTime);
+    bench::report("    decode from std::vector iterator", decodeIterTime);
+}
+
+void runNaiveSlip(const std::vector<std::uint8_t>& payload)
+{
+    comms::protocol::stuffing::Slip codec;
+    std::vector<std::uint8_t> encoded(codec.encodedLength(payload.data(), payload.size()));
+    auto* writeIter = encoded.data();
+    codec.encode(payload.data(), payload.size(), writeIter);
+
+    std::vector<std::uint8_t> decoded(payload.size());
+    auto decodeTime =
+        bench::nsPerOp(
+            Iterations,
+            [&encoded, &decoded](std::size_t)
+            {
+                std::size_t len = 0U;
+                auto result = naiveSlipDecode(encoded.data(), encoded.size(), decoded.data(), len);
+                bench::doNotOptimize(result);
+                bench::doNotOptimize(decoded[0]);
+            });
+
+    std::printf("  hand written SLIP:\n");
+    bench::report("    decode from pointer", decodeTime);
+}
+
+void runAll(const char* desc, const std::vector<std::uint8_t>& payload)
+{
+    std::printf("%u bytes %s payload:\n", static_cast<unsigned>(payload.size()), desc);
+    runCodec<comms::protocol::stuffing::Slip>("SLIP", payload);
+    runCodec<comms::protocol::stuffing::Hdlc>("HDLC", payload);
+    runCodec<comms::protocol::stuffing::Cobs>("COBS", payload);
+    runNaiveSlip(payload);
+}
+
+} // namespace
+
+int main()
+{
+    runAll("random", makeRandomPayload());
+    runAll("text", makeTextPayload());
+    return 0;
+}
@@ -0,0 +1,152 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares calculation of the Fletcher and Adler checksums
+// (comms::protocol::checksum) over raw pointers (block-wise modulo
+// reduction with chunked vectorisable loop) and over the generic
+// iterators with the hand written per-byte modulo loops, as well as the
+// calculation by the comms::protocol::checksum::SinglePassIterator. The
+// table driven CRC-32 is provided for reference.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "comms/comms.h"
+#include "comms/protocol/checksum/Adler.h"
+#include "comms/protocol/checksum/Crc.h"
+#include "comms/protocol/checksum/Fletcher.h"
+#include "comms/protocol/checksum/SinglePassIterator.h"
+#include "Bench.h"
+
+namespace
+{
+
+std::uint32_t naiveFletcher16(const std::uint8_t* data, std::size_t len)
+{
+    std::uint32_t sum1 = 0U;
+    std::uint32_t sum2 = 0U;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        sum1 = (sum1 + data[idx]) % 255U;
+        sum2 = (sum2 + sum1) % 255U;
+    }
+    return (sum2 << 8U) | sum1;
+}
+
+std::uint32_t naiveFletcher32(const std::uint8_t* data, std::size_t len)
+{
+    std::uint32_t sum1 = 0U;
+    std::uint32_t sum2 = 0U;
+    for (std::size_t idx = 0U; (idx + 1U) < len; idx += 2U) {
+        sum1 = (sum1 + (data[idx] | (static_cast<std::uint32_t>(data[idx + 1U]) << 8U))) % 65535U;
+        sum2 = (sum2 + sum1) % 65535U;
+    }
+    return (sum2 << 16U) | sum1;
+}
+
+std::uint32_t naiveAdler32(const std::uint8_t* data, std::size_t len)
+{
+    std::uint32_t sum1 = 1U;
+    std::uint32_t sum2 = 0U;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        sum1 = (sum1 + data[idx]) % 65521U;
+        sum2 = (sum2 + sum1) % 65521U;
+    }
+    return (sum2 << 16U) | sum1;
+}
+
+using NaiveFunc = std::uint32_t (*)(const std::uint8_t*, std::size_t);
+
+template <typename TCalc>
+void runCalc(const char* desc, const std::vector<std::uint8_t>& data, std::size_t iterations, NaiveFunc naive)
+{
+    auto ptrTime =
+        bench::nsPerOp(
+            iterations,
+            [&data](std::size_t)
+            {
+                const auto* iter = data.data();
+                auto result = TCalc()(iter, data.size());
+                bench::doNotOptimize(result);
+            });
+
+    auto vecIterTime =
+        bench::nsPerOp(
+            iterations,
+            [&data](std::size_t)
+            {
+                auto iter = data.cbegin();
+                auto result = TCalc()(iter, data.size());
+                bench::doNotOptimize(result);
+            });
+
+    const auto* checkIter = data.data();
+    if ((naive != nullptr) && (static_cast<std::uint32_t>(TCalc()(checkIter, data.size())) != naive(data.data(), data.size()))) {
+        std::printf("ERROR: %s mismatch\n", desc);
+    }
+
+    // Advanced byte by byte, like by the fields read by the layers with
+    // comms::option::def::ChecksumLayerSinglePass
+    using SinglePassIter = comms::protocol::checksum::SinglePassIterator<const std::uint8_t*>;
+    auto singlePassTime =
+        bench::nsPerOp(
+            iterations,
+            [&data](std::size_t)
+            {
+                comms::protocol::checksum::SinglePassContext<const std::uint8_t*, TCalc> ctx(data.data(), false);
+                SinglePassIter iter(data.data(), ctx);
+                for (std::size_t idx = 0U; idx < data.size(); ++idx) {
+                    ++iter;
+                }
+                ctx.flush();
+                auto result = ctx.getValue();
+                bench::doNotOptimize(result);
+            });
+
+    std::printf("  %s:\n", desc);
+    bench::report("    pointer", ptrTime);
+    bench::report("    std::vector iterator", vecIterTime);
+    bench::report("    single pass iterator", singlePassTime);
+    if (naive == nullptr) {
+        return;
+    }
+
+    auto naiveTime =
+        bench::nsPerOp(
+            iterations,
+            [&data, naive](std::size_t)
+            {
+                auto result = naive(data.data(), data.size());
+                bench::doNotOptimize(result);
+            });
+
+    bench::report("    hand written", naiveTime);
+}
+
+void runAll(std::size_t len, std::size_t iterations)
+{
+    bench::Random rand;
+    std::vector<std::uint8_t> data(len);
+    for (auto& byte : data) {
+        byte = static_cast<std::uint8_t>(rand.next(256U));
+    }
+
+    std::printf("%u bytes:\n", static_cast<unsigned>(len));
+    runCalc<comms::protocol::checksum::Fletcher16>("Fletcher-16", data, iterations, &naiveFletcher16);
+    runCalc<comms::protocol::checksum::Fletcher32>("Fletcher-32", data, iterations, &naiveFletcher32);
+    runCalc<comms::protocol::checksum::Adler32>("Adler-32", data, iterations, &naiveAdler32);
+    runCalc<comms::protocol::checksum::Crc_32>("CRC-32", data, iterations, nullptr);
+}
+
+} // namespace
+
+int main()
+{
+    runAll(64U, 2000000U);
+    runAll(64U * 1024U, 2000U);
+    return 0;
+}
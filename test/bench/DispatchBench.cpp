@@ -0,0 +1,181 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares dispatch of the message objects to the handler using the
+// polymorphic, static binary search, linear switch and flat jump table
+// policies on dense (consecutive) and sparse message IDs.
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace
+{
+
+class Handler;
+
+using Interface =
+    comms::Message<
+        comms::option::def::MsgIdType<std::uint16_t>,
+        comms::option::app::IdInfoInterface,
+        comms::option::app::Handler<Handler>
+    >;
+
+template <std::uint16_t TId>
+class Msg : public
+    comms::MessageBase<
+        Interface,
+        comms::option::def::StaticNumIdImpl<TId>,
+        comms::option::def::ZeroFieldsImpl,
+        comms::option::def::MsgType<Msg<TId> >
+    >
+{
+};
+
+class Handler
+{
+public:
+    template <typename TMsg>
+    void handle(TMsg& msg)
+    {
+        static_cast<void>(msg);
+        sum_ += TMsg::staticMsgId();
+    }
+
+    void handle(Interface& msg)
+    {
+        static_cast<void>(msg);
+    }
+
+    std::uintmax_t sum() const
+    {
+        return sum_;
+    }
+
+private:
+    std::uintmax_t sum_ = 0U;
+};
+
+template <std::size_t TCount, std::uint16_t TStep, typename... TMsgs>
+struct AllMessagesBuilder
+{
+    using Type =
+        typename AllMessagesBuilder<
+            TCount - 1U,
+            TStep,
+            Msg<static_cast<std::uint16_t>((TCount - 1U) * TStep)>,
+            TMsgs...
+        >::Type;
+};
+
+template <std::uint16_t TStep, typename... TMsgs>
+struct AllMessagesBuilder<0U, TStep, TMsgs...>
+{
+    using Type = std::tuple<TMsgs...>;
+};
+
+template <std::size_t TCount, std::uint16_t TStep>
+struct Setup
+{
+    using AllMessages = typename AllMessagesBuilder<TCount, TStep>::Type;
+
+    using Factory =
+        comms::MsgFactory<
+            Interface,
+            AllMessages
+        >;
+
+    Setup()
+    {
+        Factory factory;
+        for (auto idx = 0U; idx < TCount; ++idx) {
+            auto id = static_cast<std::uint16_t>(idx * TStep);
+            msgs_.push_back(factory.createMsg(id));
+        }
+
+        bench::Random rand;
+        ops_.resize(4096U);
+        for (auto& op : ops_) {
+            op = rand.next(TCount);
+        }
+    }
+
+    template <typename TFunc>
+    double run(TFunc&& func)
+    {
+        static const std::size_t Iterations = 5000000U;
+        Handler handler;
+        auto result =
+            bench::nsPerOp(
+                Iterations,
+                [this, &handler, &func](std::size_t idx)
+                {
+                    auto& msg = *msgs_[ops_[idx % ops_.size()]];
+                    func(msg.getId(), msg, handler);
+                });
+
+        bench::doNotOptimize(handler.sum());
+        return result;
+    }
+
+private:
+    std::vector<typename Factory::MsgPtr> msgs_;
+    std::vector<std::size_t> ops_;
+};
+
+template <std::size_t TCount, std::uint16_t TStep>
+void runAll(const char* desc)
+{
+    using SetupType = Setup<TCount, TStep>;
+    using AllMessages = typename SetupType::AllMessages;
+
+    SetupType setup;
+    std::printf("%u messages, %s IDs:\n", static_cast<unsigned>(TCount), desc);
+    bench::report("  polymorphic",
+        setup.run(
+            [](std::uint16_t id, Interface& msg, Handler& handler)
+            {
+                comms::dispatchMsgPolymorphic<AllMessages>(id, msg, handler);
+            }));
+
+    bench::report("  static binary search",
+        setup.run(
+            [](std::uint16_t id, Interface& msg, Handler& handler)
+            {
+                comms::dispatchMsgStaticBinSearch<AllMessages>(id, msg, handler);
+            }));
+
+    bench::report("  linear switch",
+        setup.run(
+            [](std::uint16_t id, Interface& msg, Handler& handler)
+            {
+                comms::dispatchMsgLinearSwitch<AllMessages>(id, msg, handler);
+            }));
+
+    bench::report("  jump table",
+        setup.run(
+            [](std::uint16_t id, Interface& msg, Handler& handler)
+            {
+                comms::dispatchMsgJumpTable<AllMessages>(id, msg, handler);
+            }));
+}
+
+} // namespace
+
+int main()
+{
+    runAll<16U, 1U>("dense");
+    runAll<100U, 1U>("dense");
+    runAll<100U, 7U>("sparse");
+    runAll<50U, 100U>("very sparse");
+    return 0;
+}
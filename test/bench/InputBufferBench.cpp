@@ -0,0 +1,198 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares accumulation of the input received in chunks with the
+// comms::util::InputBuffer and with the common pattern of receiving the
+// data into a temporary array, appending it to std::vector and erasing the
+// consumed prefix after every comms::processAllWithDispatch() call.
+// The time is reported per received chunk of data.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace
+{
+
+class Handler;
+
+using Interface =
+    comms::Message<
+        comms::option::def::MsgIdType<std::uint8_t>,
+        comms::option::def::BigEndian,
+        comms::option::app::ReadIterator<const std::uint8_t*>,
+        comms::option::app::WriteIterator<std::uint8_t*>,
+        comms::option::app::Handler<Handler>
+    >;
+
+using FieldBase = comms::Field<comms::option::def::BigEndian>;
+
+using PayloadField =
+    comms::field::ArrayList<
+        FieldBase,
+        std::uint8_t,
+        comms::option::app::OrigDataView
+    >;
+
+class Msg : public
+    comms::MessageBase<
+        Interface,
+        comms::option::def::StaticNumIdImpl<1>,
+        comms::option::def::FieldsImpl<std::tuple<PayloadField> >,
+        comms::option::def::MsgType<Msg>
+    >
+{
+};
+
+using AllMessages = std::tuple<Msg>;
+
+using Frame =
+    comms::protocol::MsgSizeLayer<
+        comms::field::IntValue<FieldBase, std::uint32_t>,
+        comms::protocol::MsgIdLayer<
+            comms::field::IntValue<FieldBase, std::uint8_t>,
+            Interface,
+            AllMessages,
+            comms::protocol::MsgDataLayer<>,
+            comms::option::app::InPlaceAllocation
+        >
+    >;
+
+class Handler
+{
+public:
+    void handle(Msg& msg)
+    {
+        bytes_ += std::get<0>(msg.fields()).value().size();
+    }
+
+    void handle(Interface& msg)
+    {
+        static_cast<void>(msg);
+    }
+
+    std::size_t bytes() const
+    {
+        return bytes_;
+    }
+
+private:
+    std::size_t bytes_ = 0U;
+};
+
+const std::size_t ChunkSize = 1460U;
+
+std::vector<std::uint8_t> makeStream(std::size_t payloadSize)
+{
+    Frame frame;
+    Msg msg;
+    std::get<0>(msg.fields()).value() = comms::util::ArrayView<std::uint8_t>();
+
+    std::vector<std::uint8_t> payload(payloadSize, 0xab);
+    std::get<0>(msg.fields()).value() =
+        comms::util::ArrayView<std::uint8_t>(payload.data(), payload.size());
+
+    std::vector<std::uint8_t> stream;
+    while (stream.size() < (256U * 1024U)) {
+        auto prevSize = stream.size();
+        stream.resize(prevSize + frame.length(msg));
+        auto* writeIter = &stream[prevSize];
+        frame.write(msg, writeIter, stream.size() - prevSize);
+    }
+
+    return stream;
+}
+
+// Provides consecutive chunks of the endlessly repeated stream
+class ChunkSource
+{
+public:
+    explicit ChunkSource(const std::vector<std::uint8_t>& stream) :
+        streamSize_(stream.size()),
+        data_(stream)
+    {
+        // Doubled stream to allow chunks wrapping over its end
+        data_.insert(data_.end(), stream.begin(), stream.end());
+    }
+
+    // Imitates reading of the socket
+    void receive(std::uint8_t* buf)
+    {
+        std::copy_n(&data_[offset_], ChunkSize, buf);
+        offset_ += ChunkSize;
+        if (streamSize_ <= offset_) {
+            offset_ -= streamSize_;
+        }
+    }
+
+private:
+    std::size_t streamSize_ = 0U;
+    std::vector<std::uint8_t> data_;
+    std::size_t offset_ = 0U;
+};
+
+void runAll(std::size_t payloadSize)
+{
+    auto stream = makeStream(payloadSize);
+    static const std::size_t Iterations = 200000U;
+
+    Frame frame;
+    Handler vecHandler;
+    ChunkSource vecSource(stream);
+    std::vector<std::uint8_t> vecBuf;
+    auto vecTime =
+        bench::nsPerOp(
+            Iterations,
+            [&](std::size_t)
+            {
+                std::uint8_t readBuf[ChunkSize];
+                vecSource.receive(&readBuf[0]);
+                bench::doNotOptimize(readBuf);
+                vecBuf.insert(vecBuf.end(), std::begin(readBuf), std::end(readBuf));
+                auto consumed = comms::processAllWithDispatch(vecBuf.data(), vecBuf.size(), frame, vecHandler);
+                vecBuf.erase(vecBuf.begin(), vecBuf.begin() + static_cast<std::ptrdiff_t>(consumed));
+            });
+
+    Handler inBufHandler;
+    ChunkSource inBufSource(stream);
+    comms::util::InputBuffer<> inBuf;
+    auto inBufTime =
+        bench::nsPerOp(
+            Iterations,
+            [&](std::size_t)
+            {
+                inBufSource.receive(inBuf.prepare(ChunkSize));
+                inBuf.commit(ChunkSize);
+                comms::processAllWithDispatch(inBuf, frame, inBufHandler);
+            });
+
+    if (vecHandler.bytes() != inBufHandler.bytes()) {
+        std::printf("ERROR: processed data mismatch\n");
+    }
+
+    std::printf("%u bytes payload, %u bytes chunks:\n",
+        static_cast<unsigned>(payloadSize), static_cast<unsigned>(ChunkSize));
+    bench::report("  temporary array + std::vector + erase()", vecTime);
+    bench::report("  InputBuffer prepare() + commit()", inBufTime);
+}
+
+} // namespace
+
+int main()
+{
+    runAll(64U);
+    runAll(1024U);
+    runAll(16U * 1024U);
+    runAll(256U * 1024U);
+    return 0;
+}
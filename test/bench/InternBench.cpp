@@ -0,0 +1,152 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares the read (into reused and newly created fields) and equality
+// comparison of the comms::field::String fields holding a small set of
+// repeating values (like instrument symbols) with the default std::string
+// storage and with the interned storage
+// (comms::option::app::InternedStringStorage), including the case of
+// the intern table being too small for all the values.
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace
+{
+
+using FieldBase = comms::Field<comms::option::def::BigEndian>;
+
+using SizePrefix = comms::option::def::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint8_t> >;
+
+using StdStringField =
+    comms::field::String<
+        FieldBase,
+        SizePrefix
+    >;
+
+using InternedField =
+    comms::field::String<
+        FieldBase,
+        SizePrefix,
+        comms::option::app::InternedStringStorage<4096>
+    >;
+
+struct SmallTableTag {};
+
+using SmallTableField =
+    comms::field::String<
+        FieldBase,
+        SizePrefix,
+        comms::option::app::InternedStringStorage<16, SmallTableTag>
+    >;
+
+const std::size_t DistinctCount = 100U;
+const std::size_t ValuesCount = 4096U;
+
+std::vector<std::string> makeValues()
+{
+    // Lengths from 4 to 27 characters, some don't fit into the small string buffer
+    bench::Random rand;
+    std::vector<std::string> values;
+    for (auto idx = 0U; idx < DistinctCount; ++idx) {
+        auto len = 4U + rand.next(24U);
+        std::string str;
+        for (auto charIdx = 0U; charIdx < len; ++charIdx) {
+            str.push_back(static_cast<char>('A' + rand.next(26U)));
+        }
+        values.push_back(std::move(str));
+    }
+    return values;
+}
+
+std::vector<std::uint8_t> makeBuf(const std::vector<std::string>& values)
+{
+    bench::Random rand(54321U);
+    std::vector<std::uint8_t> buf;
+    for (auto idx = 0U; idx < ValuesCount; ++idx) {
+        StdStringField field(values[rand.next(values.size())]);
+        auto prevSize = buf.size();
+        buf.resize(prevSize + field.length());
+        auto* writeIter = &buf[prevSize];
+        field.write(writeIter, buf.size() - prevSize);
+    }
+    return buf;
+}
+
+template <typename TField>
+void runAll(const char* desc, const std::vector<std::string>& values, const std::vector<std::uint8_t>& buf)
+{
+    static const std::size_t Iterations = 200U;
+
+    std::vector<TField> fields(ValuesCount);
+    auto readTime =
+        bench::nsPerOp(
+            Iterations,
+            [&fields, &buf](std::size_t)
+            {
+                const auto* readIter = buf.data();
+                for (auto& field : fields) {
+                    auto es = field.read(readIter, static_cast<std::size_t>(buf.data() + buf.size() - readIter));
+                    bench::doNotOptimize(es);
+                }
+            });
+
+    // Messages created by the factory read into the new fields
+    auto freshReadTime =
+        bench::nsPerOp(
+            Iterations,
+            [&buf](std::size_t)
+            {
+                const auto* readIter = buf.data();
+                for (auto idx = 0U; idx < ValuesCount; ++idx) {
+                    TField field;
+                    auto es = field.read(readIter, static_cast<std::size_t>(buf.data() + buf.size() - readIter));
+                    bench::doNotOptimize(es);
+                    bench::doNotOptimize(field);
+                }
+            });
+
+    TField expected(values[0]);
+    std::size_t matches = 0U;
+    auto compareTime =
+        bench::nsPerOp(
+            Iterations,
+            [&fields, &expected, &matches](std::size_t)
+            {
+                for (auto& field : fields) {
+                    if (field == expected) {
+                        ++matches;
+                    }
+                }
+            });
+
+    bench::doNotOptimize(matches);
+    std::printf("%s:\n", desc);
+    std::printf("  %-54s %10u bytes\n", "sizeof(ValueType)", static_cast<unsigned>(sizeof(typename TField::ValueType)));
+    bench::report("  read into the same field", readTime / ValuesCount);
+    bench::report("  read into new field", freshReadTime / ValuesCount);
+    bench::report("  compare field", compareTime / ValuesCount);
+}
+
+} // namespace
+
+int main()
+{
+    auto values = makeValues();
+    auto buf = makeBuf(values);
+    std::printf("%u fields, %u distinct values\n",
+        static_cast<unsigned>(ValuesCount), static_cast<unsigned>(DistinctCount));
+    runAll<StdStringField>("std::string", values, buf);
+    runAll<InternedField>("interned, all values fit the table", values, buf);
+    runAll<SmallTableField>("interned, 16 values fit the table", values, buf);
+    return 0;
+}
@@ -0,0 +1,161 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares creation of the message objects by the comms::MsgFactory with
+// and without the message ID cache (comms::option::app::MsgFactoryHotIdCache)
+// on the skewed (few IDs make up most of the traffic) and uniform workloads.
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace
+{
+
+using Interface =
+    comms::Message<
+        comms::option::def::MsgIdType<std::uint16_t>
+    >;
+
+template <std::uint16_t TId>
+class Msg : public
+    comms::MessageBase<
+        Interface,
+        comms::option::def::StaticNumIdImpl<TId>,
+        comms::option::def::ZeroFieldsImpl,
+        comms::option::def::MsgType<Msg<TId> >
+    >
+{
+};
+
+const std::uint16_t IdStep = 7U;
+
+template <std::size_t TCount, typename... TMsgs>
+struct AllMessagesBuilder
+{
+    using Type =
+        typename AllMessagesBuilder<
+            TCount - 1U,
+            Msg<static_cast<std::uint16_t>((TCount - 1U) * IdStep)>,
+            TMsgs...
+        >::Type;
+};
+
+template <typename... TMsgs>
+struct AllMessagesBuilder<0U, TMsgs...>
+{
+    using Type = std::tuple<TMsgs...>;
+};
+
+template <std::size_t TCount>
+struct Setup
+{
+    using AllMessages = typename AllMessagesBuilder<TCount>::Type;
+
+    static const std::uint16_t HotId1 = static_cast<std::uint16_t>((TCount / 6U) * IdStep);
+    static const std::uint16_t HotId2 = static_cast<std::uint16_t>(((TCount * 2U) / 3U) * IdStep);
+    static const std::uint16_t HotId3 = static_cast<std::uint16_t>((TCount - 3U) * IdStep);
+
+    using PlainFactory =
+        comms::MsgFactory<
+            Interface,
+            AllMessages,
+            comms::option::app::InPlaceAllocation
+        >;
+
+    using CachedFactory =
+        comms::MsgFactory<
+            Interface,
+            AllMessages,
+            comms::option::app::InPlaceAllocation,
+            comms::option::app::MsgFactoryHotIdCache<4>
+        >;
+
+    using SeededFactory =
+        comms::MsgFactory<
+            Interface,
+            AllMessages,
+            comms::option::app::InPlaceAllocation,
+            comms::option::app::MsgFactoryLikelyIds<HotId1, HotId2, HotId3>
+        >;
+
+    static std::vector<std::uint16_t> skewedIds()
+    {
+        const std::uint16_t HotIds[] = {HotId1, HotId2, HotId3};
+        bench::Random rand;
+        std::vector<std::uint16_t> ids(4096U);
+        for (auto& id : ids) {
+            if (rand.next(100U) < 90U) {
+                id = HotIds[rand.next(std::extent<decltype(HotIds)>::value)];
+                continue;
+            }
+
+            id = static_cast<std::uint16_t>(rand.next(TCount) * IdStep);
+        }
+
+        return ids;
+    }
+
+    static std::vector<std::uint16_t> uniformIds()
+    {
+        bench::Random rand;
+        std::vector<std::uint16_t> ids(4096U);
+        for (auto& id : ids) {
+            id = static_cast<std::uint16_t>(rand.next(TCount) * IdStep);
+        }
+
+        return ids;
+    }
+};
+
+template <typename TFactory>
+double run(TFactory& factory, const std::vector<std::uint16_t>& ids)
+{
+    static const std::size_t Iterations = 2000000U;
+    return
+        bench::nsPerOp(
+            Iterations,
+            [&factory, &ids](std::size_t idx)
+            {
+                auto msg = factory.createMsg(ids[idx % ids.size()]);
+                bench::doNotOptimize(msg);
+            });
+}
+
+template <std::size_t TCount>
+void runAll()
+{
+    using SetupType = Setup<TCount>;
+    auto skewed = SetupType::skewedIds();
+    auto uniform = SetupType::uniformIds();
+
+    typename SetupType::PlainFactory plainFactory;
+    typename SetupType::CachedFactory cachedFactory;
+    typename SetupType::SeededFactory seededFactory;
+    const typename SetupType::SeededFactory& constSeededFactory = seededFactory;
+
+    std::printf("%u messages:\n", static_cast<unsigned>(TCount));
+    bench::report("  skewed: no cache", run(plainFactory, skewed));
+    bench::report("  skewed: adaptive cache (4)", run(cachedFactory, skewed));
+    bench::report("  skewed: likely IDs, const read-only lookup", run(constSeededFactory, skewed));
+    bench::report("  uniform: no cache", run(plainFactory, uniform));
+    bench::report("  uniform: adaptive cache (4)", run(cachedFactory, uniform));
+    bench::report("  uniform: likely IDs, const read-only lookup", run(constSeededFactory, uniform));
+}
+
+} // namespace
+
+int main()
+{
+    runAll<32U>();
+    runAll<200U>();
+    return 0;
+}
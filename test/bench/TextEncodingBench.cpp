@@ -0,0 +1,178 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares encoding and decoding of 1KiB payloads by the text codecs
+// (comms::protocol::text) with the branchy byte by byte loops commonly
+// written by hand, which validate every character as it goes.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "comms/comms.h"
+#include "comms/protocol/text/Base64.h"
+#include "comms/protocol/text/Hex.h"
+#include "Bench.h"
+
+namespace
+{
+
+const std::size_t PayloadSize = 1024U;
+const std::size_t Iterations = 200000U;
+
+std::vector<std::uint8_t> makePayload()
+{
+    bench::Random rand;
+    std::vector<std::uint8_t> payload(PayloadSize);
+    for (auto& byte : payload) {
+        byte = static_cast<std::uint8_t>(rand.next(256U));
+    }
+    return payload;
+}
+
+int naiveHexValue(std::uint8_t ch)
+{
+    if ((ch >= '0') && (ch <= '9')) {
+        return ch - '0';
+    }
+
+    if ((ch >= 'A') && (ch <= 'F')) {
+        return (ch - 'A') + 10;
+    }
+
+    if ((ch >= 'a') && (ch <= 'f')) {
+        return (ch - 'a') + 10;
+    }
+
+    return -1;
+}
+
+bool naiveHexDecode(const std::uint8_t* src, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen)
+{
+    dstLen = 0U;
+    for (std::size_t idx = 0U; (idx + 1U) < srcLen; idx += 2U) {
+        auto high = naiveHexValue(src[idx]);
+        auto low = naiveHexValue(src[idx + 1U]);
+        if ((high < 0) || (low < 0)) {
+            return false;
+        }
+
+        dst[dstLen] = static_cast<std::uint8_t>((high << 4) | low);
+        ++dstLen;
+    }
+
+    return true;
+}
+
+int naiveBase64Value(std::uint8_t ch)
+{
+    if ((ch >= 'A') && (ch <= 'Z')) {
+        return ch - 'A';
+    }
+
+    if ((ch >= 'a') && (ch <= 'z')) {
+        return (ch - 'a') + 26;
+    }
+
+    if ((ch >= '0') && (ch <= '9')) {
+        return (ch - '0') + 52;
+    }
+
+    if (ch == '+') {
+        return 62;
+    }
+
+    if (ch == '/') {
+        return 63;
+    }
+
+    return -1;
+}
+
+// Decodes unpadded input only, enough for the payload length multiple of 3
+bool naiveBase64Decode(const std::uint8_t* src, std::size_t srcLen, std::uint8_t* dst, std::size_t& dstLen)
+{
+    dstLen = 0U;
+    for (std::size_t idx = 0U; (idx + 3U) < srcLen; idx += 4U) {
+        unsigned group = 0U;
+        for (auto charIdx = 0U; charIdx < 4U; ++charIdx) {
+            auto value = naiveBase64Value(src[idx + charIdx]);
+            if (value < 0) {
+                return false;
+            }
+
+            group = (group << 6U) | static_cast<unsigned>(value);
+        }
+
+        dst[dstLen] = static_cast<std::uint8_t>(group >> 16U);
+        dst[dstLen + 1U] = static_cast<std::uint8_t>(group >> 8U);
+        dst[dstLen + 2U] = static_cast<std::uint8_t>(group);
+        dstLen += 3U;
+    }
+
+    return true;
+}
+
+using NaiveDecodeFunc = bool (*)(const std::uint8_t*, std::size_t, std::uint8_t*, std::size_t&);
+
+template <typename TCodec>
+void runCodec(const char* desc, const std::vector<std::uint8_t>& payload, NaiveDecodeFunc naiveDecode)
+{
+    TCodec codec;
+    std::vector<std::uint8_t> encoded(TCodec::encodedLength(payload.size()));
+    auto encodeTime =
+        bench::nsPerOp(
+            Iterations,
+            [&codec, &payload, &encoded](std::size_t)
+            {
+                auto* writeIter = encoded.data();
+                codec.encode(payload.data(), payload.size(), writeIter);
+                bench::doNotOptimize(encoded[0]);
+            });
+
+    std::vector<std::uint8_t> decoded(TCodec::maxDecodedLength(encoded.size()));
+    auto decodeTime =
+        bench::nsPerOp(
+            Iterations,
+            [&codec, &encoded, &decoded](std::size_t)
+            {
+                const auto* readIter = encoded.data();
+                std::size_t len = 0U;
+                auto result = codec.decode(readIter, encoded.size(), decoded.data(), len);
+                bench::doNotOptimize(result);
+                bench::doNotOptimize(decoded[0]);
+            });
+
+    auto naiveDecodeTime =
+        bench::nsPerOp(
+            Iterations,
+            [naiveDecode, &encoded, &decoded](std::size_t)
+            {
+                std::size_t len = 0U;
+                auto result = naiveDecode(encoded.data(), encoded.size(), decoded.data(), len);
+                bench::doNotOptimize(result);
+                bench::doNotOptimize(decoded[0]);
+            });
+
+    std::printf("%s (%u bytes encoded):\n", desc, static_cast<unsigned>(encoded.size()));
+    bench::report("  encode", encodeTime);
+    bench::report("  decode", decodeTime);
+    bench::report("  hand written decode", naiveDecodeTime);
+}
+
+} // namespace
+
+int main()
+{
+    auto payload = makePayload();
+    runCodec<comms::protocol::text::Hex<> >("Hex", payload, &naiveHexDecode);
+
+    // Multiple of 3 to avoid padding
+    payload.resize((payload.size() / 3U) * 3U);
+    runCodec<comms::protocol::text::Base64>("Base64", payload, &naiveBase64Decode);
+    return 0;
+}
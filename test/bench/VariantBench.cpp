@@ -0,0 +1,155 @@
+//
+// Copyright 2025 - 2025 (C). Alex Robenko. All rights reserved.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Compares the memory footprint and the read / write times of the list of
+// variant fields, which rarely (1%) select the 1KiB member, with and
+// without the out-of-line storage of the large members
+// (comms::option::app::VariantSpillLargeMembers).
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "comms/comms.h"
+#include "Bench.h"
+
+namespace
+{
+
+using FieldBase = comms::Field<comms::option::def::BigEndian>;
+
+template <std::uint8_t TVal>
+using KeyField =
+    comms::field::IntValue<
+        FieldBase,
+        std::uint8_t,
+        comms::option::def::DefaultNumValue<TVal>,
+        comms::option::def::ValidNumValueRange<TVal, TVal>,
+        comms::option::def::FailOnInvalid<>,
+        comms::option::def::FixedValue
+    >;
+
+using SmallMember =
+    comms::field::Bundle<
+        FieldBase,
+        std::tuple<
+            KeyField<1>,
+            comms::field::IntValue<FieldBase, std::uint32_t>
+        >
+    >;
+
+using LargeMember =
+    comms::field::Bundle<
+        FieldBase,
+        std::tuple<
+            KeyField<2>,
+            comms::field::ArrayList<
+                FieldBase,
+                std::uint8_t,
+                comms::option::def::SequenceSizeFieldPrefix<
+                    comms::field::IntValue<FieldBase, std::uint16_t>
+                >,
+                comms::option::app::FixedSizeStorage<1024>
+            >
+        >
+    >;
+
+using InlineVariant =
+    comms::field::Variant<
+        FieldBase,
+        std::tuple<SmallMember, LargeMember>
+    >;
+
+using SpillVariant =
+    comms::field::Variant<
+        FieldBase,
+        std::tuple<SmallMember, LargeMember>,
+        comms::option::app::VariantSpillLargeMembers<64>
+    >;
+
+template <typename TVariant>
+using List =
+    comms::field::ArrayList<
+        FieldBase,
+        TVariant,
+        comms::option::def::SequenceSizeFieldPrefix<
+            comms::field::IntValue<FieldBase, std::uint16_t>
+        >
+    >;
+
+const std::size_t ElemCount = 1000U;
+
+template <typename TVariant>
+std::vector<std::uint8_t> makeBuf()
+{
+    List<TVariant> list;
+    bench::Random rand;
+    for (auto idx = 0U; idx < ElemCount; ++idx) {
+        auto& elem = list.createBack();
+        if (rand.next(100U) != 0U) {
+            auto& mem = elem.template initField<0>();
+            std::get<1>(mem.value()).setValue(idx);
+            continue;
+        }
+
+        auto& mem = elem.template initField<1>();
+        std::get<1>(mem.value()).value().resize(512U, static_cast<std::uint8_t>(idx));
+    }
+
+    std::vector<std::uint8_t> buf(list.length());
+    auto* writeIter = buf.data();
+    list.write(writeIter, buf.size());
+    return buf;
+}
+
+template <typename TVariant>
+void runAll(const char* desc)
+{
+    using ListType = List<TVariant>;
+    auto buf = makeBuf<TVariant>();
+    static const std::size_t Iterations = 2000U;
+
+    ListType list;
+    auto readTime =
+        bench::nsPerOp(
+            Iterations,
+            [&list, &buf](std::size_t)
+            {
+                const auto* readIter = buf.data();
+                auto es = list.read(readIter, buf.size());
+                bench::doNotOptimize(es);
+            });
+
+    std::vector<std::uint8_t> outBuf(buf.size());
+    auto writeTime =
+        bench::nsPerOp(
+            Iterations,
+            [&list, &outBuf](std::size_t)
+            {
+                auto* writeIter = outBuf.data();
+                auto es = list.write(writeIter, outBuf.size());
+                bench::doNotOptimize(es);
+            });
+
+    std::printf("%s:\n", desc);
+    std::printf("  %-54s %10u bytes\n", "sizeof(Variant)", static_cast<unsigned>(sizeof(TVariant)));
+    std::printf("  %-54s %10u bytes\n", "list storage",
+        static_cast<unsigned>(list.value().capacity() * sizeof(TVariant)));
+    bench::report("  read list", readTime);
+    bench::report("  write list", writeTime);
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%u elements, 1%% of them use 1KiB member\n", static_cast<unsigned>(ElemCount));
+    runAll<InlineVariant>("inline members");
+    runAll<SpillVariant>("members above 64 bytes spilled");
+    return 0;
+}